@@ -14,11 +14,14 @@
 #ifndef RANGES_V3_CONTAINER_ACTION_HPP
 #define RANGES_V3_CONTAINER_ACTION_HPP
 
+#include <tuple>
+#include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/action/concepts.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/integer_sequence.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -41,8 +44,67 @@ namespace ranges
                         A::bind(std::forward<Ts>(ts)...)
                     )
                 };
+                template<typename Action>
+                static Action unwrap(action<Action> act)
+                {
+                    return std::move(act.action_);
+                }
+            };
+
+            /// An action with all of its arguments but the range bound. Unlike
+            /// a `std::bind` expression, the action and its arguments can be
+            /// named, so that `fuse_actions` can recognize steps it knows how to
+            /// carry out together.
+            template<typename Fn, typename...Ts>
+            struct bound_action
+            {
+                Fn fn_;
+                std::tuple<Ts...> args_;
+            private:
+                template<typename Rng, std::size_t...Is>
+                auto call_(Rng && rng, index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    fn_(std::forward<Rng>(rng), std::get<Is>(args_)...)
+                )
+            public:
+                template<typename Rng>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    this->call_(std::forward<Rng>(rng), make_index_sequence<sizeof...(Ts)>{})
+                )
             };
 
+            template<typename Fn, typename...Ts>
+            bound_action<Fn, Ts...> bind_action(Fn fn, Ts...ts)
+            {
+                return {std::move(fn), std::tuple<Ts...>{std::move(ts)...}};
+            }
+
+            /// Two actions applied one after the other.
+            template<typename First, typename Second>
+            struct fused_action
+            {
+                First first_;
+                Second second_;
+                template<typename Rng>
+                auto operator()(Rng && rng) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    second_(first_(std::forward<Rng>(rng)))
+                )
+            };
+
+            /// Combines two adjacent steps of an action pipeline. This overload
+            /// runs them one after the other; action headers add overloads for
+            /// pairs of steps that can share a pass over the range.
+            template<typename First, typename Second>
+            fused_action<First, Second> fuse_actions(First first, Second second)
+            {
+                return {std::move(first), std::move(second)};
+            }
+
             struct make_action_fn
             {
                 template<typename Fun>
@@ -65,6 +127,7 @@ namespace ranges
             private:
                 Action action_;
                 friend pipeable_access;
+                friend action_access;
                 template<typename Rng>
                 using ActionPipeConcept = meta::and_<
                     Function<Action, Rng>,
@@ -119,6 +182,16 @@ namespace ranges
                 )
             };
 
+            /// Composing two actions gives another action, which lets adjacent
+            /// steps be fused by `fuse_actions`.
+            template<typename Action0, typename Action1>
+            auto operator|(action<Action0> act0, action<Action1> act1)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                make_action(fuse_actions(action_access::unwrap(std::move(act0)),
+                    action_access::unwrap(std::move(act1))))
+            )
+
             template<typename Rng, typename Action,
                 CONCEPT_REQUIRES_(is_pipeable<Action>() && Iterable<Rng &>() &&
                     Function<bitwise_or, ref_t<Rng &> &&, Action>() &&
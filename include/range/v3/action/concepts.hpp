@@ -69,6 +69,19 @@ namespace ranges
                         concepts::model_of<Constructible, uncvref_t<T>, I, I>()
                     ));
             };
+
+            // std::vector and std::string are ReservableContainers, std::deque is not
+            struct ReservableContainer
+              : refines<Container>
+            {
+                template<typename T>
+                auto requires_(T t) -> decltype(
+                    concepts::valid_expr(
+                        concepts::model_of<RandomAccessIterable, T>(),
+                        ((void)t.reserve(t.size()), 42),
+                        ((void)t.capacity(), 42)
+                    ));
+            };
         }
 
         template<typename T>
@@ -77,6 +90,9 @@ namespace ranges
         template<typename T>
         using Container = concepts::models<concepts::Container, T>;
 
+        template<typename T>
+        using ReservableContainer = concepts::models<concepts::ReservableContainer, T>;
+
         /// \cond
         namespace detail
         {
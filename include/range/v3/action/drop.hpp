@@ -37,11 +37,10 @@ namespace ranges
             private:
                 friend action_access;
                 template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(drop_fn drop, Int n)
-                RANGES_DECLTYPE_AUTO_RETURN
-                (
-                    std::bind(drop, std::placeholders::_1, n)
-                )
+                static bound_action<drop_fn, Int> bind(drop_fn drop, Int n)
+                {
+                    return bind_action(drop, n);
+                }
             public:
                 struct ConceptImpl
                 {
@@ -15,10 +15,13 @@
 #define RANGES_V3_ACTION_INSERT_HPP
 
 #include <utility>
+#include <iterator>
 #include <functional>
+#include <type_traits>
 #include <initializer_list>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/common_iterator.hpp>
@@ -76,13 +79,67 @@ namespace ranges
                 return unwrap_reference(cont).insert(p, n, std::forward<T>(t));
             }
 
+            // Inserting a range at a position. When the length of the range is
+            // known and the container is too small for it, a container that can
+            // reserve is grown once, to at least twice its capacity, so that
+            // repeated appends keep the container's geometric growth. The
+            // elements then go through the container's own insert, which keeps
+            // its exception guarantees. Elements of an rvalue container are moved
+            // rather than copied.
+            template<typename Cont, typename I, typename S>
+            void reserve_(Cont &cont, I i, S j, std::true_type)
+            {
+                auto const size = cont.size() +
+                    static_cast<range_size_t<Cont>>(ranges::distance(i, j));
+                auto const capacity = cont.capacity();
+                if(size > capacity)
+                    cont.reserve(size < 2 * capacity ? 2 * capacity : size);
+            }
+            template<typename Cont, typename I, typename S>
+            void reserve_(Cont &, I, S, std::false_type)
+            {}
+
+            template<typename Cont, typename P, typename I, typename S,
+                typename C = common_iterator<I, S>>
+            auto insert_range_(Cont &cont, P p, I i, S j, std::false_type) ->
+                decltype(cont.insert(p, C{i}, C{j}))
+            {
+                return cont.insert(p, C{i}, C{j});
+            }
+            template<typename Cont, typename P, typename I, typename S,
+                typename C = common_iterator<I, S>>
+            auto insert_range_(Cont &cont, P p, I i, S j, std::true_type) ->
+                decltype(cont.insert(p, C{i}, C{j}))
+            {
+                return cont.insert(p, std::make_move_iterator(C{i}), std::make_move_iterator(C{j}));
+            }
+
+            template<typename Cont, typename P, typename I, typename S, typename Move,
+                CONCEPT_REQUIRES_(ReservableContainer<Cont>())>
+            range_iterator_t<Cont> insert_range(Cont &cont, P p, I i, S j, Move move)
+            {
+                auto const index = p - ranges::begin(cont);
+                adl_insert_detail::reserve_(cont, i, j, SizedIteratorRange<I, S>());
+                return adl_insert_detail::insert_range_(cont, ranges::begin(cont) + index, i, j,
+                    move);
+            }
+            template<typename Cont, typename P, typename I, typename S, typename Move,
+                typename C = common_iterator<I, S>,
+                CONCEPT_REQUIRES_(!ReservableContainer<Cont>())>
+            auto insert_range(Cont &cont, P p, I i, S j, Move move) ->
+                decltype(cont.insert(p, C{i}, C{j}))
+            {
+                return adl_insert_detail::insert_range_(cont, p, i, j, move);
+            }
+
             template<typename Cont, typename P, typename I, typename S,
                 typename C = common_iterator<I, S>,
                 CONCEPT_REQUIRES_(LvalueContainerLike<Cont>() && Iterator<P>() && IteratorRange<I, S>())>
             auto insert(Cont && cont, P p, I i, S j) ->
                 decltype(unwrap_reference(cont).insert(p, C{i}, C{j}))
             {
-                return unwrap_reference(cont).insert(p, C{i}, C{j});
+                return adl_insert_detail::insert_range(unwrap_reference(cont), p, i, j,
+                    std::false_type{});
             }
 
             template<typename Cont, typename I, typename Rng,
@@ -91,7 +148,9 @@ namespace ranges
             auto insert(Cont && cont, I p, Rng && rng) ->
                 decltype(unwrap_reference(cont).insert(p, C{begin(rng)}, C{end(rng)}))
             {
-                return unwrap_reference(cont).insert(p, C{begin(rng)}, C{end(rng)});
+                using Move = meta::and_<meta::not_<std::is_reference<Rng>>, Container<Rng>>;
+                return adl_insert_detail::insert_range(unwrap_reference(cont), p, begin(rng),
+                    end(rng), Move{});
             }
 
             struct insert_fn
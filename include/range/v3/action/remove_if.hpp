@@ -38,12 +38,11 @@ namespace ranges
             private:
                 friend action_access;
                 template<typename C, typename P = ident, CONCEPT_REQUIRES_(!Iterable<C>())>
-                static auto bind(remove_if_fn remove_if, C pred, P proj = P{})
-                RANGES_DECLTYPE_AUTO_RETURN
-                (
-                    std::bind(remove_if, std::placeholders::_1, protect(std::move(pred)),
-                        protect(std::move(proj)))
-                )
+                static bound_action<remove_if_fn, C, P>
+                bind(remove_if_fn remove_if, C pred, P proj = P{})
+                {
+                    return bind_action(remove_if, std::move(pred), std::move(proj));
+                }
             public:
                 struct ConceptImpl
                 {
@@ -14,8 +14,15 @@
 #ifndef RANGES_V3_ACTION_SPLIT_HPP
 #define RANGES_V3_ACTION_SPLIT_HPP
 
+#include <vector>
+#include <utility>
+#include <iterator>
 #include <functional>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/range_concepts.hpp>
 #include <range/v3/to_container.hpp>
 #include <range/v3/action/action.hpp>
 #include <range/v3/action/concepts.hpp>
@@ -23,6 +30,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/transform.hpp>
 
@@ -32,40 +40,282 @@ namespace ranges
     {
         /// \addtogroup group-actions
         /// @{
+
+        /// The result of `action::split_offsets`: a random-access range, plus one
+        /// array holding the begin and end offsets of each piece. An rvalue
+        /// container is moved in and owned; anything else is referred to. The
+        /// table is a random-access range whose elements are the pieces, as
+        /// subranges of the source. Because pieces are stored as offsets, the
+        /// table stays valid when it is moved or copied.
+        template<typename Rng>
+        struct split_table
+          : range_facade<split_table<Rng>>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            using piece_t = std::pair<difference_type_, difference_type_>;
+            Rng rng_;
+            std::vector<piece_t> pieces_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t first_;
+                piece_t const *cur_;
+                range<iterator_t> current() const
+                {
+                    return {first_ + cur_->first, first_ + cur_->second};
+                }
+                void next()
+                {
+                    ++cur_;
+                }
+                void prev()
+                {
+                    --cur_;
+                }
+                void advance(difference_type_ n)
+                {
+                    cur_ += n;
+                }
+                difference_type_ distance_to(cursor const &that) const
+                {
+                    return that.cur_ - cur_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+            public:
+                cursor() = default;
+                cursor(iterator_t first, piece_t const *cur)
+                  : first_(first), cur_(cur)
+                {}
+            };
+            cursor<false> begin_cursor()
+            {
+                return {ranges::begin(rng_), pieces_.data()};
+            }
+            cursor<false> end_cursor()
+            {
+                return {ranges::begin(rng_), pieces_.data() + pieces_.size()};
+            }
+            CONCEPT_REQUIRES(RandomAccessIterable<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {ranges::begin(rng_), pieces_.data()};
+            }
+            CONCEPT_REQUIRES(RandomAccessIterable<Rng const>())
+            cursor<true> end_cursor() const
+            {
+                return {ranges::begin(rng_), pieces_.data() + pieces_.size()};
+            }
+
+            // Finds the pieces the way split_view does, recording their offsets.
+            template<typename Fun>
+            void scan(Fun &fun)
+            {
+                auto const first = ranges::begin(rng_);
+                auto const last = ranges::end(rng_);
+                auto cur = first;
+                bool zero = false;
+                if(cur != last)
+                {
+                    // For skipping an initial zero-length match
+                    auto p = fun(cur, last);
+                    zero = p.first && 0 == p.second;
+                }
+                while(cur != last)
+                {
+                    auto it = cur;
+                    if(zero)
+                        ++it;
+                    std::pair<bool, difference_type_> p{false, 0};
+                    for(; it != last; ++it)
+                        if((p = fun(it, last)).first)
+                            break;
+                    pieces_.emplace_back(cur - first, it - first);
+                    if(it == last)
+                        break;
+                    cur = it;
+                    advance(cur, p.second);
+                    zero = (0 == p.second);
+                }
+            }
+        public:
+            split_table() = default;
+            template<typename Fun>
+            split_table(Rng rng, Fun fun)
+              : rng_(std::move(rng)), pieces_{}
+            {
+                auto &&f = invokable(fun);
+                this->scan(f);
+            }
+            std::size_t size() const
+            {
+                return pieces_.size();
+            }
+            range<range_iterator_t<Rng>> operator[](std::size_t n)
+            {
+                RANGES_ASSERT(n < pieces_.size());
+                auto const first = ranges::begin(rng_);
+                return {first + pieces_[n].first, first + pieces_[n].second};
+            }
+            CONCEPT_REQUIRES(RandomAccessIterable<Rng const>())
+            range<range_iterator_t<Rng const>> operator[](std::size_t n) const
+            {
+                RANGES_ASSERT(n < pieces_.size());
+                auto const first = ranges::begin(rng_);
+                return {first + pieces_[n].first, first + pieces_[n].second};
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+            /// The pieces, copied into a vector of containers.
+            template<typename Cont, CONCEPT_REQUIRES_(ranges::Container<Cont>())>
+            operator std::vector<Cont>() const &
+            {
+                return split_table::to_vector_<Cont>(rng_, pieces_, std::false_type{});
+            }
+            /// \overload If the table owns its container, the elements are moved
+            /// out of it rather than copied.
+            template<typename Cont, CONCEPT_REQUIRES_(ranges::Container<Cont>())>
+            operator std::vector<Cont>() &&
+            {
+                return split_table::to_vector_<Cont>(rng_, pieces_, ranges::Container<Rng>{});
+            }
+        private:
+            template<typename Cont, typename BaseRng, typename Move>
+            static std::vector<Cont> to_vector_(BaseRng &rng, std::vector<piece_t> const &pieces,
+                Move move)
+            {
+                std::vector<Cont> result;
+                result.reserve(pieces.size());
+                auto const first = ranges::begin(rng);
+                for(auto const &piece : pieces)
+                    result.push_back(split_table::to_container_<Cont>(first + piece.first,
+                        first + piece.second, move));
+                return result;
+            }
+            template<typename Cont, typename I>
+            static Cont to_container_(I begin, I end, std::false_type)
+            {
+                return to_<Cont>(make_range(begin, end));
+            }
+            template<typename Cont, typename I>
+            static Cont to_container_(I begin, I end, std::true_type)
+            {
+                return Cont(std::make_move_iterator(begin), std::make_move_iterator(end));
+            }
+        };
+
+        // Copying a table copies its offsets, and its container if it owns one,
+        // so it is not a view.
+        template<typename Rng>
+        struct is_range<split_table<Rng>>
+          : std::false_type
+        {};
+
+        /// \cond
+        namespace detail
+        {
+            // An rvalue container is moved into the table; anything else is
+            // viewed.
+            template<typename Rng>
+            using split_table_owns = meta::and_<
+                meta::not_<std::is_reference<Rng>>,
+                ranges::Container<Rng>>;
+
+            template<typename Rng>
+            using split_table_t =
+                split_table<meta::if_<split_table_owns<Rng>, uncvref_t<Rng>, view::all_t<Rng>>>;
+
+            template<typename Rng>
+            uncvref_t<Rng> split_table_base(Rng && rng, std::true_type)
+            {
+                return std::move(rng);
+            }
+            template<typename Rng>
+            view::all_t<Rng> split_table_base(Rng && rng, std::false_type)
+            {
+                return view::all(std::forward<Rng>(rng));
+            }
+
+            template<typename Rng, typename Fun>
+            split_table_t<Rng> make_split_table(Rng && rng, Fun fun)
+            {
+                return split_table_t<Rng>{detail::split_table_base(std::forward<Rng>(rng),
+                    split_table_owns<Rng>{}), std::move(fun)};
+            }
+        }
+        /// \endcond
+
         namespace action
         {
             struct split_fn
             {
             private:
+                friend action_access;
+                template<typename T>
+                static auto bind(split_fn split, T && t)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::bind(split, std::placeholders::_1, bind_forward<T>(t))
+                )
                 template<typename Rng>
                 using split_value_t =
                     meta::if_c<
                         (bool) ranges::Container<Rng>(),
                         uncvref_t<Rng>,
                         std::vector<range_value_t<Rng>>>;
+
+                // Random-access ranges are scanned once into a table of offsets,
+                // from which the pieces are copied, or moved out of an rvalue
+                // container.
+                template<typename Rng, typename Fun>
+                static std::vector<split_value_t<Rng>> split_(Rng && rng, Fun fun, std::true_type)
+                {
+                    return detail::make_split_table(std::forward<Rng>(rng), std::move(fun));
+                }
+                template<typename Rng, typename Fun>
+                static std::vector<split_value_t<Rng>> split_(Rng && rng, Fun fun, std::false_type)
+                {
+                    return view::split(rng, std::move(fun))
+                         | view::transform(to_<split_value_t<Rng>>()) | to_vector;
+                }
             public:
-                // BUGBUG something is not right with the actions. It should be possible
-                // to move a container into a split and have elements moved into the result.
                 template<typename Rng, typename Fun,
                     CONCEPT_REQUIRES_(view::split_fn::FunctionConcept<Rng, Fun>())>
                 std::vector<split_value_t<Rng>> operator()(Rng && rng, Fun fun) const
                 {
-                    return view::split(rng, std::move(fun))
-                         | view::transform(to_<split_value_t<Rng>>()) | to_vector;
+                    return split_fn::split_(std::forward<Rng>(rng), std::move(fun),
+                        RandomAccessIterable<Rng>());
                 }
                 template<typename Rng,
                     CONCEPT_REQUIRES_(view::split_fn::ElementConcept<Rng>())>
                 std::vector<split_value_t<Rng>> operator()(Rng && rng, range_value_t<Rng> val) const
                 {
-                    return view::split(rng, std::move(val))
-                         | view::transform(to_<split_value_t<Rng>>()) | to_vector;
+                    return split_fn::split_(std::forward<Rng>(rng),
+                        view::split_fn::element_pred<Rng>{std::move(val)},
+                        RandomAccessIterable<Rng>());
                 }
                 template<typename Rng, typename Sub,
                     CONCEPT_REQUIRES_(view::split_fn::SubRangeConcept<Rng, Sub>())>
                 std::vector<split_value_t<Rng>> operator()(Rng && rng, Sub && sub) const
                 {
-                    return view::split(rng, std::forward<Sub>(sub))
-                         | view::transform(to_<split_value_t<Rng>>()) | to_vector;
+                    return split_fn::split_(std::forward<Rng>(rng),
+                        view::split_fn::subrange_pred<Rng, Sub>{std::forward<Sub>(sub)},
+                        RandomAccessIterable<Rng>());
                 }
 
             #ifndef RANGES_DOXYGEN_INVOKED
@@ -96,6 +346,54 @@ namespace ranges
             {
                 constexpr auto&& split = static_const<action<split_fn>>::value;
             }
+
+            /// Like `split`, but for random-access ranges only, and without copying
+            /// the pieces: the result is a `split_table` of offsets into the range.
+            /// An lvalue is referred to, so the table must not outlive it; an
+            /// rvalue container is moved into the table.
+            struct split_offsets_fn
+            {
+            private:
+                friend action_access;
+                template<typename T>
+                static auto bind(split_offsets_fn split_offsets, T && t)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    std::bind(split_offsets, std::placeholders::_1, bind_forward<T>(t))
+                )
+            public:
+                template<typename Rng, typename Fun,
+                    CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                        view::split_fn::FunctionConcept<Rng, Fun>())>
+                detail::split_table_t<Rng> operator()(Rng && rng, Fun fun) const
+                {
+                    return detail::make_split_table(std::forward<Rng>(rng), std::move(fun));
+                }
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                        view::split_fn::ElementConcept<Rng>())>
+                detail::split_table_t<Rng> operator()(Rng && rng, range_value_t<Rng> val) const
+                {
+                    return detail::make_split_table(std::forward<Rng>(rng),
+                        view::split_fn::element_pred<Rng>{std::move(val)});
+                }
+                template<typename Rng, typename Sub,
+                    CONCEPT_REQUIRES_(RandomAccessIterable<Rng>() &&
+                        view::split_fn::SubRangeConcept<Rng, Sub>())>
+                detail::split_table_t<Rng> operator()(Rng && rng, Sub && sub) const
+                {
+                    return detail::make_split_table(std::forward<Rng>(rng),
+                        view::split_fn::subrange_pred<Rng, Sub>{std::forward<Sub>(sub)});
+                }
+            };
+
+            /// \ingroup group-actions
+            /// \relates split_offsets_fn
+            /// \sa action
+            namespace
+            {
+                constexpr auto&& split_offsets = static_const<action<split_offsets_fn>>::value;
+            }
         }
         /// @}
     }
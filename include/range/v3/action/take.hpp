@@ -17,6 +17,7 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/drop.hpp>
 #include <range/v3/action/erase.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/functional.hpp>
@@ -37,11 +38,10 @@ namespace ranges
             private:
                 friend action_access;
                 template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
-                static auto bind(take_fn take, Int n)
-                RANGES_DECLTYPE_AUTO_RETURN
-                (
-                    std::bind(take, std::placeholders::_1, n)
-                )
+                static bound_action<take_fn, Int> bind(take_fn take, Int n)
+                {
+                    return bind_action(take, n);
+                }
             public:
                 struct ConceptImpl
                 {
@@ -95,6 +95,37 @@ namespace ranges
             {
                 constexpr auto&& take = static_const<action<take_fn>>::value;
             }
+
+            /// \cond
+            // drop then take keeps a single subrange. Erasing after it first means
+            // that only the kept elements are shifted down when the front goes.
+            template<typename Int0, typename Int1>
+            struct drop_take_action
+            {
+                Int0 drop_;
+                Int1 take_;
+                template<typename Rng, typename D = range_difference_t<Rng>,
+                    CONCEPT_REQUIRES_(drop_fn::Concept<Rng, D>() && take_fn::Concept<Rng, D>())>
+                Rng operator()(Rng && rng) const
+                {
+                    RANGES_ASSERT(drop_ >= 0 && take_ >= 0);
+                    auto it = begin(rng);
+                    D const dropped = static_cast<D>(drop_) -
+                        advance_bounded(it, static_cast<D>(drop_), end(rng));
+                    advance_bounded(it, static_cast<D>(take_), end(rng));
+                    ranges::action::erase(rng, it, end(rng));
+                    ranges::action::erase(rng, begin(rng), next(begin(rng), dropped));
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            template<typename Int0, typename Int1>
+            drop_take_action<Int0, Int1>
+            fuse_actions(bound_action<drop_fn, Int0> first, bound_action<take_fn, Int1> second)
+            {
+                return {std::get<0>(first.args_), std::get<0>(second.args_)};
+            }
+            /// \endcond
         }
         /// @}
     }
@@ -17,6 +17,8 @@
 #include <functional>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/action/action.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/action/remove_if.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
@@ -36,12 +38,11 @@ namespace ranges
             private:
                 friend action_access;
                 template<typename F, typename P = ident, CONCEPT_REQUIRES_(!Iterable<F>())>
-                static auto bind(transform_fn transform, F fun, P proj = P{})
-                RANGES_DECLTYPE_AUTO_RETURN
-                (
-                    std::bind(transform, std::placeholders::_1, protect(std::move(fun)),
-                        protect(std::move(proj)))
-                )
+                static bound_action<transform_fn, F, P>
+                bind(transform_fn transform, F fun, P proj = P{})
+                {
+                    return bind_action(transform, std::move(fun), std::move(proj));
+                }
             public:
                 struct ConceptImpl
                 {
@@ -97,6 +98,93 @@ namespace ranges
             {
                 constexpr auto&& transform = static_const<action<transform_fn>>::value;
             }
+
+            /// \cond
+            // remove_if then transform: each element that is kept is transformed
+            // as it moves to its new place, in a single pass.
+            template<typename C, typename P, typename F, typename PF>
+            struct remove_if_transform_action
+            {
+                C pred_;
+                P proj_;
+                F fun_;
+                PF fun_proj_;
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(remove_if_fn::Concept<Rng, C, P>() &&
+                        transform_fn::Concept<Rng, F, PF>())>
+                Rng operator()(Rng && rng) const
+                {
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    auto &&fun = invokable(fun_);
+                    auto &&fun_proj = invokable(fun_proj_);
+                    auto out = begin(rng);
+                    for(auto it = begin(rng), e = end(rng); it != e; ++it)
+                    {
+                        auto &&x = *it;
+                        if(!pred(proj(x)))
+                        {
+                            *out = fun(fun_proj(x));
+                            ++out;
+                        }
+                    }
+                    ranges::erase(rng, out, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            // transform then remove_if: each element is transformed in place and
+            // then tested, in a single pass.
+            template<typename F, typename PF, typename C, typename P>
+            struct transform_remove_if_action
+            {
+                F fun_;
+                PF fun_proj_;
+                C pred_;
+                P proj_;
+                template<typename Rng,
+                    CONCEPT_REQUIRES_(transform_fn::Concept<Rng, F, PF>() &&
+                        remove_if_fn::Concept<Rng, C, P>())>
+                Rng operator()(Rng && rng) const
+                {
+                    auto &&fun = invokable(fun_);
+                    auto &&fun_proj = invokable(fun_proj_);
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    auto out = begin(rng);
+                    for(auto it = begin(rng), e = end(rng); it != e; ++it)
+                    {
+                        *it = fun(fun_proj(*it));
+                        if(!pred(proj(*it)))
+                        {
+                            if(out != it)
+                                *out = iter_move(it);
+                            ++out;
+                        }
+                    }
+                    ranges::erase(rng, out, end(rng));
+                    return std::forward<Rng>(rng);
+                }
+            };
+
+            template<typename C, typename P, typename F, typename PF>
+            remove_if_transform_action<C, P, F, PF>
+            fuse_actions(bound_action<remove_if_fn, C, P> first,
+                bound_action<transform_fn, F, PF> second)
+            {
+                return {std::get<0>(std::move(first.args_)), std::get<1>(std::move(first.args_)),
+                    std::get<0>(std::move(second.args_)), std::get<1>(std::move(second.args_))};
+            }
+
+            template<typename F, typename PF, typename C, typename P>
+            transform_remove_if_action<F, PF, C, P>
+            fuse_actions(bound_action<transform_fn, F, PF> first,
+                bound_action<remove_if_fn, C, P> second)
+            {
+                return {std::get<0>(std::move(first.args_)), std::get<1>(std::move(first.args_)),
+                    std::get<0>(std::move(second.args_)), std::get<1>(std::move(second.args_))};
+            }
+            /// \endcond
         }
         /// @}
     }
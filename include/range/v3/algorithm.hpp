@@ -35,8 +35,10 @@
 #include <range/v3/algorithm/find_if.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 #include <range/v3/algorithm/generate.hpp>
 #include <range/v3/algorithm/generate_n.hpp>
+#include <range/v3/algorithm/group_by_key.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/algorithm/inplace_merge.hpp>
 #include <range/v3/algorithm/is_partitioned.hpp>
@@ -44,6 +46,7 @@
 #include <range/v3/algorithm/lower_bound.hpp>
 #include <range/v3/algorithm/max_element.hpp>
 #include <range/v3/algorithm/merge.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
 #include <range/v3/algorithm/merge_move.hpp>
 #include <range/v3/algorithm/min_element.hpp>
 #include <range/v3/algorithm/mismatch.hpp>
@@ -76,6 +79,7 @@
 #include <range/v3/algorithm/set_algorithm.hpp>
 #include <range/v3/algorithm/shuffle.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/sort_by_key.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
 #include <range/v3/algorithm/stable_sort.hpp>
 #include <range/v3/algorithm/swap_ranges.hpp>
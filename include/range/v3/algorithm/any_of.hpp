@@ -23,6 +23,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 
 namespace ranges
 {
@@ -32,6 +33,26 @@ namespace ranges
         /// @{
         struct any_of_fn
         {
+        private:
+            template<typename Rng, typename F, typename P>
+            bool range_(Rng &rng, F &pred, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+            template<typename Rng, typename F, typename P>
+            static bool range_(Rng &rng, F &pred, P &proj, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto &&ipred = invokable(pred);
+                auto &&iproj = invokable(proj);
+                bool found = false;
+                for_each_while(rng, [&](R r) -> bool
+                {
+                    return !(found = ipred(iproj(std::forward<R>(r))));
+                });
+                return found;
+            }
+        public:
             template<typename I, typename S, typename F, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokablePredicate<F, Project<I, P> >())>
@@ -52,7 +73,7 @@ namespace ranges
             bool
             operator()(Rng &&rng, F pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return this->range_(rng, pred, proj, detail::has_for_each_while<Rng>());
             }
         };
 
@@ -57,8 +57,10 @@ namespace ranges
                             dist = half;
                         }
                         else
-                            return {lower_bound_n(std::move(begin), half, val, std::ref(pred)),
-                                    upper_bound_n(next(middle), dist - half - 1, val, std::ref(pred))};
+                            return {lower_bound_n(std::move(begin), half, val, std::ref(pred),
+                                        std::ref(proj)),
+                                    upper_bound_n(next(middle), dist - half - 1, val, std::ref(pred),
+                                        std::ref(proj))};
                     }
                     return {begin, begin};
                 }
@@ -0,0 +1,67 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_AUX_GALLOP_N_HPP
+#define RANGES_V3_ALGORITHM_AUX_GALLOP_N_HPP
+
+#include <limits>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace aux
+        {
+            struct gallop_n_fn
+            {
+                /// Strides ahead from `begin`, doubling the stride each time, to
+                /// the first stride whose last element `stop` holds of. Returns
+                /// the start of that stride and the number of elements in it
+                /// before that last one, which is where a binary search for the
+                /// first element that `stop` holds of ends. This takes time
+                /// logarithmic in the distance to that element, so it can search
+                /// a range with no end. Once doubling the stride would overflow
+                /// the difference type, the stride stays as it is.
+                ///
+                /// \pre `stop` holds of some element at or after `begin`;
+                /// otherwise this never returns.
+                template<typename I, typename F>
+                std::pair<I, iterator_difference_t<I>> operator()(I begin, F stop) const
+                {
+                    using D = iterator_difference_t<I>;
+                    D stride = 1;
+                    while(true)
+                    {
+                        auto last = next(begin, stride - 1);
+                        if(stop(last))
+                            return {std::move(begin), stride - 1};
+                        begin = std::move(++last);
+                        if(stride <= std::numeric_limits<D>::max() / 2)
+                            stride *= 2;
+                    }
+                }
+            };
+
+            namespace
+            {
+                constexpr auto&& gallop_n = static_const<gallop_n_fn>::value;
+            }
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -13,6 +13,7 @@
 #ifndef RANGES_V3_ALGORITHM_AUX_LOWER_BOUND_N_HPP
 #define RANGES_V3_ALGORITHM_AUX_LOWER_BOUND_N_HPP
 
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
@@ -30,14 +31,30 @@ namespace ranges
         {
             struct lower_bound_n_fn
             {
-                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
-                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
-                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
-                    P proj_ = P{}) const
+            private:
+                // With random access, the search narrows without branching on the
+                // comparison, which the compiler turns into a conditional move. The
+                // unpredictable branch of the classic form costs more than the
+                // extra comparison or two this takes.
+                template<typename I, typename V2, typename C, typename P>
+                static RANGES_CXX14_CONSTEXPR I impl(I begin, iterator_difference_t<I> d, V2 const &val, C &pred,
+                    P &proj, std::true_type)
+                {
+                    while(d > 1)
+                    {
+                        auto const half = d / 2;
+                        I const middle = begin + half;
+                        begin = pred(proj(*middle), val) ? middle : begin;
+                        d -= half;
+                    }
+                    if(d != 0 && pred(proj(*begin), val))
+                        ++begin;
+                    return begin;
+                }
+                template<typename I, typename V2, typename C, typename P>
+                static RANGES_CXX14_CONSTEXPR I impl(I begin, iterator_difference_t<I> d, V2 const &val, C &pred,
+                    P &proj, std::false_type)
                 {
-                    RANGES_ASSERT(0 <= d);
-                    auto &&pred = invokable(pred_);
-                    auto &&proj = invokable(proj_);
                     while(0 != d)
                     {
                         auto half = d / 2;
@@ -52,6 +69,18 @@ namespace ranges
                     }
                     return begin;
                 }
+            public:
+                template<typename I, typename V2, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
+                RANGES_CXX14_CONSTEXPR I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                    P proj_ = P{}) const
+                {
+                    RANGES_ASSERT(0 <= d);
+                    auto &&pred = invokable(pred_);
+                    auto &&proj = invokable(proj_);
+                    return lower_bound_n_fn::impl(std::move(begin), d, val, pred, proj,
+                        RandomAccessIterator<I>());
+                }
             };
 
             namespace
@@ -37,7 +37,7 @@ namespace ranges
                 /// \pre `Rng` is a model of the `Iterable` concept
                 template<typename I, typename V2, typename C = ordered_less, typename P = ident,
                     CONCEPT_REQUIRES_(BinarySearchable<I, V2, C, P>())>
-                I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
+                RANGES_CXX14_CONSTEXPR I operator()(I begin, iterator_difference_t<I> d, V2 const &val, C pred_ = C{},
                     P proj_ = P{}) const
                 {
                     RANGES_ASSERT(0 <= d);
@@ -24,6 +24,7 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/copy.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 
 namespace ranges
 {
@@ -33,6 +34,25 @@ namespace ranges
         /// @{
         struct copy_fn : aux::copy_fn
         {
+        private:
+            template<typename Rng, typename O>
+            RANGES_CXX14_CONSTEXPR std::pair<range_iterator_t<Rng>, O> range_(Rng &rng, O &out, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(out));
+            }
+            template<typename Rng, typename O>
+            static std::pair<range_iterator_t<Rng>, O> range_(Rng &rng, O &out, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto it = for_each_while(rng, [&](R r) -> bool
+                {
+                    *out = std::forward<R>(r);
+                    ++out;
+                    return true;
+                });
+                return {std::move(it), std::move(out)};
+            }
+        public:
             using aux::copy_fn::operator();
 
             template<typename I, typename S, typename O,
@@ -41,7 +61,7 @@ namespace ranges
                     WeaklyIncrementable<O>() &&
                     IndirectlyCopyable<I, O>()
                 )>
-            std::pair<I, O>
+            RANGES_CXX14_CONSTEXPR std::pair<I, O>
             operator()(I begin, S end, O out) const
             {
                 for(; begin != end; ++begin, ++out)
@@ -56,10 +76,10 @@ namespace ranges
                     WeaklyIncrementable<O>() &&
                     IndirectlyCopyable<I, O>()
                 )>
-            std::pair<I, O>
+            RANGES_CXX14_CONSTEXPR std::pair<I, O>
             operator()(Rng &rng, O out) const
             {
-                return (*this)(begin(rng), end(rng), std::move(out));
+                return this->range_(rng, out, detail::has_for_each_while<Rng>());
             }
         };
 
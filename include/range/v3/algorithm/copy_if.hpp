@@ -23,6 +23,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -62,6 +63,15 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/copy_if.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_copy_if(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `copy_if_fn`
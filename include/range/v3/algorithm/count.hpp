@@ -14,11 +14,14 @@
 #define RANGES_V3_ALGORITHM_COUNT_HPP
 
 #include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/integral_iota.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -27,10 +30,35 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename V, typename P>
+            using iota_countable = meta::and_c<
+                is_integral_iota<Rng>::value,
+                std::is_same<V, range_value_t<Rng>>::value,
+                std::is_same<P, ident>::value>;
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
         struct count_fn
         {
+        private:
+            template<typename Rng, typename V, typename P>
+            range_difference_t<Rng> range_(Rng &rng, V const &val, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), val, std::move(proj));
+            }
+            // The integers of a view::iota or view::ints are distinct, so a value
+            // is in one or none of its positions.
+            template<typename Rng, typename V, typename P>
+            static range_difference_t<Rng> range_(Rng &rng, V const &val, P &, std::true_type)
+            {
+                return detail::iota_contains(*begin(rng), distance(rng), val) ? 1 : 0;
+            }
+        public:
             template<typename I, typename S, typename V, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
@@ -52,7 +80,8 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, V const & val, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), val, std::move(proj));
+                return this->range_(rng, val, proj,
+                    detail::iota_countable<uncvref_t<Rng>, V, P>());
             }
         };
 
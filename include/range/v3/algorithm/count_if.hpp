@@ -22,6 +22,8 @@
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -31,6 +33,29 @@ namespace ranges
         /// @{
         struct count_if_fn
         {
+        private:
+            template<typename Rng, typename R, typename P>
+            range_difference_t<Rng> range_(Rng &rng, R &pred, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+            template<typename Rng, typename R, typename P>
+            static range_difference_t<Rng> range_(Rng &rng, R &pred_, P &proj_, std::true_type)
+            {
+                using Ref = range_reference_t<Rng>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                range_difference_t<Rng> n = 0;
+                for_each_while(rng, [&](Ref r) -> bool
+                {
+                    if(pred(proj(std::forward<Ref>(r))))
+                        ++n;
+                    return true;
+                });
+                return n;
+            }
+
+        public:
             template<typename I, typename S, typename R, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokablePredicate<R, Project<I, P> >())>
@@ -52,8 +77,17 @@ namespace ranges
             iterator_difference_t<I>
             operator()(Rng &&rng, R pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return this->range_(rng, pred, proj, detail::has_for_each_while<Rng>());
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/count_if.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_count_if(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `count_if_fn`
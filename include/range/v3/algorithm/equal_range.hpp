@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_EQUAL_RANGE_HPP
 #define RANGES_V3_ALGORITHM_EQUAL_RANGE_HPP
 
+#include <functional>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
@@ -21,6 +23,7 @@
 #include <range/v3/range.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/algorithm/aux_/equal_range_n.hpp>
+#include <range/v3/algorithm/aux_/gallop_n.hpp>
 #include <range/v3/utility/static_const.hpp>
 
 namespace ranges
@@ -31,6 +34,38 @@ namespace ranges
         /// @{
         struct equal_range_fn
         {
+        private:
+            template<typename Rng, typename V, typename C, typename P>
+            static range<range_iterator_t<Rng>> range_(Rng &rng, V const &val, C &pred, P &proj,
+                std::false_type)
+            {
+                return aux::equal_range_n(begin(rng), distance(rng), val, std::move(pred),
+                    std::move(proj));
+            }
+            // As for lower_bound, an infinite range is searched by galloping:
+            // first to the lower bound, and then on from there to the upper one.
+            template<typename Rng, typename V, typename C, typename P>
+            static range<range_iterator_t<Rng>> range_(Rng &rng, V const &val, C &pred_,
+                P &proj_, std::true_type)
+            {
+                using I = range_iterator_t<Rng>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto stride = aux::gallop_n(begin(rng), [&](I const &it)
+                {
+                    return !pred(proj(*it), val);
+                });
+                I lower = aux::lower_bound_n(std::move(stride.first), stride.second, val,
+                    std::ref(pred), std::ref(proj));
+                stride = aux::gallop_n(lower, [&](I const &it)
+                {
+                    return pred(val, proj(*it));
+                });
+                I upper = aux::upper_bound_n(std::move(stride.first), stride.second, val,
+                    std::ref(pred), std::ref(proj));
+                return {std::move(lower), std::move(upper)};
+            }
+        public:
             template<typename I, typename S, typename V, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && BinarySearchable<I, V, C, P>())>
             range<I>
@@ -40,15 +75,15 @@ namespace ranges
                     std::move(proj));
             }
 
+            /// \pre If `rng` is infinite, `val` is less than some element of it;
+            /// otherwise the search never ends.
             template<typename Rng, typename V, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng &>() && BinarySearchable<I, V, C, P>())>
             range<I>
             operator()(Rng & rng, V const & val, C pred = C{}, P proj = P{}) const
             {
-                static_assert(!is_infinite<Rng>::value, "Trying to binary search an infinite range");
-                return aux::equal_range_n(begin(rng), distance(rng), val, std::move(pred),
-                    std::move(proj));
+                return equal_range_fn::range_(rng, val, pred, proj, is_infinite<Rng>());
             }
         };
 
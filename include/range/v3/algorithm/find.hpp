@@ -43,7 +43,7 @@ namespace ranges
             template<typename I, typename S, typename V, typename P = ident,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() &&
                     IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
-            I operator()(I begin, S end, V const &val, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(I begin, S end, V const &val, P proj_ = P{}) const
             {
                 auto &&proj = invokable(proj_);
                 for(; begin != end; ++begin)
@@ -57,7 +57,7 @@ namespace ranges
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(InputIterable<Rng &>() &&
                     IndirectInvokableRelation<equal_to, Project<I, P>, V const *>())>
-            I operator()(Rng &rng, V const &val, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(Rng &rng, V const &val, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), val, std::move(proj));
             }
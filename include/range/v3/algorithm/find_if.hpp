@@ -22,6 +22,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 
 namespace ranges
 {
@@ -31,6 +32,24 @@ namespace ranges
         /// @{
         struct find_if_fn
         {
+        private:
+            template<typename Rng, typename F, typename P>
+            range_iterator_t<Rng> range_(Rng &rng, F &pred, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+            }
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> range_(Rng &rng, F &pred_, P &proj_, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return for_each_while(rng, [&](R r) -> bool
+                {
+                    return !pred(proj(std::forward<R>(r)));
+                });
+            }
+        public:
             /// \brief template function \c find_fn::operator()
             ///
             /// range-based version of the \c find std algorithm
@@ -61,7 +80,7 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputIterable<Rng &>() && IndirectInvokablePredicate<F, Project<I, P> >())>
             I operator()(Rng &rng, F pred, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
+                return this->range_(rng, pred, proj, detail::has_for_each_while<Rng>());
             }
         };
 
@@ -15,12 +15,15 @@
 
 #include <functional>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -30,6 +33,25 @@ namespace ranges
         /// @{
         struct for_each_fn
         {
+        private:
+            template<typename Rng, typename F, typename P>
+            range_iterator_t<Rng> range_(Rng &rng, F &fun, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(fun), std::move(proj));
+            }
+            template<typename Rng, typename F, typename P>
+            static range_iterator_t<Rng> range_(Rng &rng, F &fun_, P &proj_, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                return for_each_while(rng, [&](R r) -> bool
+                {
+                    fun(proj(std::forward<R>(r)));
+                    return true;
+                });
+            }
+        public:
             template<typename I, typename S, typename F, typename P = ident,
                 typename V = iterator_common_reference_t<I>,
                 typename X = concepts::Invokable::result_t<P, V>,
@@ -51,8 +73,19 @@ namespace ranges
                 CONCEPT_REQUIRES_(InputIterable<Rng &>() && IndirectInvokable<F, Project<I, P>>())>
             I operator()(Rng &rng, F fun, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(fun), std::move(proj));
+                return this->range_(rng, fun, proj, detail::has_for_each_while<Rng>());
             }
+
+            // Execution policy variants, defined in
+            // range/v3/execution/algorithm/for_each.hpp and found by ADL on the
+            // policy, so that serial callers do not pay for the thread pool.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_for_each(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `for_each_fn`
@@ -0,0 +1,112 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_FOR_EACH_WHILE_HPP
+#define RANGES_V3_ALGORITHM_FOR_EACH_WHILE_HPP
+
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_access.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            struct push_probe
+            {
+                template<typename T>
+                bool operator()(T &&) const;
+            };
+
+            // Whether a range loops over its elements itself, with a member
+            // for_each_while.
+            template<typename Rng, typename Enable = void>
+            struct has_for_each_while
+              : std::false_type
+            {};
+
+            template<typename Rng>
+            struct has_for_each_while<Rng, void_t<decltype(
+                range_access::for_each_while(std::declval<Rng &>(), std::declval<push_probe &>()))>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Calls \p fun with each element of the range in turn, until it returns
+        /// false, and returns the position of the element for which it did, or
+        /// the end. A view can loop over its elements itself, by defining a
+        /// private member `for_each_while(F &fun)` with these semantics that
+        /// passes each element to \p fun as an expression of the view's
+        /// reference type. Views that do so push their base's elements through
+        /// their own loop, so that a pipeline of them runs as nested plain loops
+        /// instead of one iterator whose increment and comparison go through
+        /// every layer. Other ranges are iterated as usual. The algorithms that
+        /// visit the elements in order without needing iterators to them, such as
+        /// `for_each`, `accumulate`, `count_if`, `any_of`, `find_if` and `copy`,
+        /// use this for ranges that define the member.
+        struct for_each_while_fn
+        {
+        private:
+            template<typename Rng, typename F>
+            static auto impl_(Rng &rng, F &fun, int)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                range_access::for_each_while(rng, fun)
+            )
+            template<typename Rng, typename F>
+            static range_iterator_t<Rng> impl_(Rng &rng, F &fun, long)
+            {
+                auto begin = ranges::begin(rng);
+                auto end = ranges::end(rng);
+                for(; begin != end; ++begin)
+                    if(!fun(*begin))
+                        break;
+                return begin;
+            }
+        public:
+            template<typename Rng, typename F,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(InputIterable<Rng &>() && IndirectInvokablePredicate<F, I>())>
+            I operator()(Rng &rng, F fun_) const
+            {
+                auto &&fun = invokable(fun_);
+                return for_each_while_fn::impl_(rng, fun, 42);
+            }
+        };
+
+        /// \sa `for_each_while_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& for_each_while = static_const<for_each_while_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
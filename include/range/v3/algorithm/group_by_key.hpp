@@ -0,0 +1,159 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_GROUP_BY_KEY_HPP
+#define RANGES_V3_ALGORITHM_GROUP_BY_KEY_HPP
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_index.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename K>
+            using group_key_t =
+                decay_t<concepts::Invokable::result_t<K, range_reference_t<Rng>>>;
+        }
+        /// \endcond
+
+        template<typename Rng, typename K, typename R, typename H,
+            typename Ref = range_reference_t<Rng>,
+            typename V = range_value_t<Rng>,
+            typename Key = detail::group_key_t<Rng, K>>
+        using GroupReducible = meta::fast_and<
+            InputIterable<Rng>,
+            Invokable<K, Ref>,
+            Constructible<V, Ref>,
+            Invokable<R, V, Ref>,
+            Assignable<V &, concepts::Invokable::result_t<R, V, Ref>>,
+            Function<H, Key const &>>;
+
+        template<typename Rng, typename K, typename T, typename R, typename H,
+            typename Ref = range_reference_t<Rng>,
+            typename Key = detail::group_key_t<Rng, K>>
+        using GroupFoldable = meta::fast_and<
+            InputIterable<Rng>,
+            Invokable<K, Ref>,
+            CopyConstructible<T>,
+            Invokable<R, T, Ref>,
+            Assignable<T &, concepts::Invokable::result_t<R, T, Ref>>,
+            Function<H, Key const &>>;
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Reduces the elements of a range that share a key, in a single pass
+        /// over the range, and returns one `(key, aggregate)` pair per distinct
+        /// key, in the order the keys were first seen. The keys are found through
+        /// a hash table that indexes the result, so no intermediate map is built.
+        struct group_by_key_fn
+        {
+        private:
+            template<typename Key, typename Agg, typename H>
+            static std::vector<std::pair<Key, Agg>>
+            finish_(detail::hash_index<Key, H> &index, std::vector<Agg> &aggs)
+            {
+                std::vector<std::pair<Key, Agg>> result;
+                result.reserve(aggs.size());
+                auto &keys = index.keys();
+                for(std::size_t i = 0; i != aggs.size(); ++i)
+                    result.emplace_back(std::move(keys[i]), std::move(aggs[i]));
+                return result;
+            }
+            template<typename Index, typename Agg, typename Rng>
+            static void reserve_(Index &index, std::vector<Agg> &aggs, Rng &rng, std::true_type)
+            {
+                auto const n = static_cast<std::size_t>(ranges::size(rng));
+                index.reserve(n);
+                aggs.reserve(n);
+            }
+            template<typename Index, typename Agg, typename Rng>
+            static void reserve_(Index &, std::vector<Agg> &, Rng &, std::false_type)
+            {}
+        public:
+            /// The first element with each key starts that key's aggregate, and
+            /// each later one is folded in with `acc = reduce(std::move(acc), elem)`.
+            template<typename Rng, typename K, typename R,
+                typename H = std::hash<detail::group_key_t<Rng, K>>,
+                typename Key = detail::group_key_t<Rng, K>,
+                typename V = range_value_t<Rng>,
+                CONCEPT_REQUIRES_(GroupReducible<Rng, K, R, H>())>
+            std::vector<std::pair<Key, V>>
+            operator()(Rng && rng, K key_proj_, R reduce_, H hash = H{}) const
+            {
+                auto &&key_proj = invokable(key_proj_);
+                auto &&reduce = invokable(reduce_);
+                detail::hash_index<Key, H> index{std::move(hash)};
+                std::vector<V> aggs;
+                group_by_key_fn::reserve_(index, aggs, rng, SizedIterable<Rng>());
+                for(auto begin = ranges::begin(rng), end = ranges::end(rng); begin != end; ++begin)
+                {
+                    auto &&elem = *begin;
+                    auto const i = index.insert(key_proj(elem));
+                    if(i.second)
+                        aggs.emplace_back(elem);
+                    else
+                        aggs[i.first] = reduce(std::move(aggs[i.first]), elem);
+                }
+                return group_by_key_fn::finish_(index, aggs);
+            }
+            /// \overload Each key's aggregate starts as a copy of \p init.
+            template<typename Rng, typename K, typename T, typename R,
+                typename H = std::hash<detail::group_key_t<Rng, K>>,
+                typename Key = detail::group_key_t<Rng, K>,
+                CONCEPT_REQUIRES_(GroupFoldable<Rng, K, T, R, H>())>
+            std::vector<std::pair<Key, T>>
+            operator()(Rng && rng, K key_proj_, T init, R reduce_, H hash = H{}) const
+            {
+                auto &&key_proj = invokable(key_proj_);
+                auto &&reduce = invokable(reduce_);
+                detail::hash_index<Key, H> index{std::move(hash)};
+                std::vector<T> aggs;
+                group_by_key_fn::reserve_(index, aggs, rng, SizedIterable<Rng>());
+                for(auto begin = ranges::begin(rng), end = ranges::end(rng); begin != end; ++begin)
+                {
+                    auto &&elem = *begin;
+                    auto const i = index.insert(key_proj(elem));
+                    if(i.second)
+                        aggs.push_back(reduce(T(init), elem));
+                    else
+                        aggs[i.first] = reduce(std::move(aggs[i.first]), elem);
+                }
+                return group_by_key_fn::finish_(index, aggs);
+            }
+        };
+
+        /// \sa `group_by_key_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& group_by_key = static_const<group_by_key_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -42,7 +42,7 @@ namespace ranges
             template<typename I, typename S, typename R = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(ForwardIterator<I>() && IteratorRange<I, S>() &&
                        IndirectInvokableRelation<R, Project<I, P>>())>
-            bool operator()(I begin, S end, R rel = R{}, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR bool operator()(I begin, S end, R rel = R{}, P proj_ = P{}) const
             {
                 return is_sorted_until(std::move(begin), end, std::move(rel),
                                        std::move(proj_)) == end;
@@ -52,7 +52,7 @@ namespace ranges
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(ForwardIterable<Rng>() &&
                     IndirectInvokableRelation<R, Project<I, P>>())>
-            bool operator()(Rng &&rng, R rel = R{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR bool operator()(Rng &&rng, R rel = R{}, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(rel), std::move(proj));
             }
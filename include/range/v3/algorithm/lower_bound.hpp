@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_LOWER_BOUND_HPP
 #define RANGES_V3_ALGORITHM_LOWER_BOUND_HPP
 
+#include <functional>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
@@ -20,6 +22,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/gallop_n.hpp>
 #include <range/v3/algorithm/aux_/lower_bound_n.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -31,22 +34,49 @@ namespace ranges
         /// @{
         struct lower_bound_fn
         {
+        private:
+            template<typename Rng, typename V, typename C, typename P>
+            static RANGES_CXX14_CONSTEXPR range_iterator_t<Rng> range_(Rng &rng, V const &val, C &pred, P &proj,
+                std::false_type)
+            {
+                return aux::lower_bound_n(begin(rng), distance(rng), val, std::move(pred),
+                    std::move(proj));
+            }
+            // An infinite range has no end to search up to, so the search
+            // gallops ahead to the first element that is not less than val, and
+            // then searches the last stride. This makes it a search over an
+            // unbounded view::iota | view::transform(f) for a monotone f.
+            template<typename Rng, typename V, typename C, typename P>
+            static range_iterator_t<Rng> range_(Rng &rng, V const &val, C &pred_, P &proj_,
+                std::true_type)
+            {
+                using I = range_iterator_t<Rng>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto stride = aux::gallop_n(begin(rng), [&](I const &it)
+                {
+                    return !pred(proj(*it), val);
+                });
+                return aux::lower_bound_n(std::move(stride.first), stride.second, val,
+                    std::ref(pred), std::ref(proj));
+            }
+        public:
             template<typename I, typename S, typename V, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && BinarySearchable<I, V, C, P>())>
-            I operator()(I begin, S end, V const &val, C pred = C{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(I begin, S end, V const &val, C pred = C{}, P proj = P{}) const
             {
                 return aux::lower_bound_n(std::move(begin), distance(begin, end), val, std::move(pred),
                     std::move(proj));
             }
 
+            /// \pre If `rng` is infinite, some element of it is not less than
+            /// `val`; otherwise the search never ends.
             template<typename Rng, typename V, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng &>() && BinarySearchable<I, V, C, P>())>
-            I operator()(Rng &rng, V const &val, C pred = C{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(Rng &rng, V const &val, C pred = C{}, P proj = P{}) const
             {
-                static_assert(!is_infinite<Rng>::value, "Trying to binary search an infinite range");
-                return aux::lower_bound_n(begin(rng), distance(rng), val, std::move(pred),
-                    std::move(proj));
+                return lower_bound_fn::range_(rng, val, pred, proj, is_infinite<Rng>());
             }
         };
 
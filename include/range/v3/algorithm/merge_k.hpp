@@ -0,0 +1,91 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_MERGE_K_HPP
+#define RANGES_V3_ALGORITHM_MERGE_K_HPP
+
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/loser_tree.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// A range of sorted ranges that can be merged into \p O, ordered by \p C
+        /// on the projection \p P. The inner ranges must be lvalues, since the
+        /// merge keeps iterators into them.
+        template<typename Rngs, typename O, typename C = ordered_less, typename P = ident,
+            typename Rng = meta::eval<std::remove_reference<range_reference_t<Rngs>>>,
+            typename I = range_iterator_t<Rng>>
+        using KMergeable = meta::fast_and<
+            InputIterable<Rngs>,
+            std::is_lvalue_reference<range_reference_t<Rngs>>,
+            InputIterable<Rng>,
+            WeaklyIncrementable<O>,
+            IndirectInvokableRelation<C, Project<I, P>, Project<I, P>>,
+            IndirectlyCopyable<I, O>>;
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Merges any number of sorted ranges into one sorted sequence, in a
+        /// single pass. The heads of the ranges play a tournament in a loser
+        /// tree, so each element costs log2(k) comparisons for k ranges and is
+        /// copied once, where a tree of pairwise merges copies it log2(k)
+        /// times. The merge is stable: of equivalent elements, those from
+        /// earlier ranges come first. Once only one range is left, the rest of
+        /// it is copied directly.
+        struct merge_k_fn
+        {
+            template<typename Rngs, typename O, typename C = ordered_less, typename P = ident,
+                typename Rng = meta::eval<std::remove_reference<range_reference_t<Rngs>>>,
+                CONCEPT_REQUIRES_(KMergeable<Rngs, O, C, P>())>
+            O operator()(Rngs && rngs, O out, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                detail::loser_tree<range_iterator_t<Rng>, range_sentinel_t<Rng>> tree;
+                for(auto &&rng : rngs)
+                    tree.add(begin(rng), end(rng));
+                tree.build(pred, proj);
+                for(; tree.active() > 1; ++out)
+                {
+                    *out = *tree.top();
+                    tree.pop(pred, proj);
+                }
+                if(!tree.empty())
+                    out = copy(tree.top(), tree.top_end(), std::move(out)).second;
+                return out;
+            }
+        };
+
+        /// \sa `merge_k_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& merge_k = static_const<merge_k_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
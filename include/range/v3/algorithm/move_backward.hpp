@@ -35,7 +35,7 @@ namespace ranges
             template<typename I, typename S, typename O,
                 CONCEPT_REQUIRES_(BidirectionalIterator<I>() && IteratorRange<I, S>() &&
                     BidirectionalIterator<O>() && IndirectlyMovable<I, O>())>
-            std::pair<I, O> operator()(I begin, S end_, O out) const
+            RANGES_CXX14_CONSTEXPR std::pair<I, O> operator()(I begin, S end_, O out) const
             {
                 I i = next_to(begin, end_), end = i;
                 while(begin != i)
@@ -47,7 +47,7 @@ namespace ranges
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(BidirectionalIterable<Rng &>() && BidirectionalIterator<O>() &&
                     IndirectlyMovable<I, O>())>
-            std::pair<I, O> operator()(Rng &rng, O out) const
+            RANGES_CXX14_CONSTEXPR std::pair<I, O> operator()(Rng &rng, O out) const
             {
                 return (*this)(begin(rng), end(rng), std::move(out));
             }
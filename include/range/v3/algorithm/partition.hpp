@@ -30,6 +30,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/swap.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -113,6 +114,15 @@ namespace ranges
                 return partition_fn::impl(begin(rng), end(rng), std::move(pred),
                     std::move(proj), iterator_concept<I>());
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/partition.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_partition(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `partition_fn`
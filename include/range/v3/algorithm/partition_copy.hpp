@@ -24,6 +24,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -74,6 +75,15 @@ namespace ranges
                 return (*this)(begin(rng), end(rng), std::move(o0), std::move(o1), std::move(pred),
                     std::move(proj));
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/partition_copy.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_partition_copy(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `partition_copy_fn`
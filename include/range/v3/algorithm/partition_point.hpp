@@ -51,7 +51,7 @@ namespace ranges
         {
             template<typename I, typename S, typename C, typename P = ident,
                 CONCEPT_REQUIRES_(PartitionPointable<I, C, P>() && IteratorRange<I, S>())>
-            I operator()(I begin, S end, C pred_, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(I begin, S end, C pred_, P proj_ = P{}) const
             {
                 auto && pred = invokable(pred_);
                 auto && proj = invokable(proj_);
@@ -74,7 +74,7 @@ namespace ranges
             template<typename Rng, typename C, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(PartitionPointable<I, C, P>() && Iterable<Rng &>())>
-            I operator()(Rng &rng, C pred, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(Rng &rng, C pred, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
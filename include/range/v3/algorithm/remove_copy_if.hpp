@@ -21,6 +21,7 @@
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -63,6 +64,15 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(pred), std::move(proj));
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/remove_copy_if.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_remove_copy_if(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `remove_copy_if_fn`
@@ -48,6 +48,7 @@
 #include <range/v3/algorithm/partial_sort.hpp>
 #include <range/v3/algorithm/heap_algorithm.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -56,26 +57,8 @@ namespace ranges
         /// \cond
         namespace detail
         {
-            template<typename Val, typename C>
-            inline Val const &median(Val const &a, Val const &b, Val const &c, C &pred)
-            {
-                if(pred(a, b))
-                    if(pred(b, c))
-                        return b;
-                    else if(pred(a, c))
-                        return c;
-                    else
-                        return a;
-                else if(pred(a, c))
-                    return a;
-                else if(pred(b, c))
-                    return c;
-                else
-                    return b;
-            }
-
             template<typename I, typename Val, typename C, typename P>
-            inline I unguarded_partition(I begin, I end, Val const &pivot, C &pred, P &proj)
+            RANGES_CXX14_CONSTEXPR I unguarded_partition(I begin, I end, Val const &pivot, C &pred, P &proj)
             {
                 while(true)
                 {
@@ -92,7 +75,7 @@ namespace ranges
             }
 
             template<typename I, typename C, typename P>
-            inline void unguarded_linear_insert(I end, iterator_value_t<I> val, C &pred, P &proj)
+            RANGES_CXX14_CONSTEXPR void unguarded_linear_insert(I end, iterator_value_t<I> val, C &pred, P &proj)
             {
                 I next = prev(end);
                 while(pred(proj(val), proj(*next)))
@@ -105,7 +88,7 @@ namespace ranges
             }
 
             template<typename I, typename C, typename P>
-            inline void linear_insert(I begin, I end, C &pred, P &proj)
+            RANGES_CXX14_CONSTEXPR void linear_insert(I begin, I end, C &pred, P &proj)
             {
                 iterator_value_t<I> val = iter_move(end);
                 if(pred(proj(val), proj(*begin)))
@@ -118,7 +101,7 @@ namespace ranges
             }
 
             template<typename I, typename C, typename P>
-            inline void insertion_sort(I begin, I end, C &pred, P &proj)
+            RANGES_CXX14_CONSTEXPR void insertion_sort(I begin, I end, C &pred, P &proj)
             {
                 if(begin == end)
                     return;
@@ -127,7 +110,7 @@ namespace ranges
             }
 
             template<typename I, typename C, typename P>
-            inline void unguarded_insertion_sort(I begin, I end, C &pred, P &proj)
+            RANGES_CXX14_CONSTEXPR void unguarded_insertion_sort(I begin, I end, C &pred, P &proj)
             {
                 for(I i = begin; i != end; ++i)
                     detail::unguarded_linear_insert(i, iter_move(i), pred, proj);
@@ -135,6 +118,16 @@ namespace ranges
         }
         /// \endcond
 
+        /// \cond
+        namespace execution
+        {
+            namespace detail
+            {
+                struct parallel_sort;
+            }
+        }
+        /// \endcond
+
         /// \addtogroup group-algorithms
         /// @{
 
@@ -144,10 +137,12 @@ namespace ranges
         struct sort_fn
         {
         private:
+            friend struct execution::detail::parallel_sort;
+
             static constexpr int introsort_threshold() { return 16; }
 
             template<typename I, typename C, typename P>
-            static void final_insertion_sort(I begin, I end, C &pred, P &proj)
+            static RANGES_CXX14_CONSTEXPR void final_insertion_sort(I begin, I end, C &pred, P &proj)
             {
                 if(end - begin > sort_fn::introsort_threshold())
                 {
@@ -159,7 +154,7 @@ namespace ranges
             }
 
             template<typename Size>
-            static Size log2(Size n)
+            static RANGES_CXX14_CONSTEXPR Size log2(Size n)
             {
                 Size k = 0;
                 for(; n != 1; n >>= 1)
@@ -168,26 +163,42 @@ namespace ranges
             }
 
             template<typename I, typename Size, typename C, typename P>
-            static void introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
+            static RANGES_CXX14_CONSTEXPR void introsort_loop(I begin, I end, Size depth_limit, C &pred, P &proj)
             {
                 while(end - begin > sort_fn::introsort_threshold())
                 {
                     if(depth_limit == 0)
                         return partial_sort(begin, end, end, std::ref(pred), std::ref(proj)), void();
-                    I cut = detail::unguarded_partition(begin, end,
-                        detail::median(proj(*begin), proj(*(begin + (end - begin) / 2)),
-                            proj(*(end - 1)), pred),
-                        pred, proj);
-                    sort_fn::introsort_loop(cut, end, depth_limit - 1, pred, proj);
-                    end = cut;
+                    --depth_limit;
+                    // The pivot is parked at the front while partitioning; a
+                    // reference to it in the middle of the range would see it
+                    // swapped away mid-partition. It is the median of the second,
+                    // middle and last elements: were the first one a candidate,
+                    // parking the median would move it to the middle, where on
+                    // reversed input it makes every later partition lopsided.
+                    ranges::iter_swap(begin, sort_fn::median_of_three(next(begin),
+                        begin + (end - begin) / 2, end - 1, pred, proj));
+                    I cut = detail::unguarded_partition(next(begin), end, proj(*begin), pred,
+                        proj);
+                    ranges::iter_swap(begin, prev(cut));
+                    sort_fn::introsort_loop(cut, end, depth_limit, pred, proj);
+                    end = prev(cut);
                 }
             }
 
+            template<typename I, typename C, typename P>
+            static RANGES_CXX14_CONSTEXPR I median_of_three(I a, I b, I c, C &pred, P &proj)
+            {
+                if(pred(proj(*a), proj(*b)))
+                    return pred(proj(*b), proj(*c)) ? b : pred(proj(*a), proj(*c)) ? c : a;
+                return pred(proj(*a), proj(*c)) ? a : pred(proj(*b), proj(*c)) ? c : b;
+            }
+
         public:
             template<typename I, typename S, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterator<I>() &&
                     IteratorRange<I, S>())>
-            I operator()(I begin, S end_, C pred_ = C{}, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(I begin, S end_, C pred_ = C{}, P proj_ = P{}) const
             {
                 auto &&pred = invokable(pred_);
                 auto &&proj = invokable(proj_);
@@ -202,10 +213,19 @@ namespace ranges
             template<typename Rng, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Sortable<I, C, P>() && RandomAccessIterable<Rng &>())>
-            I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(Rng & rng, C pred = C{}, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/sort.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_sort(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `sort_fn`
@@ -0,0 +1,281 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_ALGORITHM_SORT_BY_KEY_HPP
+#define RANGES_V3_ALGORITHM_SORT_BY_KEY_HPP
+
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <initializer_list>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/static_const.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename P>
+            using sort_key_t =
+                decay_t<concepts::Invokable::result_t<P, range_reference_t<Rng>>>;
+
+            template<typename C>
+            struct key_index_less
+            {
+                C &pred;
+                template<typename K>
+                bool operator()(std::pair<K, std::size_t> const &a,
+                    std::pair<K, std::size_t> const &b) const
+                {
+                    return pred(a.first, b.first);
+                }
+            };
+
+            // Integral keys in ascending order are sorted by radix, which is
+            // stable on its own.
+            template<typename K, typename C>
+            using key_index_radix_sortable = meta::and_c<
+                std::is_integral<K>::value && !std::is_same<K, bool>::value,
+                std::is_same<C, ordered_less>::value || std::is_same<C, std::less<K>>::value>;
+
+            // Least significant digit first, a byte at a time, with the counts
+            // for every digit taken in one pass up front. Digits that all keys
+            // share are skipped.
+            template<typename K, typename C>
+            void sort_key_index_(std::vector<std::pair<K, std::size_t>> &ki, C &, std::true_type)
+            {
+                using U = meta::eval<std::make_unsigned<K>>;
+                constexpr std::size_t digits = sizeof(K);
+                // Flipping the sign bit orders signed keys as unsigned ones.
+                U const flip = std::is_signed<K>::value ?
+                    static_cast<U>(U(1) << (std::numeric_limits<U>::digits - 1)) : U(0);
+                std::size_t counts[digits][256] = {};
+                for(auto const &p : ki)
+                {
+                    U const u = static_cast<U>(static_cast<U>(p.first) ^ flip);
+                    for(std::size_t d = 0; d != digits; ++d)
+                        ++counts[d][(u >> (8 * d)) & 0xff];
+                }
+                std::vector<std::pair<K, std::size_t>> buf(ki.size());
+                auto *src = &ki, *dst = &buf;
+                for(std::size_t d = 0; d != digits; ++d)
+                {
+                    std::size_t *const count = counts[d];
+                    if(ranges::find(count, count + 256, ki.size()) != count + 256)
+                        continue;
+                    std::size_t sum = 0;
+                    for(std::size_t b = 0; b != 256; ++b)
+                    {
+                        std::size_t const c = count[b];
+                        count[b] = sum;
+                        sum += c;
+                    }
+                    for(auto const &p : *src)
+                    {
+                        U const u = static_cast<U>(static_cast<U>(p.first) ^ flip);
+                        (*dst)[count[(u >> (8 * d)) & 0xff]++] = p;
+                    }
+                    std::swap(src, dst);
+                }
+                if(src != &ki)
+                    ki.swap(buf);
+            }
+
+            // Otherwise the pairs are sorted by key alone, and then each run of
+            // equivalent keys, which is usually short, by index.
+            template<typename K, typename C>
+            void sort_key_index_(std::vector<std::pair<K, std::size_t>> &ki, C &pred,
+                std::false_type)
+            {
+                ranges::sort(ki, key_index_less<C>{pred});
+                for(auto begin = ki.begin(), end = ki.end(); begin != end;)
+                {
+                    auto run = next(begin);
+                    while(run != end && !pred(begin->first, run->first))
+                        ++run;
+                    if(run - begin > 1)
+                        ranges::sort(begin, run, ordered_less{},
+                            &std::pair<K, std::size_t>::second);
+                    begin = run;
+                }
+            }
+
+            template<typename T, typename Rng>
+            void reserve_for(std::vector<T> &v, Rng &rng, std::true_type)
+            {
+                v.reserve(static_cast<std::size_t>(ranges::size(rng)));
+            }
+            template<typename T, typename Rng>
+            void reserve_for(std::vector<T> &, Rng &, std::false_type)
+            {}
+
+            template<typename K, typename C>
+            std::vector<std::size_t> sort_key_index(std::vector<std::pair<K, std::size_t>> &ki,
+                C &pred)
+            {
+                detail::sort_key_index_(ki, pred, key_index_radix_sortable<K, C>{});
+                std::vector<std::size_t> perm;
+                perm.reserve(ki.size());
+                for(auto const &p : ki)
+                    perm.push_back(p.second);
+                return perm;
+            }
+        }
+        /// \endcond
+
+        template<typename Rng, typename C, typename P,
+            typename K = detail::sort_key_t<Rng, P>>
+        using SortPermutable = meta::fast_and<
+            InputIterable<Rng>,
+            Invokable<P, range_reference_t<Rng>>,
+            Movable<K>,
+            InvokableRelation<C, K, K>>;
+
+        template<typename Rng, typename Perm,
+            typename I = range_iterator_t<Rng>>
+        using PermutationApplicable = meta::fast_and<
+            RandomAccessIterable<Rng>,
+            Movable<iterator_value_t<I>>,
+            IndirectlyMovable<I, iterator_value_t<I> *>,
+            IndirectlyMovable<iterator_value_t<I> *, I>,
+            InputIterable<Perm>,
+            SizedIterable<Perm>,
+            Integral<range_value_t<Perm>>>;
+
+        /// \addtogroup group-algorithms
+        /// @{
+
+        /// Returns the permutation that stably sorts a range by the projection of
+        /// its elements: element `perm[i]` of the range belongs at position `i`.
+        /// Only the (key, index) pairs are sorted; the range is left as it is.
+        /// Pass the permutation to `apply_permutation` to reorder the range and
+        /// any number of ranges that run parallel to it.
+        struct sort_permutation_fn
+        {
+            template<typename Rng, typename C = ordered_less, typename P = ident,
+                typename K = detail::sort_key_t<Rng, P>,
+                CONCEPT_REQUIRES_(SortPermutable<Rng, C, P>())>
+            std::vector<std::size_t> operator()(Rng && rng, C pred_ = C{}, P proj_ = P{}) const
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                std::vector<std::pair<K, std::size_t>> ki;
+                detail::reserve_for(ki, rng, SizedIterable<Rng>());
+                std::size_t i = 0;
+                for(auto begin = ranges::begin(rng), end = ranges::end(rng); begin != end;
+                    ++begin, ++i)
+                    ki.emplace_back(proj(*begin), i);
+                return detail::sort_key_index(ki, pred);
+            }
+        };
+
+        /// \sa `sort_permutation_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& sort_permutation = static_const<sort_permutation_fn>::value;
+        }
+
+        /// Reorders a random-access range so that its element `i` is the one that
+        /// was at position `perm[i]`. The elements are gathered into a buffer in
+        /// one pass and moved back in another. \p perm must be a permutation of
+        /// the positions of the range.
+        struct apply_permutation_fn
+        {
+            template<typename Rng, typename Perm,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(PermutationApplicable<Rng, Perm>())>
+            I operator()(Rng && rng, Perm const &perm) const
+            {
+                I const first = ranges::begin(rng);
+                std::vector<iterator_value_t<I>> buf;
+                buf.reserve(static_cast<std::size_t>(ranges::size(perm)));
+                for(auto i : perm)
+                    buf.push_back(iter_move(first + static_cast<iterator_difference_t<I>>(i)));
+                I out = first;
+                for(auto &v : buf)
+                    *out++ = std::move(v);
+                return out;
+            }
+        };
+
+        /// \sa `apply_permutation_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& apply_permutation = static_const<apply_permutation_fn>::value;
+        }
+
+        /// Stably sorts \p keys into ascending order and applies the same
+        /// reordering to each of \p values, which run parallel to the keys. The
+        /// keys are sorted alongside their indices, and each of the value ranges
+        /// is then permuted in one gather pass, rather than moving every range on
+        /// every swap, as sorting a `view::zip` of them would. Returns the
+        /// permutation, which can be passed to `apply_permutation` to reorder more
+        /// parallel ranges later. If a comparison throws, the keys are left in a
+        /// valid but unspecified state and the values as they were.
+        struct sort_by_key_fn
+        {
+            template<typename Keys, typename...Values,
+                typename I = range_iterator_t<Keys>,
+                typename K = iterator_value_t<I>,
+                CONCEPT_REQUIRES_(ForwardIterable<Keys>() &&
+                    SortPermutable<Keys, ordered_less, ident>() && IndirectlyMovable<K *, I>() &&
+                    meta::and_c<(bool) PermutationApplicable<Values,
+                        std::vector<std::size_t>>()...>::value)>
+            std::vector<std::size_t> operator()(Keys && keys, Values &&...values) const
+            {
+                ordered_less pred;
+                std::vector<std::pair<K, std::size_t>> ki;
+                detail::reserve_for(ki, keys, SizedIterable<Keys>());
+                std::size_t i = 0;
+                I const first = ranges::begin(keys);
+                for(auto begin = first, end = ranges::end(keys); begin != end; ++begin, ++i)
+                    ki.emplace_back(iter_move(begin), i);
+                auto perm = detail::sort_key_index(ki, pred);
+                I out = first;
+                for(auto &p : ki)
+                    *out++ = std::move(p.first);
+                (void)std::initializer_list<int>{
+                    ((void)apply_permutation(values, perm), 42)...};
+                return perm;
+            }
+        };
+
+        /// \sa `sort_by_key_fn`
+        /// \ingroup group-algorithms
+        namespace
+        {
+            constexpr auto&& sort_by_key = static_const<sort_by_key_fn>::value;
+        }
+
+        /// @}
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
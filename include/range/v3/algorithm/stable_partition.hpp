@@ -37,6 +37,7 @@
 #include <range/v3/algorithm/rotate.hpp>
 #include <range/v3/algorithm/partition_move.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -279,6 +280,15 @@ namespace ranges
             {
                 return (*this)(begin(rng), end(rng), std::move(pred), std::move(proj));
             }
+
+            // Execution policy variants; see range/v3/execution/algorithm/stable_partition.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_stable_partition(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `stable_partition_fn`
@@ -16,6 +16,7 @@
 #include <tuple>
 #include <utility>
 #include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -24,6 +25,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/unreachable.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
@@ -62,7 +64,7 @@ namespace ranges
             // Single-range variant
             template<typename I, typename S, typename O, typename F, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && Transformable1<I, O, F, P>())>
-            std::pair<I, O> operator()(I begin, S end, O out, F fun_, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR std::pair<I, O> operator()(I begin, S end, O out, F fun_, P proj_ = P{}) const
             {
                 auto &&fun = invokable(fun_);
                 auto &&proj = invokable(proj_);
@@ -74,7 +76,7 @@ namespace ranges
             template<typename Rng, typename O, typename F, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng &>() && Transformable1<I, O, F, P>())>
-            std::pair<I, O> operator()(Rng & rng, O out, F fun, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR std::pair<I, O> operator()(Rng & rng, O out, F fun, P proj = P{}) const
             {
                 return (*this)(begin(rng), end(rng), std::move(out), std::move(fun), std::move(proj));
             }
@@ -83,7 +85,7 @@ namespace ranges
             template<typename I0, typename S0, typename I1, typename S1, typename O, typename F,
                 typename P0 = ident, typename P1 = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I0, S0>() && IteratorRange<I1, S1>() && Transformable2<I0, I1, O, F, P0, P1>())>
-            std::tuple<I0, I1, O> operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, F fun_,
+            RANGES_CXX14_CONSTEXPR std::tuple<I0, I1, O> operator()(I0 begin0, S0 end0, I1 begin1, S1 end1, O out, F fun_,
                 P0 proj0_ = P0{}, P1 proj1_ = P1{}) const
             {
                 auto &&fun = invokable(fun_);
@@ -99,7 +101,7 @@ namespace ranges
                 typename I0 = range_iterator_t<Rng0>,
                 typename I1 = range_iterator_t<Rng1>,
                 CONCEPT_REQUIRES_(Iterable<Rng0 &>() && Iterable<Rng1 &>() && Transformable2<I0, I1, O, F, P0, P1>())>
-            std::tuple<I0, I1, O> operator()(Rng0 & rng0, Rng1 & rng1, O out, F fun,
+            RANGES_CXX14_CONSTEXPR std::tuple<I0, I1, O> operator()(Rng0 & rng0, Rng1 & rng1, O out, F fun,
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
                 return (*this)(begin(rng0), end(rng0), begin(rng1), end(rng1), std::move(out),
@@ -110,7 +112,7 @@ namespace ranges
             template<typename I0, typename S0, typename I1, typename O, typename F,
                 typename P0 = ident, typename P1 = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I0, S0>() && Transformable2<I0, I1, O, F, P0, P1>())>
-            std::tuple<I0, I1, O> operator()(I0 begin0, S0 end0, I1 begin1, O out, F fun,
+            RANGES_CXX14_CONSTEXPR std::tuple<I0, I1, O> operator()(I0 begin0, S0 end0, I1 begin1, O out, F fun,
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
                 return (*this)(std::move(begin0), std::move(end0), std::move(begin1), unreachable{},
@@ -121,12 +123,23 @@ namespace ranges
                 typename P0 = ident, typename P1 = ident, typename I1 = uncvref_t<I1Ref>,
                 typename I0 = range_iterator_t<Rng0>,
                 CONCEPT_REQUIRES_(Iterable<Rng0 &>() && Transformable2<I0, I1, O, F, P0, P1>())>
-            std::tuple<I0, I1, O> operator()(Rng0 & rng0, I1Ref &&begin1, O out, F fun,
+            RANGES_CXX14_CONSTEXPR std::tuple<I0, I1, O> operator()(Rng0 & rng0, I1Ref &&begin1, O out, F fun,
                 P0 proj0 = P0{}, P1 proj1 = P1{}) const
             {
                 return (*this)(begin(rng0), end(rng0), std::forward<I1Ref>(begin1), unreachable{},
                     std::move(out), std::move(fun), std::move(proj0), std::move(proj1));
             }
+
+            // Execution policy variants, defined in
+            // range/v3/execution/algorithm/transform.hpp and found by ADL on the
+            // policy, so that serial callers do not pay for the thread pool.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_transform(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         /// \sa `transform_fn`
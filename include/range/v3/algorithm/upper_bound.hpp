@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_ALGORITHM_UPPER_BOUND_HPP
 #define RANGES_V3_ALGORITHM_UPPER_BOUND_HPP
 
+#include <functional>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/distance.hpp>
@@ -20,6 +22,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/aux_/gallop_n.hpp>
 #include <range/v3/algorithm/aux_/upper_bound_n.hpp>
 #include <range/v3/utility/static_const.hpp>
 
@@ -31,23 +34,48 @@ namespace ranges
         /// @{
         struct upper_bound_fn
         {
+        private:
+            template<typename Rng, typename V2, typename C, typename P>
+            static RANGES_CXX14_CONSTEXPR range_iterator_t<Rng> range_(Rng &rng, V2 const &val, C &pred, P &proj,
+                std::false_type)
+            {
+                return aux::upper_bound_n(begin(rng), distance(rng), val, std::move(pred),
+                    std::move(proj));
+            }
+            // As for lower_bound, an infinite range is searched by galloping
+            // ahead to the first element that val is less than.
+            template<typename Rng, typename V2, typename C, typename P>
+            static range_iterator_t<Rng> range_(Rng &rng, V2 const &val, C &pred_, P &proj_,
+                std::true_type)
+            {
+                using I = range_iterator_t<Rng>;
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto stride = aux::gallop_n(begin(rng), [&](I const &it)
+                {
+                    return pred(val, proj(*it));
+                });
+                return aux::upper_bound_n(std::move(stride.first), stride.second, val,
+                    std::ref(pred), std::ref(proj));
+            }
+        public:
             template<typename I, typename S, typename V2, typename C = ordered_less, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && BinarySearchable<I, V2, C, P>())>
-            I operator()(I begin, S end, V2 const &val, C pred = C{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(I begin, S end, V2 const &val, C pred = C{}, P proj = P{}) const
             {
                 return aux::upper_bound_n(std::move(begin), distance(begin, end), val, std::move(pred),
                     std::move(proj));
             }
 
             /// \overload
+            /// \pre If `rng` is infinite, `val` is less than some element of it;
+            /// otherwise the search never ends.
             template<typename Rng, typename V2, typename C = ordered_less, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng &>() && BinarySearchable<I, V2, C, P>())>
-            I operator()(Rng &rng, V2 const &val, C pred = C{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR I operator()(Rng &rng, V2 const &val, C pred = C{}, P proj = P{}) const
             {
-                static_assert(!is_infinite<Rng>::value, "Trying to binary search an infinite range");
-                return aux::upper_bound_n(begin(rng), distance(rng), val, std::move(pred),
-                    std::move(proj));
+                return upper_bound_fn::range_(rng, val, pred, proj, is_infinite<Rng>());
             }
         };
 
@@ -17,6 +17,8 @@
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm.hpp>
 #include <range/v3/action.hpp>
+#include <range/v3/container.hpp>
+#include <range/v3/execution.hpp>
 #include <range/v3/numeric.hpp>
 #include <range/v3/view.hpp>
 
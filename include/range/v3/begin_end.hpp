@@ -120,23 +120,46 @@ namespace ranges
                 return rend(ref.get());
             }
 
+            // std::begin and std::end are not constexpr before C++17, so members
+            // are called directly where there are any.
+            template<typename Rng>
+            constexpr auto begin_(Rng &rng, int) -> decltype(rng.begin())
+            {
+                return rng.begin();
+            }
+            template<typename Rng>
+            constexpr auto begin_(Rng &rng, long) -> decltype(begin(rng))
+            {
+                return begin(rng);
+            }
+            template<typename Rng>
+            constexpr auto end_(Rng &rng, int) -> decltype(rng.end())
+            {
+                return rng.end();
+            }
+            template<typename Rng>
+            constexpr auto end_(Rng &rng, long) -> decltype(end(rng))
+            {
+                return end(rng);
+            }
+
             struct begin_fn
             {
                 template<typename Rng>
-                auto operator()(Rng && rng) const ->
-                    decltype(begin(rng))
+                constexpr auto operator()(Rng && rng) const ->
+                    decltype(adl_begin_end_detail::begin_(rng, 42))
                 {
-                    return begin(rng);
+                    return adl_begin_end_detail::begin_(rng, 42);
                 }
             };
 
             struct end_fn
             {
                 template<typename Rng>
-                auto operator()(Rng && rng) const ->
-                    decltype(end(rng))
+                constexpr auto operator()(Rng && rng) const ->
+                    decltype(adl_begin_end_detail::end_(rng, 42))
                 {
-                    return end(rng);
+                    return adl_begin_end_detail::end_(rng, 42);
                 }
             };
 
@@ -163,20 +186,20 @@ namespace ranges
             struct cbegin_fn
             {
                 template<typename Rng>
-                auto operator()(Rng const & rng) const ->
-                    decltype(begin(rng))
+                constexpr auto operator()(Rng const & rng) const ->
+                    decltype(adl_begin_end_detail::begin_(rng, 42))
                 {
-                    return begin(rng);
+                    return adl_begin_end_detail::begin_(rng, 42);
                 }
             };
 
             struct cend_fn
             {
                 template<typename Rng>
-                auto operator()(Rng const & rng) const ->
-                    decltype(end(rng))
+                constexpr auto operator()(Rng const & rng) const ->
+                    decltype(adl_begin_end_detail::end_(rng, 42))
                 {
-                    return end(rng);
+                    return adl_begin_end_detail::end_(rng, 42);
                 }
             };
 
@@ -0,0 +1,27 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_CONTAINER_HPP
+#define RANGES_V3_CONTAINER_HPP
+
+#include <range/v3/detail/disable_warnings.hpp>
+
+#include <range/v3/container/flat_hash_map.hpp>
+#include <range/v3/container/flat_hash_set.hpp>
+#include <range/v3/container/flat_map.hpp>
+#include <range/v3/container/flat_set.hpp>
+#include <range/v3/container/soa_vector.hpp>
+
+#include <range/v3/detail/re_enable_warnings.hpp>
+
+#endif
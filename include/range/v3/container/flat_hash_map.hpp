@@ -0,0 +1,166 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_HASH_MAP_HPP
+#define RANGES_V3_CONTAINER_FLAT_HASH_MAP_HPP
+
+#include <new>
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/container/flat_hash_table.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Key, typename T>
+            struct flat_hash_map_policy
+            {
+                using key_type = Key;
+                using value_type = std::pair<Key const, T>;
+                static constexpr bool const_iterators = false;
+                static Key const &key(value_type const &value)
+                {
+                    return value.first;
+                }
+                template<typename...Args>
+                static void construct(value_type *p, Args &&...args)
+                {
+                    ::new(static_cast<void *>(p)) value_type(std::forward<Args>(args)...);
+                }
+                // The key is const, so it is copied; the mapped value is moved when
+                // neither step can throw.
+                static void relocate_(value_type *to, value_type *from, std::true_type)
+                {
+                    ::new(static_cast<void *>(to)) value_type(from->first, std::move(from->second));
+                }
+                static void relocate_(value_type *to, value_type *from, std::false_type)
+                {
+                    ::new(static_cast<void *>(to)) value_type(std::move_if_noexcept(*from));
+                }
+                static void relocate(value_type *to, value_type *from)
+                {
+                    flat_hash_map_policy::relocate_(to, from, meta::and_<
+                        std::is_nothrow_copy_constructible<Key>,
+                        std::is_nothrow_move_constructible<T>>{});
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-containers
+        /// @{
+
+        /// An unordered map that stores its elements in one flat array, probed
+        /// with open addressing. Inserting allocates only when the table grows,
+        /// and lookups touch contiguous memory. Unlike `std::unordered_map`,
+        /// inserting and rehashing move elements, so they invalidate iterators,
+        /// pointers and references to elements.
+        template<typename Key, typename T, typename Hash = std::hash<Key>,
+            typename Eq = std::equal_to<Key>>
+        struct flat_hash_map
+          : detail::flat_hash_table<detail::flat_hash_map_policy<Key, T>, Hash, Eq>
+        {
+        private:
+            using base_t = detail::flat_hash_table<detail::flat_hash_map_policy<Key, T>, Hash, Eq>;
+        public:
+            using mapped_type = T;
+            using value_type = std::pair<Key const, T>;
+            using iterator = typename base_t::template basic_iterator<false>;
+            using const_iterator = typename base_t::template basic_iterator<true>;
+            using reference = value_type &;
+            using const_reference = value_type const &;
+            using pointer = value_type *;
+            using const_pointer = value_type const *;
+
+            using base_t::base_t;
+            flat_hash_map() = default;
+            flat_hash_map(std::initializer_list<value_type> il)
+              : base_t(il)
+            {}
+            flat_hash_map &operator=(std::initializer_list<value_type> il)
+            {
+                this->base_t::operator=(il);
+                return *this;
+            }
+
+            /// Adds an element built from \p key and \p args, unless there is
+            /// already one with that key. Nothing is built if there is.
+            template<typename...Args>
+            std::pair<iterator, bool> try_emplace(Key const &key, Args &&...args)
+            {
+                auto const p = this->find_or_emplace(key, std::piecewise_construct,
+                    std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+                return {this->make_iterator(p.first), p.second};
+            }
+            /// \overload
+            template<typename...Args>
+            std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args)
+            {
+                auto const p = this->find_or_emplace(key, std::piecewise_construct,
+                    std::forward_as_tuple(std::move(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+                return {this->make_iterator(p.first), p.second};
+            }
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(Key const &key, M &&obj)
+            {
+                auto p = this->try_emplace(key, std::forward<M>(obj));
+                if(!p.second)
+                    p.first->second = std::forward<M>(obj);
+                return p;
+            }
+            /// \overload
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj)
+            {
+                auto p = this->try_emplace(std::move(key), std::forward<M>(obj));
+                if(!p.second)
+                    p.first->second = std::forward<M>(obj);
+                return p;
+            }
+            T &operator[](Key const &key)
+            {
+                return this->try_emplace(key).first->second;
+            }
+            T &operator[](Key &&key)
+            {
+                return this->try_emplace(std::move(key)).first->second;
+            }
+            T &at(Key const &key)
+            {
+                auto const i = this->find_index(key);
+                if(i == this->bucket_count())
+                    throw std::out_of_range("flat_hash_map::at");
+                return this->make_iterator(i)->second;
+            }
+            T const &at(Key const &key) const
+            {
+                auto const i = this->find_index(key);
+                if(i == this->bucket_count())
+                    throw std::out_of_range("flat_hash_map::at");
+                return this->make_iterator(i)->second;
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
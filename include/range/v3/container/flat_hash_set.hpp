@@ -0,0 +1,97 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_HASH_SET_HPP
+#define RANGES_V3_CONTAINER_FLAT_HASH_SET_HPP
+
+#include <new>
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/container/flat_hash_table.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Key>
+            struct flat_hash_set_policy
+            {
+                using key_type = Key;
+                using value_type = Key;
+                static constexpr bool const_iterators = true;
+                static Key const &key(Key const &value)
+                {
+                    return value;
+                }
+                template<typename...Args>
+                static void construct(Key *p, Args &&...args)
+                {
+                    ::new(static_cast<void *>(p)) Key(std::forward<Args>(args)...);
+                }
+                static void relocate(Key *to, Key *from)
+                {
+                    ::new(static_cast<void *>(to)) Key(std::move_if_noexcept(*from));
+                }
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-containers
+        /// @{
+
+        /// An unordered set that stores its elements in one flat array, probed
+        /// with open addressing. Inserting allocates only when the table grows,
+        /// and lookups touch contiguous memory. Unlike `std::unordered_set`,
+        /// inserting and rehashing move elements, so they invalidate iterators,
+        /// pointers and references to elements.
+        template<typename Key, typename Hash = std::hash<Key>, typename Eq = std::equal_to<Key>>
+        struct flat_hash_set
+          : detail::flat_hash_table<detail::flat_hash_set_policy<Key>, Hash, Eq>
+        {
+        private:
+            using base_t = detail::flat_hash_table<detail::flat_hash_set_policy<Key>, Hash, Eq>;
+        public:
+            using iterator = typename base_t::template basic_iterator<true>;
+            using const_iterator = iterator;
+            using reference = Key const &;
+            using const_reference = Key const &;
+            using pointer = Key const *;
+            using const_pointer = Key const *;
+
+            using base_t::base_t;
+            flat_hash_set() = default;
+            flat_hash_set(std::initializer_list<Key> il)
+              : base_t(il)
+            {}
+            flat_hash_set &operator=(std::initializer_list<Key> il)
+            {
+                this->base_t::operator=(il);
+                return *this;
+            }
+        };
+
+        // The elements of a set are immutable, so the is_range heuristic would
+        // take it for a view.
+        template<typename Key, typename Hash, typename Eq>
+        struct is_range<flat_hash_set<Key, Hash, Eq>>
+          : std::false_type
+        {};
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,733 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_HASH_TABLE_HPP
+#define RANGES_V3_CONTAINER_FLAT_HASH_TABLE_HPP
+
+#include <limits>
+#include <memory>
+#include <cstdint>
+#include <utility>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <initializer_list>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#ifdef RANGES_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Each slot of a flat hash table has one control byte. A full slot's
+            // byte holds 7 bits of its key's hash; the other states are negative.
+            // The bytes of the first width - 1 slots are repeated after the
+            // sentinel, so that a group can be loaded from any slot without
+            // wrapping around.
+            using hash_ctrl_t = signed char;
+            constexpr hash_ctrl_t hash_ctrl_empty = -128;
+            constexpr hash_ctrl_t hash_ctrl_deleted = -2;
+            constexpr hash_ctrl_t hash_ctrl_sentinel = -1;
+
+            inline unsigned hash_trailing_zeros(std::uint64_t x)
+            {
+                RANGES_ASSERT(x != 0);
+#if defined(__GNUC__) || defined(__clang__)
+                return static_cast<unsigned>(__builtin_ctzll(x));
+#else
+                unsigned n = 0;
+                for(; !(x & 1u); x >>= 1)
+                    ++n;
+                return n;
+#endif
+            }
+
+            // The slots of a group that match some condition, lowest first.
+            struct hash_bitmask
+            {
+                std::uint64_t mask;
+                unsigned shift;
+                explicit operator bool() const
+                {
+                    return mask != 0;
+                }
+                std::size_t lowest() const
+                {
+                    return hash_trailing_zeros(mask) >> shift;
+                }
+                void pop()
+                {
+                    mask &= mask - 1;
+                }
+            };
+
+#ifdef RANGES_SSE2
+            // Sixteen control bytes, matched with one compare and one movemask each.
+            struct hash_group
+            {
+                static constexpr std::size_t width = 16;
+            private:
+                __m128i ctrl_;
+            public:
+                explicit hash_group(hash_ctrl_t const *ctrl)
+                  : ctrl_(_mm_loadu_si128(reinterpret_cast<__m128i const *>(ctrl)))
+                {}
+                hash_bitmask match(hash_ctrl_t h2) const
+                {
+                    return {static_cast<std::uint64_t>(static_cast<unsigned>(
+                        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)))), 0};
+                }
+                hash_bitmask match_empty() const
+                {
+                    return this->match(hash_ctrl_empty);
+                }
+                // Empty and deleted are the only states below the sentinel.
+                hash_bitmask match_empty_or_deleted() const
+                {
+                    return {static_cast<std::uint64_t>(static_cast<unsigned>(
+                        _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(hash_ctrl_sentinel),
+                            ctrl_)))), 0};
+                }
+                std::size_t count_leading_empty_or_deleted() const
+                {
+                    return hash_trailing_zeros(this->match_empty_or_deleted().mask + 1);
+                }
+            };
+#else
+            // Eight control bytes in a 64-bit word, matched with bit tricks. A
+            // match may also report a full slot just above a real match; callers
+            // compare keys anyway, so that is harmless.
+            struct hash_group
+            {
+                static constexpr std::size_t width = 8;
+            private:
+                static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+                static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+                std::uint64_t ctrl_;
+            public:
+                explicit hash_group(hash_ctrl_t const *ctrl)
+                  : ctrl_(0)
+                {
+                    for(std::size_t i = 0; i != width; ++i)
+                        ctrl_ |= std::uint64_t(static_cast<unsigned char>(ctrl[i])) << (8 * i);
+                }
+                hash_bitmask match(hash_ctrl_t h2) const
+                {
+                    std::uint64_t const x = ctrl_ ^ (lsbs * static_cast<unsigned char>(h2));
+                    return {(x - lsbs) & ~x & msbs, 3};
+                }
+                hash_bitmask match_empty() const
+                {
+                    return {ctrl_ & (~ctrl_ << 6) & msbs, 3};
+                }
+                hash_bitmask match_empty_or_deleted() const
+                {
+                    return {ctrl_ & (~ctrl_ << 7) & msbs, 3};
+                }
+                std::size_t count_leading_empty_or_deleted() const
+                {
+                    std::uint64_t const rest = ~this->match_empty_or_deleted().mask & msbs;
+                    return rest ? hash_trailing_zeros(rest) >> 3 : width;
+                }
+            };
+#endif
+
+            // An open-addressing hash table in the style of Abseil's SwissTable:
+            // the elements live in one flat array, and a parallel array of control
+            // bytes is searched a group at a time, so that a lookup usually touches
+            // one group of control bytes and one slot. Policy says what the
+            // elements are and how to get the key of one.
+            template<typename Policy, typename Hash, typename Eq>
+            struct flat_hash_table
+            {
+                using key_type = typename Policy::key_type;
+                using value_type = typename Policy::value_type;
+                using size_type = std::size_t;
+                using difference_type = std::ptrdiff_t;
+                using hasher = Hash;
+                using key_equal = Eq;
+
+                template<bool IsConst>
+                struct basic_iterator
+                  : std::iterator<std::forward_iterator_tag, value_type, std::ptrdiff_t,
+                        meta::if_c<IsConst, value_type const, value_type> *,
+                        meta::if_c<IsConst, value_type const, value_type> &>
+                {
+                private:
+                    friend struct flat_hash_table;
+                    template<bool>
+                    friend struct basic_iterator;
+                    using value_t = meta::if_c<IsConst, value_type const, value_type>;
+                    hash_ctrl_t const *ctrl_;
+                    value_t *slot_;
+                    basic_iterator(hash_ctrl_t const *ctrl, value_t *slot)
+                      : ctrl_(ctrl), slot_(slot)
+                    {}
+                    // Moves to the first full slot at or after this one. The sentinel
+                    // stops the scan at the end.
+                    void skip()
+                    {
+                        while(*ctrl_ < hash_ctrl_sentinel)
+                        {
+                            std::size_t const n = hash_group{ctrl_}.count_leading_empty_or_deleted();
+                            ctrl_ += n;
+                            slot_ += n;
+                        }
+                    }
+                public:
+                    basic_iterator()
+                      : ctrl_(nullptr), slot_(nullptr)
+                    {}
+                    template<bool Other, CONCEPT_REQUIRES_(IsConst && !Other)>
+                    basic_iterator(basic_iterator<Other> that)
+                      : ctrl_(that.ctrl_), slot_(that.slot_)
+                    {}
+                    value_t &operator*() const
+                    {
+                        return *slot_;
+                    }
+                    value_t *operator->() const
+                    {
+                        return slot_;
+                    }
+                    basic_iterator &operator++()
+                    {
+                        ++ctrl_;
+                        ++slot_;
+                        this->skip();
+                        return *this;
+                    }
+                    basic_iterator operator++(int)
+                    {
+                        auto tmp = *this;
+                        ++*this;
+                        return tmp;
+                    }
+                    friend bool operator==(basic_iterator const &x, basic_iterator const &y)
+                    {
+                        return x.ctrl_ == y.ctrl_;
+                    }
+                    friend bool operator!=(basic_iterator const &x, basic_iterator const &y)
+                    {
+                        return !(x == y);
+                    }
+                };
+
+            private:
+                static constexpr std::size_t width = hash_group::width;
+                hash_ctrl_t *ctrl_;
+                value_type *slots_;
+                // Always zero or one less than a power of two, and never less than
+                // width - 1, so that a group never spans past the cloned bytes.
+                size_type capacity_;
+                size_type size_;
+                // How many more elements fit before the table must grow.
+                size_type growth_left_;
+                Hash hash_;
+                Eq eq_;
+
+                // At most 7/8 of the slots are used, so every probe ends at an empty.
+                static size_type growth_for(size_type cap)
+                {
+                    return cap - (cap + 1) / 8;
+                }
+                static size_type capacity_for(size_type n)
+                {
+                    size_type cap = width - 1;
+                    while(growth_for(cap) < n)
+                        cap = 2 * cap + 1;
+                    return cap;
+                }
+                // std::hash is the identity for integers, so mix the bits before
+                // splitting the hash into a position and a 7-bit tag.
+                static std::size_t mix(std::size_t h)
+                {
+                    constexpr unsigned half = std::numeric_limits<std::size_t>::digits / 2;
+                    h ^= h >> half;
+                    h *= static_cast<std::size_t>(0x9E3779B97F4A7C15ull);
+                    h ^= h >> half;
+                    return h;
+                }
+                static hash_ctrl_t h2(std::size_t h)
+                {
+                    return static_cast<hash_ctrl_t>(h & 0x7F);
+                }
+                template<typename K>
+                std::size_t hash_of(K const &key) const
+                {
+                    return flat_hash_table::mix(hash_(key));
+                }
+                void set_ctrl(size_type i, hash_ctrl_t c)
+                {
+                    ctrl_[i] = c;
+                    ctrl_[((i - (width - 1)) & capacity_) + (width - 1)] = c;
+                }
+                template<typename K>
+                size_type find_index(K const &key, std::size_t h) const
+                {
+                    if(!capacity_)
+                        return 0;
+                    size_type pos = (h >> 7) & capacity_;
+                    for(size_type step = width;; step += width)
+                    {
+                        hash_group const g{ctrl_ + pos};
+                        for(auto m = g.match(h2(h)); m; m.pop())
+                        {
+                            size_type const i = (pos + m.lowest()) & capacity_;
+                            if(eq_(Policy::key(slots_[i]), key))
+                                return i;
+                        }
+                        if(g.match_empty())
+                            return capacity_;
+                        pos = (pos + step) & capacity_;
+                    }
+                }
+                size_type find_first_non_full(std::size_t h) const
+                {
+                    size_type pos = (h >> 7) & capacity_;
+                    for(size_type step = width;; step += width)
+                    {
+                        auto const m = hash_group{ctrl_ + pos}.match_empty_or_deleted();
+                        if(m)
+                            return (pos + m.lowest()) & capacity_;
+                        pos = (pos + step) & capacity_;
+                    }
+                }
+                void allocate(size_type cap)
+                {
+                    std::unique_ptr<hash_ctrl_t[]> ctrl{new hash_ctrl_t[cap + width]};
+                    slots_ = std::allocator<value_type>{}.allocate(cap);
+                    ctrl_ = ctrl.release();
+                    capacity_ = cap;
+                    std::fill(ctrl_, ctrl_ + cap + width, hash_ctrl_empty);
+                    ctrl_[cap] = hash_ctrl_sentinel;
+                }
+                void deallocate()
+                {
+                    if(!capacity_)
+                        return;
+                    delete[] ctrl_;
+                    std::allocator<value_type>{}.deallocate(slots_, capacity_);
+                }
+                void destroy_all()
+                {
+                    for(size_type i = 0; i != capacity_; ++i)
+                        if(ctrl_[i] >= 0)
+                            slots_[i].~value_type();
+                }
+                // Moves every element into a fresh array of cap slots, dropping the
+                // deleted markers. If an element must be copied and the copy throws,
+                // the table is left as it was.
+                void resize(size_type cap)
+                {
+                    hash_ctrl_t *const old_ctrl = ctrl_;
+                    value_type *const old_slots = slots_;
+                    size_type const old_cap = capacity_;
+                    this->allocate(cap);
+                    size_type i = 0;
+                    try
+                    {
+                        for(; i != old_cap; ++i)
+                        {
+                            if(old_ctrl[i] < 0)
+                                continue;
+                            std::size_t const h = this->hash_of(Policy::key(old_slots[i]));
+                            size_type const j = this->find_first_non_full(h);
+                            Policy::relocate(slots_ + j, old_slots + i);
+                            this->set_ctrl(j, h2(h));
+                        }
+                    }
+                    catch(...)
+                    {
+                        this->destroy_all();
+                        this->deallocate();
+                        ctrl_ = old_ctrl;
+                        slots_ = old_slots;
+                        capacity_ = old_cap;
+                        throw;
+                    }
+                    for(i = 0; i != old_cap; ++i)
+                        if(old_ctrl[i] >= 0)
+                            old_slots[i].~value_type();
+                    if(old_cap)
+                    {
+                        delete[] old_ctrl;
+                        std::allocator<value_type>{}.deallocate(old_slots, old_cap);
+                    }
+                    growth_left_ = growth_for(capacity_) - size_;
+                }
+                // When deleted markers take up much of the table, rehashing at the
+                // same capacity reclaims them; otherwise the table doubles.
+                void grow()
+                {
+                    if(capacity_ && size_ <= capacity_ / 2)
+                        this->resize(capacity_);
+                    else
+                        this->resize(capacity_ ? 2 * capacity_ + 1 : capacity_for(1));
+                }
+                // Finds the slot a new element with hash h goes in, growing first if
+                // need be.
+                size_type prepare_insert(std::size_t h)
+                {
+                    if(capacity_)
+                    {
+                        size_type const i = this->find_first_non_full(h);
+                        if(growth_left_ || ctrl_[i] == hash_ctrl_deleted)
+                            return i;
+                    }
+                    this->grow();
+                    return this->find_first_non_full(h);
+                }
+                // Marks slot i full once its element has been constructed.
+                void commit_insert(size_type i, std::size_t h)
+                {
+                    if(ctrl_[i] == hash_ctrl_empty)
+                        --growth_left_;
+                    this->set_ctrl(i, h2(h));
+                    ++size_;
+                }
+                template<typename I>
+                void reserve_for(I first, I last, std::true_type)
+                {
+                    this->reserve(size_ + static_cast<size_type>(iter_distance(first, last)));
+                }
+                template<typename I>
+                void reserve_for(I, I, std::false_type)
+                {}
+            protected:
+                basic_iterator<false> make_iterator(size_type i)
+                {
+                    return {ctrl_ + i, slots_ + i};
+                }
+                basic_iterator<true> make_iterator(size_type i) const
+                {
+                    return {ctrl_ + i, slots_ + i};
+                }
+                // The index of the element with this key, or capacity() if none.
+                template<typename K>
+                size_type find_index(K const &key) const
+                {
+                    return this->find_index(key, this->hash_of(key));
+                }
+                // Finds the element with this key, or adds one built from args.
+                template<typename K, typename...Args>
+                std::pair<size_type, bool> find_or_emplace(K const &key, Args &&...args)
+                {
+                    std::size_t const h = this->hash_of(key);
+                    size_type i = this->find_index(key, h);
+                    if(i != capacity_)
+                        return {i, false};
+                    i = this->prepare_insert(h);
+                    Policy::construct(slots_ + i, std::forward<Args>(args)...);
+                    this->commit_insert(i, h);
+                    return {i, true};
+                }
+                // Adds a value whose key is known not to be in the table.
+                void insert_unique(value_type const &value)
+                {
+                    std::size_t const h = this->hash_of(Policy::key(value));
+                    size_type const i = this->prepare_insert(h);
+                    Policy::construct(slots_ + i, value);
+                    this->commit_insert(i, h);
+                }
+            public:
+                explicit flat_hash_table(size_type n = 0, Hash const &hash = Hash{},
+                    Eq const &eq = Eq{})
+                  : ctrl_(nullptr), slots_(nullptr), capacity_(0), size_(0), growth_left_(0)
+                  , hash_(hash), eq_(eq)
+                {
+                    if(n)
+                        this->reserve(n);
+                }
+                template<typename I, CONCEPT_REQUIRES_(InputIterator<I>())>
+                flat_hash_table(I first, I last, size_type n = 0, Hash const &hash = Hash{},
+                    Eq const &eq = Eq{})
+                  : flat_hash_table(n, hash, eq)
+                {
+                    this->insert(std::move(first), std::move(last));
+                }
+                flat_hash_table(std::initializer_list<value_type> il, size_type n = 0,
+                    Hash const &hash = Hash{}, Eq const &eq = Eq{})
+                  : flat_hash_table(il.begin(), il.end(), n, hash, eq)
+                {}
+                flat_hash_table(flat_hash_table const &that)
+                  : flat_hash_table(that.size_, that.hash_, that.eq_)
+                {
+                    for(auto const &value : that)
+                        this->insert_unique(value);
+                }
+                flat_hash_table(flat_hash_table &&that)
+                  : ctrl_(that.ctrl_), slots_(that.slots_), capacity_(that.capacity_)
+                  , size_(that.size_), growth_left_(that.growth_left_)
+                  , hash_(std::move(that.hash_)), eq_(std::move(that.eq_))
+                {
+                    that.ctrl_ = nullptr;
+                    that.slots_ = nullptr;
+                    that.capacity_ = that.size_ = that.growth_left_ = 0;
+                }
+                flat_hash_table &operator=(flat_hash_table const &that)
+                {
+                    if(this != &that)
+                    {
+                        flat_hash_table tmp{that};
+                        this->swap(tmp);
+                    }
+                    return *this;
+                }
+                flat_hash_table &operator=(flat_hash_table &&that)
+                {
+                    flat_hash_table tmp{std::move(that)};
+                    this->swap(tmp);
+                    return *this;
+                }
+                flat_hash_table &operator=(std::initializer_list<value_type> il)
+                {
+                    flat_hash_table tmp{il, 0, hash_, eq_};
+                    this->swap(tmp);
+                    return *this;
+                }
+                ~flat_hash_table()
+                {
+                    this->destroy_all();
+                    this->deallocate();
+                }
+                basic_iterator<Policy::const_iterators> begin()
+                {
+                    if(!size_)
+                        return this->end();
+                    basic_iterator<Policy::const_iterators> it = this->make_iterator(0);
+                    it.skip();
+                    return it;
+                }
+                basic_iterator<true> begin() const
+                {
+                    if(!size_)
+                        return this->end();
+                    auto it = this->make_iterator(0);
+                    it.skip();
+                    return it;
+                }
+                basic_iterator<Policy::const_iterators> end()
+                {
+                    return this->make_iterator(capacity_);
+                }
+                basic_iterator<true> end() const
+                {
+                    return this->make_iterator(capacity_);
+                }
+                basic_iterator<true> cbegin() const
+                {
+                    return this->begin();
+                }
+                basic_iterator<true> cend() const
+                {
+                    return this->end();
+                }
+                bool empty() const
+                {
+                    return size_ == 0;
+                }
+                size_type size() const
+                {
+                    return size_;
+                }
+                size_type max_size() const
+                {
+                    return std::numeric_limits<difference_type>::max() / sizeof(value_type);
+                }
+                /// The number of slots.
+                size_type bucket_count() const
+                {
+                    return capacity_;
+                }
+                float load_factor() const
+                {
+                    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+                }
+                float max_load_factor() const
+                {
+                    return 7.0f / 8.0f;
+                }
+                hasher hash_function() const
+                {
+                    return hash_;
+                }
+                key_equal key_eq() const
+                {
+                    return eq_;
+                }
+                /// Makes room for \p n elements in all without growing again.
+                void reserve(size_type n)
+                {
+                    if(n > size_ + growth_left_)
+                        this->resize(capacity_for(n));
+                }
+                /// Rehashes into at least \p n slots, dropping any deleted markers.
+                void rehash(size_type n)
+                {
+                    size_type const cap = std::max(capacity_for(size_), capacity_for(n));
+                    if(cap != capacity_ || size_ + growth_left_ != growth_for(capacity_))
+                        this->resize(cap);
+                }
+                void clear()
+                {
+                    if(!capacity_)
+                        return;
+                    this->destroy_all();
+                    std::fill(ctrl_, ctrl_ + capacity_ + width, hash_ctrl_empty);
+                    ctrl_[capacity_] = hash_ctrl_sentinel;
+                    size_ = 0;
+                    growth_left_ = growth_for(capacity_);
+                }
+                std::pair<basic_iterator<Policy::const_iterators>, bool>
+                insert(value_type const &value)
+                {
+                    auto const p = this->find_or_emplace(Policy::key(value), value);
+                    return {this->make_iterator(p.first), p.second};
+                }
+                std::pair<basic_iterator<Policy::const_iterators>, bool>
+                insert(value_type &&value)
+                {
+                    auto const p = this->find_or_emplace(Policy::key(value), std::move(value));
+                    return {this->make_iterator(p.first), p.second};
+                }
+                /// \overload The hint is ignored; it is accepted so that the table
+                /// works with insert iterators.
+                basic_iterator<Policy::const_iterators>
+                insert(basic_iterator<true>, value_type const &value)
+                {
+                    return this->insert(value).first;
+                }
+                /// \overload
+                basic_iterator<Policy::const_iterators>
+                insert(basic_iterator<true>, value_type &&value)
+                {
+                    return this->insert(std::move(value)).first;
+                }
+                /// \overload When the distance between the iterators can be found
+                /// cheaply, room for all of the elements is made up front.
+                template<typename I, CONCEPT_REQUIRES_(InputIterator<I>())>
+                void insert(I first, I last)
+                {
+                    this->reserve_for(first, last, ForwardIterator<I>());
+                    for(; first != last; ++first)
+                        this->emplace(*first);
+                }
+                /// \overload
+                void insert(std::initializer_list<value_type> il)
+                {
+                    this->insert(il.begin(), il.end());
+                }
+                /// Builds an element from \p args, and keeps it if its key is new.
+                template<typename...Args>
+                std::pair<basic_iterator<Policy::const_iterators>, bool> emplace(Args &&...args)
+                {
+                    value_type value(std::forward<Args>(args)...);
+                    return this->insert(std::move(value));
+                }
+                /// Removes the element at \p pos, and returns an iterator to the one
+                /// after it. The slot is marked deleted, so that the probe sequences
+                /// that pass over it are not broken.
+                basic_iterator<Policy::const_iterators> erase(basic_iterator<true> pos)
+                {
+                    size_type const i = static_cast<size_type>(pos.ctrl_ - ctrl_);
+                    RANGES_ASSERT(i < capacity_ && ctrl_[i] >= 0);
+                    slots_[i].~value_type();
+                    this->set_ctrl(i, hash_ctrl_deleted);
+                    --size_;
+                    auto it = this->make_iterator(i);
+                    ++it;
+                    return it;
+                }
+                /// \overload
+                basic_iterator<Policy::const_iterators>
+                erase(basic_iterator<true> first, basic_iterator<true> last)
+                {
+                    while(first != last)
+                        first = this->erase(first);
+                    return this->make_iterator(static_cast<size_type>(last.ctrl_ - ctrl_));
+                }
+                /// \overload
+                size_type erase(key_type const &key)
+                {
+                    size_type const i = this->find_index(key);
+                    if(i == capacity_)
+                        return 0;
+                    this->erase(this->make_iterator(i));
+                    return 1;
+                }
+                basic_iterator<Policy::const_iterators> find(key_type const &key)
+                {
+                    return this->make_iterator(this->find_index(key));
+                }
+                basic_iterator<true> find(key_type const &key) const
+                {
+                    return this->make_iterator(this->find_index(key));
+                }
+                size_type count(key_type const &key) const
+                {
+                    return this->find_index(key) != capacity_ ? 1u : 0u;
+                }
+                bool contains(key_type const &key) const
+                {
+                    return this->find_index(key) != capacity_;
+                }
+                void swap(flat_hash_table &that)
+                {
+                    using std::swap;
+                    swap(ctrl_, that.ctrl_);
+                    swap(slots_, that.slots_);
+                    swap(capacity_, that.capacity_);
+                    swap(size_, that.size_);
+                    swap(growth_left_, that.growth_left_);
+                    swap(hash_, that.hash_);
+                    swap(eq_, that.eq_);
+                }
+                friend void swap(flat_hash_table &x, flat_hash_table &y)
+                {
+                    x.swap(y);
+                }
+                friend bool operator==(flat_hash_table const &x, flat_hash_table const &y)
+                {
+                    if(x.size_ != y.size_)
+                        return false;
+                    for(auto const &value : x)
+                    {
+                        auto const i = y.find_index(Policy::key(value));
+                        if(i == y.capacity_ || !(y.slots_[i] == value))
+                            return false;
+                    }
+                    return true;
+                }
+                friend bool operator!=(flat_hash_table const &x, flat_hash_table const &y)
+                {
+                    return !(x == y);
+                }
+            };
+
+            template<typename Policy, typename Hash, typename Eq>
+            constexpr std::size_t flat_hash_table<Policy, Hash, Eq>::width;
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -0,0 +1,160 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_MAP_HPP
+#define RANGES_V3_CONTAINER_FLAT_MAP_HPP
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/container/flat_sorted_table.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Key>
+            struct flat_map_key_fn
+            {
+                template<typename T>
+                Key const &operator()(std::pair<Key, T> const &value) const
+                {
+                    return value.first;
+                }
+            };
+
+            template<typename Key>
+            struct flat_map_policy
+            {
+                using key_type = Key;
+                using key_fn = flat_map_key_fn<Key>;
+                static constexpr bool const_iterators = false;
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-containers
+        /// @{
+
+        /// An ordered map kept as a sorted sequence of `(key, value)` pairs with
+        /// unique keys, in a random-access container. It iterates and searches as
+        /// fast as the container, and composes with views and the set algorithms
+        /// like any other sorted random-access range. Inserting one element is
+        /// linear, so insert batches of elements with the iterator or range
+        /// overloads, which sort and merge once. As in other flat maps, the
+        /// elements are `std::pair<Key, T>` so that they can be moved around;
+        /// the keys must not be modified through an iterator.
+        template<typename Key, typename T, typename Compare = std::less<Key>,
+            typename Cont = std::vector<std::pair<Key, T>>>
+        struct flat_map
+          : detail::flat_sorted_table<detail::flat_map_policy<Key>, Compare, Cont>
+        {
+        private:
+            using base_t = detail::flat_sorted_table<detail::flat_map_policy<Key>, Compare, Cont>;
+        public:
+            using mapped_type = T;
+            using value_type = std::pair<Key, T>;
+            using reference = value_type &;
+            using const_reference = value_type const &;
+            using iterator = typename base_t::iterator;
+
+            struct value_compare
+            {
+                Compare comp;
+                bool operator()(value_type const &x, value_type const &y) const
+                {
+                    return comp(x.first, y.first);
+                }
+            };
+
+            using base_t::base_t;
+            flat_map() = default;
+            flat_map(std::initializer_list<value_type> il)
+              : base_t(il)
+            {}
+            flat_map &operator=(std::initializer_list<value_type> il)
+            {
+                this->base_t::operator=(il);
+                return *this;
+            }
+            value_compare value_comp() const
+            {
+                return {this->key_comp()};
+            }
+
+            /// Adds an element built from \p key and \p args, unless there is
+            /// already one with that key. Nothing is built if there is.
+            template<typename...Args>
+            std::pair<iterator, bool> try_emplace(Key const &key, Args &&...args)
+            {
+                return this->find_or_emplace(key, std::piecewise_construct,
+                    std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            /// \overload
+            template<typename...Args>
+            std::pair<iterator, bool> try_emplace(Key &&key, Args &&...args)
+            {
+                return this->find_or_emplace(key, std::piecewise_construct,
+                    std::forward_as_tuple(std::move(key)),
+                    std::forward_as_tuple(std::forward<Args>(args)...));
+            }
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(Key const &key, M &&obj)
+            {
+                auto p = this->try_emplace(key, std::forward<M>(obj));
+                if(!p.second)
+                    p.first->second = std::forward<M>(obj);
+                return p;
+            }
+            /// \overload
+            template<typename M>
+            std::pair<iterator, bool> insert_or_assign(Key &&key, M &&obj)
+            {
+                auto p = this->try_emplace(std::move(key), std::forward<M>(obj));
+                if(!p.second)
+                    p.first->second = std::forward<M>(obj);
+                return p;
+            }
+            T &operator[](Key const &key)
+            {
+                return this->try_emplace(key).first->second;
+            }
+            T &operator[](Key &&key)
+            {
+                return this->try_emplace(std::move(key)).first->second;
+            }
+            T &at(Key const &key)
+            {
+                auto const it = this->find(key);
+                if(it == this->end())
+                    throw std::out_of_range("flat_map::at");
+                return it->second;
+            }
+            T const &at(Key const &key) const
+            {
+                auto const it = this->find(key);
+                if(it == this->end())
+                    throw std::out_of_range("flat_map::at");
+                return it->second;
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
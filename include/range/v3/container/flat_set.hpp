@@ -0,0 +1,87 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_SET_HPP
+#define RANGES_V3_CONTAINER_FLAT_SET_HPP
+
+#include <vector>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/container/flat_sorted_table.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Key>
+            struct flat_set_policy
+            {
+                using key_type = Key;
+                using key_fn = ident;
+                static constexpr bool const_iterators = true;
+            };
+        }
+        /// \endcond
+
+        /// \addtogroup group-containers
+        /// @{
+
+        /// An ordered set kept as a sorted, duplicate-free sequence in a
+        /// random-access container. It iterates and searches as fast as the
+        /// container, and composes with views and the set algorithms like any
+        /// other sorted random-access range. Inserting one element is linear, so
+        /// insert batches of elements with the iterator or range overloads,
+        /// which sort and merge once.
+        template<typename Key, typename Compare = std::less<Key>,
+            typename Cont = std::vector<Key>>
+        struct flat_set
+          : detail::flat_sorted_table<detail::flat_set_policy<Key>, Compare, Cont>
+        {
+        private:
+            using base_t = detail::flat_sorted_table<detail::flat_set_policy<Key>, Compare, Cont>;
+        public:
+            using value_compare = Compare;
+            using reference = Key const &;
+            using const_reference = Key const &;
+
+            using base_t::base_t;
+            flat_set() = default;
+            flat_set(std::initializer_list<Key> il)
+              : base_t(il)
+            {}
+            flat_set &operator=(std::initializer_list<Key> il)
+            {
+                this->base_t::operator=(il);
+                return *this;
+            }
+            value_compare value_comp() const
+            {
+                return this->key_comp();
+            }
+        };
+
+        // The elements of a set are immutable, so the is_range heuristic would
+        // take it for a view.
+        template<typename Key, typename Compare, typename Cont>
+        struct is_range<flat_set<Key, Compare, Cont>>
+          : std::false_type
+        {};
+        /// @}
+    }
+}
+
+#endif
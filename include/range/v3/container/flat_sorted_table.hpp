@@ -0,0 +1,400 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_FLAT_SORTED_TABLE_HPP
+#define RANGES_V3_CONTAINER_FLAT_SORTED_TABLE_HPP
+
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <initializer_list>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/equal_range.hpp>
+#include <range/v3/algorithm/inplace_merge.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-containers
+        /// @{
+
+        /// Tag type for constructing a `flat_set` or `flat_map` from a container
+        /// that is already sorted and free of duplicate keys.
+        struct sorted_unique_t
+        {};
+
+        /// \ingroup group-containers
+        namespace
+        {
+            constexpr auto&& sorted_unique = static_const<sorted_unique_t>::value;
+        }
+        /// @}
+
+        /// \cond
+        namespace detail
+        {
+            // A sorted sequence of elements with unique keys, kept in a random-access
+            // container. Lookups are binary searches. A batch of elements is added
+            // by appending it, sorting just the batch, and merging it with the
+            // elements already there, so that inserting m elements into n costs
+            // O(m log m + n) rather than O(m n). Policy says what the elements are
+            // and how to get the key of one.
+            template<typename Policy, typename Compare, typename Cont>
+            struct flat_sorted_table
+            {
+                using key_type = typename Policy::key_type;
+                using value_type = typename Cont::value_type;
+                using container_type = Cont;
+                using key_compare = Compare;
+                using size_type = typename Cont::size_type;
+                using difference_type = typename Cont::difference_type;
+                using iterator = meta::if_c<Policy::const_iterators,
+                    typename Cont::const_iterator, typename Cont::iterator>;
+                using const_iterator = typename Cont::const_iterator;
+                using reverse_iterator = std::reverse_iterator<iterator>;
+                using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+            private:
+                using key_fn = typename Policy::key_fn;
+                Cont cont_;
+                Compare comp_;
+
+                // Adjacent elements of a sorted sequence have equivalent keys when
+                // the first does not order before the second.
+                struct equivalent
+                {
+                    Compare comp;
+                    bool operator()(key_type const &x, key_type const &y) const
+                    {
+                        return !comp(x, y);
+                    }
+                };
+                // Sorts and merges the elements from index n on into the rest,
+                // keeping the first element with each key.
+                void merge_tail(size_type n)
+                {
+                    auto const first = cont_.begin();
+                    auto const middle = first + static_cast<difference_type>(n);
+                    ranges::stable_sort(middle, cont_.end(), comp_, key_fn{});
+                    cont_.erase(ranges::unique(middle, cont_.end(), equivalent{comp_}, key_fn{}),
+                        cont_.end());
+                    if(middle == first || middle == cont_.end() ||
+                        comp_(key_fn{}(*(middle - 1)), key_fn{}(*middle)))
+                        return;
+                    ranges::inplace_merge(first, middle, cont_.end(), comp_, key_fn{});
+                    cont_.erase(ranges::unique(cont_, equivalent{comp_}, key_fn{}), cont_.end());
+                }
+                template<typename I, typename S>
+                void reserve_for(I const &first, S const &last, std::true_type)
+                {
+                    cont_.reserve(cont_.size() + static_cast<size_type>(iter_distance(first, last)));
+                }
+                template<typename I, typename S>
+                void reserve_for(I const &, S const &, std::false_type)
+                {}
+            protected:
+                // Finds the element with this key, or adds one built from args.
+                template<typename...Args>
+                std::pair<iterator, bool> find_or_emplace(key_type const &key, Args &&...args)
+                {
+                    auto it = ranges::lower_bound(cont_, key, comp_, key_fn{});
+                    if(it != cont_.end() && !comp_(key, key_fn{}(*it)))
+                        return {it, false};
+                    return {cont_.emplace(it, std::forward<Args>(args)...), true};
+                }
+            public:
+                flat_sorted_table() = default;
+                explicit flat_sorted_table(Compare const &comp)
+                  : cont_{}, comp_(comp)
+                {}
+                template<typename I, typename S,
+                    CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>())>
+                flat_sorted_table(I first, S last, Compare const &comp = Compare{})
+                  : cont_{}, comp_(comp)
+                {
+                    this->insert(std::move(first), std::move(last));
+                }
+                flat_sorted_table(std::initializer_list<value_type> il,
+                    Compare const &comp = Compare{})
+                  : flat_sorted_table(il.begin(), il.end(), comp)
+                {}
+                /// Sorts \p cont and drops all but the first element with each key.
+                explicit flat_sorted_table(Cont cont, Compare const &comp = Compare{})
+                  : cont_(std::move(cont)), comp_(comp)
+                {
+                    this->merge_tail(0);
+                }
+                /// Adopts \p cont, which must already be sorted and free of
+                /// duplicate keys.
+                flat_sorted_table(sorted_unique_t, Cont cont, Compare const &comp = Compare{})
+                  : cont_(std::move(cont)), comp_(comp)
+                {}
+                flat_sorted_table &operator=(std::initializer_list<value_type> il)
+                {
+                    cont_.clear();
+                    this->insert(il);
+                    return *this;
+                }
+
+                iterator begin()
+                {
+                    return cont_.begin();
+                }
+                const_iterator begin() const
+                {
+                    return cont_.begin();
+                }
+                iterator end()
+                {
+                    return cont_.end();
+                }
+                const_iterator end() const
+                {
+                    return cont_.end();
+                }
+                const_iterator cbegin() const
+                {
+                    return cont_.begin();
+                }
+                const_iterator cend() const
+                {
+                    return cont_.end();
+                }
+                reverse_iterator rbegin()
+                {
+                    return reverse_iterator{this->end()};
+                }
+                const_reverse_iterator rbegin() const
+                {
+                    return const_reverse_iterator{this->end()};
+                }
+                reverse_iterator rend()
+                {
+                    return reverse_iterator{this->begin()};
+                }
+                const_reverse_iterator rend() const
+                {
+                    return const_reverse_iterator{this->begin()};
+                }
+                bool empty() const
+                {
+                    return cont_.empty();
+                }
+                size_type size() const
+                {
+                    return cont_.size();
+                }
+                size_type max_size() const
+                {
+                    return cont_.max_size();
+                }
+                size_type capacity() const
+                {
+                    return cont_.capacity();
+                }
+                void reserve(size_type n)
+                {
+                    cont_.reserve(n);
+                }
+                void shrink_to_fit()
+                {
+                    cont_.shrink_to_fit();
+                }
+                key_compare key_comp() const
+                {
+                    return comp_;
+                }
+                /// The underlying sorted container.
+                Cont const &sequence() const
+                {
+                    return cont_;
+                }
+                /// Moves the underlying sorted container out, leaving this empty.
+                Cont extract()
+                {
+                    Cont cont = std::move(cont_);
+                    cont_.clear();
+                    return cont;
+                }
+
+                std::pair<iterator, bool> insert(value_type const &value)
+                {
+                    return this->find_or_emplace(key_fn{}(value), value);
+                }
+                std::pair<iterator, bool> insert(value_type &&value)
+                {
+                    return this->find_or_emplace(key_fn{}(value), std::move(value));
+                }
+                /// \overload The hint is used when the value belongs right before
+                /// it, so that inserting sorted input is linear overall.
+                iterator insert(const_iterator hint, value_type const &value)
+                {
+                    return this->insert_hint_(hint, value);
+                }
+                /// \overload
+                iterator insert(const_iterator hint, value_type &&value)
+                {
+                    return this->insert_hint_(hint, std::move(value));
+                }
+                /// \overload Appends the elements, then sorts and merges them in
+                /// one step.
+                template<typename I, typename S,
+                    CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>())>
+                void insert(I first, S last)
+                {
+                    size_type const n = cont_.size();
+                    this->reserve_for(first, last, SizedIteratorRange<I, S>());
+                    for(; first != last; ++first)
+                        cont_.emplace_back(*first);
+                    this->merge_tail(n);
+                }
+                /// \overload
+                void insert(std::initializer_list<value_type> il)
+                {
+                    this->insert(il.begin(), il.end());
+                }
+                /// Builds an element from \p args, and keeps it if its key is new.
+                template<typename...Args>
+                std::pair<iterator, bool> emplace(Args &&...args)
+                {
+                    value_type value(std::forward<Args>(args)...);
+                    return this->insert(std::move(value));
+                }
+                iterator erase(const_iterator pos)
+                {
+                    return cont_.erase(pos);
+                }
+                iterator erase(const_iterator first, const_iterator last)
+                {
+                    return cont_.erase(first, last);
+                }
+                size_type erase(key_type const &key)
+                {
+                    auto const rng = this->equal_range(key);
+                    auto const n = static_cast<size_type>(rng.second - rng.first);
+                    cont_.erase(rng.first, rng.second);
+                    return n;
+                }
+                void clear()
+                {
+                    cont_.clear();
+                }
+                void swap(flat_sorted_table &that)
+                {
+                    using std::swap;
+                    swap(cont_, that.cont_);
+                    swap(comp_, that.comp_);
+                }
+                friend void swap(flat_sorted_table &x, flat_sorted_table &y)
+                {
+                    x.swap(y);
+                }
+
+                iterator find(key_type const &key)
+                {
+                    auto const it = this->lower_bound(key);
+                    return it != this->end() && !comp_(key, key_fn{}(*it)) ? it : this->end();
+                }
+                const_iterator find(key_type const &key) const
+                {
+                    auto const it = this->lower_bound(key);
+                    return it != this->end() && !comp_(key, key_fn{}(*it)) ? it : this->end();
+                }
+                size_type count(key_type const &key) const
+                {
+                    return this->find(key) != this->end() ? 1u : 0u;
+                }
+                bool contains(key_type const &key) const
+                {
+                    return this->find(key) != this->end();
+                }
+                iterator lower_bound(key_type const &key)
+                {
+                    return ranges::lower_bound(cont_, key, comp_, key_fn{});
+                }
+                const_iterator lower_bound(key_type const &key) const
+                {
+                    return ranges::lower_bound(cont_, key, comp_, key_fn{});
+                }
+                iterator upper_bound(key_type const &key)
+                {
+                    return ranges::upper_bound(cont_, key, comp_, key_fn{});
+                }
+                const_iterator upper_bound(key_type const &key) const
+                {
+                    return ranges::upper_bound(cont_, key, comp_, key_fn{});
+                }
+                std::pair<iterator, iterator> equal_range(key_type const &key)
+                {
+                    auto const rng = ranges::equal_range(cont_, key, comp_, key_fn{});
+                    return {rng.begin(), rng.end()};
+                }
+                std::pair<const_iterator, const_iterator> equal_range(key_type const &key) const
+                {
+                    auto const rng = ranges::equal_range(cont_, key, comp_, key_fn{});
+                    return {rng.begin(), rng.end()};
+                }
+
+                friend bool operator==(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return x.cont_ == y.cont_;
+                }
+                friend bool operator!=(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return !(x == y);
+                }
+                friend bool operator<(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return x.cont_ < y.cont_;
+                }
+                friend bool operator>(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return y < x;
+                }
+                friend bool operator<=(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return !(y < x);
+                }
+                friend bool operator>=(flat_sorted_table const &x, flat_sorted_table const &y)
+                {
+                    return !(x < y);
+                }
+            private:
+                template<typename V>
+                iterator insert_hint_(const_iterator hint, V &&value)
+                {
+                    auto const &key = key_fn{}(value);
+                    auto const first = cont_.cbegin();
+                    if((hint == cont_.cend() || comp_(key, key_fn{}(*hint))) &&
+                        (hint == first || comp_(key_fn{}(*(hint - 1)), key)))
+                        return cont_.insert(hint, std::forward<V>(value));
+                    return this->insert(std::forward<V>(value)).first;
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
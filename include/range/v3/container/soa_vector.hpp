@@ -0,0 +1,302 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_CONTAINER_SOA_VECTOR_HPP
+#define RANGES_V3_CONTAINER_SOA_VECTOR_HPP
+
+#include <tuple>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <stdexcept>
+#include <initializer_list>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/integer_sequence.hpp>
+#include <range/v3/view/zip.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-containers
+        /// @{
+
+        /// A sequence of records whose fields are each kept in a `std::vector`
+        /// of their own, so that a scan over one field touches only that field's
+        /// memory. It iterates like `view::zip` over its columns: the reference
+        /// type is a `common_tuple` (or `common_pair`, for two fields) of
+        /// references into the columns, and `iter_swap` and `iter_move` act on
+        /// every column at once, so the mutating algorithms, such as `sort`,
+        /// `partition` and `unique`, permute whole records. `column<I>()` is the
+        /// contiguous range of field `I`, for loops that need only that field.
+        template<typename...Ts>
+        struct soa_vector
+        {
+        private:
+            CONCEPT_ASSERT_MSG(sizeof...(Ts) != 0,
+                "soa_vector needs at least one field");
+            using columns_t = std::tuple<std::vector<Ts>...>;
+            using indices_t = make_index_sequence<sizeof...(Ts)>;
+            template<std::size_t I>
+            using field_t = meta::list_element_c<I, meta::list<Ts...>>;
+            using view_t = zip_view<range<typename std::vector<Ts>::iterator>...>;
+            using const_view_t = zip_view<range<typename std::vector<Ts>::const_iterator>...>;
+            columns_t columns_;
+
+            template<std::size_t...Is>
+            view_t view_(index_sequence<Is...>)
+            {
+                return view_t{{std::get<Is>(columns_).begin(), std::get<Is>(columns_).end()}...};
+            }
+            template<std::size_t...Is>
+            const_view_t view_(index_sequence<Is...>) const
+            {
+                return const_view_t{{std::get<Is>(columns_).cbegin(),
+                    std::get<Is>(columns_).cend()}...};
+            }
+            // Appends one field to each column. If a column throws, the fields
+            // already appended to the others are removed again, so a failed
+            // append leaves the columns as they were.
+            template<std::size_t...Is, typename...Args>
+            void emplace_back_(index_sequence<Is...>, Args &&...args)
+            {
+                std::size_t done = 0;
+                try
+                {
+                    (void)std::initializer_list<int>{
+                        ((void)std::get<Is>(columns_).emplace_back(std::forward<Args>(args)),
+                            ++done, 42)...};
+                }
+                catch(...)
+                {
+                    (void)std::initializer_list<int>{
+                        (Is < done ? std::get<Is>(columns_).pop_back() : void(), 42)...};
+                    throw;
+                }
+            }
+            template<typename V, std::size_t...Is>
+            void push_back_(V &&v, index_sequence<Is...> is)
+            {
+                this->emplace_back_(is, std::get<Is>(std::forward<V>(v))...);
+            }
+            template<std::size_t...Is>
+            void resize_(std::size_t n, index_sequence<Is...>)
+            {
+                auto const old = this->size();
+                try
+                {
+                    (void)std::initializer_list<int>{
+                        ((void)std::get<Is>(columns_).resize(n), 42)...};
+                }
+                catch(...)
+                {
+                    (void)std::initializer_list<int>{
+                        ((void)(std::get<Is>(columns_).size() > old ?
+                            std::get<Is>(columns_).resize(old) : void()), 42)...};
+                    throw;
+                }
+            }
+            template<std::size_t...Is>
+            void reserve_(std::size_t n, index_sequence<Is...>)
+            {
+                (void)std::initializer_list<int>{
+                    ((void)std::get<Is>(columns_).reserve(n), 42)...};
+            }
+            template<std::size_t...Is>
+            void erase_(std::size_t first, std::size_t last, index_sequence<Is...>)
+            {
+                (void)std::initializer_list<int>{
+                    ((void)std::get<Is>(columns_).erase(
+                        std::get<Is>(columns_).begin() + static_cast<std::ptrdiff_t>(first),
+                        std::get<Is>(columns_).begin() + static_cast<std::ptrdiff_t>(last)),
+                    42)...};
+            }
+        public:
+            using iterator = range_iterator_t<view_t>;
+            using const_iterator = range_iterator_t<const_view_t>;
+            using value_type = iterator_value_t<iterator>;
+            using reference = iterator_reference_t<iterator>;
+            using const_reference = iterator_reference_t<const_iterator>;
+            using size_type = std::size_t;
+            using difference_type = iterator_difference_t<iterator>;
+
+            soa_vector() = default;
+            explicit soa_vector(size_type n)
+              : columns_(std::vector<Ts>(n)...)
+            {}
+            soa_vector(std::initializer_list<value_type> il)
+            {
+                this->reserve(il.size());
+                for(auto const &v : il)
+                    this->push_back(v);
+            }
+
+            iterator begin()
+            {
+                return this->view_(indices_t{}).begin();
+            }
+            iterator end()
+            {
+                return this->view_(indices_t{}).end();
+            }
+            const_iterator begin() const
+            {
+                return this->view_(indices_t{}).begin();
+            }
+            const_iterator end() const
+            {
+                return this->view_(indices_t{}).end();
+            }
+            const_iterator cbegin() const
+            {
+                return this->begin();
+            }
+            const_iterator cend() const
+            {
+                return this->end();
+            }
+
+            size_type size() const
+            {
+                return std::get<0>(columns_).size();
+            }
+            bool empty() const
+            {
+                return std::get<0>(columns_).empty();
+            }
+            void reserve(size_type n)
+            {
+                this->reserve_(n, indices_t{});
+            }
+            /// Grows or shrinks every column to \p n fields; new records are
+            /// value-initialized.
+            void resize(size_type n)
+            {
+                this->resize_(n, indices_t{});
+            }
+            void clear() noexcept
+            {
+                this->erase_(0, this->size(), indices_t{});
+            }
+
+            reference operator[](size_type n)
+            {
+                return this->begin()[static_cast<difference_type>(n)];
+            }
+            const_reference operator[](size_type n) const
+            {
+                return this->begin()[static_cast<difference_type>(n)];
+            }
+            reference at(size_type n)
+            {
+                if(n >= this->size())
+                    throw std::out_of_range("soa_vector::at");
+                return (*this)[n];
+            }
+            const_reference at(size_type n) const
+            {
+                if(n >= this->size())
+                    throw std::out_of_range("soa_vector::at");
+                return (*this)[n];
+            }
+            reference front()
+            {
+                return *this->begin();
+            }
+            const_reference front() const
+            {
+                return *this->begin();
+            }
+            reference back()
+            {
+                return *(this->end() - 1);
+            }
+            const_reference back() const
+            {
+                return *(this->end() - 1);
+            }
+
+            /// The contiguous range of field \p I of every record.
+            template<std::size_t I>
+            range<typename std::vector<field_t<I>>::iterator> column()
+            {
+                auto &col = std::get<I>(columns_);
+                return {col.begin(), col.end()};
+            }
+            /// \overload
+            template<std::size_t I>
+            range<typename std::vector<field_t<I>>::const_iterator> column() const
+            {
+                auto &col = std::get<I>(columns_);
+                return {col.cbegin(), col.cend()};
+            }
+
+            /// Appends a record, building each field from the corresponding
+            /// argument.
+            template<typename...Args,
+                CONCEPT_REQUIRES_(sizeof...(Args) == sizeof...(Ts) &&
+                    meta::and_c<(bool) Constructible<Ts, Args &&>()...>::value)>
+            void emplace_back(Args &&...args)
+            {
+                this->emplace_back_(indices_t{}, std::forward<Args>(args)...);
+            }
+            void push_back(value_type const &v)
+            {
+                this->push_back_(v, indices_t{});
+            }
+            void push_back(value_type &&v)
+            {
+                this->push_back_(std::move(v), indices_t{});
+            }
+            void pop_back()
+            {
+                this->erase_(this->size() - 1, this->size(), indices_t{});
+            }
+            iterator erase(iterator first, iterator last)
+            {
+                auto const b = this->begin();
+                auto const i = static_cast<size_type>(first - b);
+                this->erase_(i, static_cast<size_type>(last - b), indices_t{});
+                return this->begin() + static_cast<difference_type>(i);
+            }
+            iterator erase(iterator pos)
+            {
+                return this->erase(pos, pos + 1);
+            }
+
+            void swap(soa_vector &that) noexcept
+            {
+                columns_.swap(that.columns_);
+            }
+            friend void swap(soa_vector &x, soa_vector &y) noexcept
+            {
+                x.swap(y);
+            }
+            friend bool operator==(soa_vector const &x, soa_vector const &y)
+            {
+                return x.columns_ == y.columns_;
+            }
+            friend bool operator!=(soa_vector const &x, soa_vector const &y)
+            {
+                return !(x == y);
+            }
+        };
+        /// @}
+    }
+}
+
+#endif
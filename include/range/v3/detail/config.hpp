@@ -47,6 +47,14 @@
 #define RANGES_CXX_NO_VARIABLE_TEMPLATES 1
 #endif
 
+// Functions that C++14's relaxed rules for constexpr allow to be constexpr,
+// with loops, local variables and mutation, but C++11's do not.
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304
+#define RANGES_CXX14_CONSTEXPR constexpr
+#else
+#define RANGES_CXX14_CONSTEXPR
+#endif
+
 #ifndef RANGES_THREAD_LOCAL
 #if (defined(__clang__) && defined(__CYGWIN__)) || \
     (defined(__clang__) && defined(_LIBCPP_VERSION)) // BUGBUG avoid unresolved __cxa_thread_atexit
@@ -56,6 +64,13 @@
 #endif
 #endif
 
+// Define RANGES_NO_SSE2 to use only portable code where SSE2 would otherwise be used.
+#ifndef RANGES_NO_SSE2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RANGES_SSE2 1
+#endif
+#endif
+
 #if __cplusplus > 201103
 #define RANGES_DEPRECATED(MSG) [[deprecated(MSG)]]
 #else
@@ -36,12 +36,12 @@ namespace ranges
         {
         private:
             template<typename Rng, typename D, typename I = range_iterator_t<Rng>>
-            std::pair<D, I> impl_r(Rng &rng, D d, concepts::Iterable*, concepts::Iterable*) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> impl_r(Rng &rng, D d, concepts::Iterable*, concepts::Iterable*) const
             {
                 return iter_enumerate(begin(rng), end(rng), d);
             }
             template<typename Rng, typename D, typename I = range_iterator_t<Rng>>
-            std::pair<D, I> impl_r(Rng &rng, D d, concepts::BoundedIterable*, concepts::SizedIterable*) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> impl_r(Rng &rng, D d, concepts::BoundedIterable*, concepts::SizedIterable*) const
             {
                 return {static_cast<D>(size(rng)) + d, end(rng)};
             }
@@ -51,7 +51,7 @@ namespace ranges
             template<typename Rng, typename D = range_difference_t<Rng>,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Integral<D>() && Iterable<Rng>())>
-            std::pair<D, I> operator()(Rng &&rng, D d = 0) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> operator()(Rng &&rng, D d = 0) const
             {
                 static_assert(!is_infinite<Rng>::value,
                     "Trying to compute the length of an infinite range!");
@@ -71,12 +71,12 @@ namespace ranges
         {
         private:
             template<typename Rng, typename D>
-            D impl_r(Rng &rng, D d, concepts::Iterable*) const
+            RANGES_CXX14_CONSTEXPR D impl_r(Rng &rng, D d, concepts::Iterable*) const
             {
                 return enumerate(rng, d).first;
             }
             template<typename Rng, typename D>
-            D impl_r(Rng &rng, D d, concepts::SizedIterable*) const
+            RANGES_CXX14_CONSTEXPR D impl_r(Rng &rng, D d, concepts::SizedIterable*) const
             {
                 return static_cast<D>(size(rng)) + d;
             }
@@ -85,7 +85,7 @@ namespace ranges
 
             template<typename Rng, typename D = range_difference_t<Rng>,
                 CONCEPT_REQUIRES_(Integral<D>() && Iterable<Rng>())>
-            D operator()(Rng &&rng, D d = 0) const
+            RANGES_CXX14_CONSTEXPR D operator()(Rng &&rng, D d = 0) const
             {
                 static_assert(!is_infinite<Rng>::value,
                     "Trying to compute the length of an infinite range!");
@@ -106,19 +106,19 @@ namespace ranges
         private:
             template<typename Rng,
                 CONCEPT_REQUIRES_(!is_infinite<Rng>())>
-            int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::Iterable*) const
+            RANGES_CXX14_CONSTEXPR int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::Iterable*) const
             {
                 return iter_distance_compare(begin(rng), end(rng), n);
             }
             template<typename Rng,
                 CONCEPT_REQUIRES_(is_infinite<Rng>())>
-            int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::Iterable*) const
+            RANGES_CXX14_CONSTEXPR int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::Iterable*) const
             {
                 // Infinite ranges are always compared to be larger than a finite number.
                 return 1;
             }
             template<typename Rng>
-            int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::SizedIterable*) const
+            RANGES_CXX14_CONSTEXPR int impl_r(Rng &rng, range_difference_t<Rng> n, concepts::SizedIterable*) const
             {
                 auto dist = distance(rng); // O(1) since rng is a SizedIterable
                 if (dist > n)
@@ -133,7 +133,7 @@ namespace ranges
 
             template<typename Rng,
                 CONCEPT_REQUIRES_(Iterable<Rng>())>
-            int operator()(Rng &&rng, range_difference_t<Rng> n) const
+            RANGES_CXX14_CONSTEXPR int operator()(Rng &&rng, range_difference_t<Rng> n) const
             {
                 return this->impl_r(rng, n, sized_iterable_concept<Rng>());
             }
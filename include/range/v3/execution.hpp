@@ -0,0 +1,39 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_EXECUTION_HPP
+#define RANGES_V3_EXECUTION_HPP
+
+#include <range/v3/detail/disable_warnings.hpp>
+
+#include <range/v3/execution/algorithm/copy_if.hpp>
+#include <range/v3/execution/algorithm/count_if.hpp>
+#include <range/v3/execution/algorithm/for_each.hpp>
+#include <range/v3/execution/algorithm/partition.hpp>
+#include <range/v3/execution/algorithm/partition_copy.hpp>
+#include <range/v3/execution/algorithm/remove_copy_if.hpp>
+#include <range/v3/execution/algorithm/sort.hpp>
+#include <range/v3/execution/algorithm/stable_partition.hpp>
+#include <range/v3/execution/algorithm/transform.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/numeric/accumulate.hpp>
+#include <range/v3/execution/parallel_compact.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+#include <range/v3/execution/parallel_invoke.hpp>
+#include <range/v3/execution/per_thread.hpp>
+#include <range/v3/execution/policy.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+#include <range/v3/detail/re_enable_warnings.hpp>
+
+#endif
@@ -0,0 +1,98 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_COPY_IF_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_COPY_IF_HPP
+
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_compact.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename O, typename F, typename P>
+                O copy_if_(sequenced_policy, I begin, iterator_difference_t<I> n, O out,
+                    F &pred, P &proj)
+                {
+                    return copy_if_fn{}(begin, begin + n, out, std::ref(pred),
+                        std::ref(proj)).second;
+                }
+
+                template<typename I, typename O, typename F, typename P>
+                O copy_if_(parallel_policy const &policy, I begin, iterator_difference_t<I> n,
+                    O out, F &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    D const total = execution::parallel_compact(policy, n,
+                        [&](D i) -> bool { return pred(proj(*(begin + i))); },
+                        [&](D lo, D hi, unsigned char const *mask, D offset)
+                        {
+                            detail::compact_copy(begin + lo, begin + hi, mask, out + offset,
+                                detail::branchless_compactable<I>{});
+                        });
+                    return out + total;
+                }
+            }
+
+            // The execution policy variants of `copy_if`. With `par`, the selected
+            // elements are found in parallel, their positions in the output are
+            // computed with a prefix sum, and they are copied there in parallel. The
+            // predicate is called exactly once per element, possibly from several
+            // threads at once.
+            template<typename E, typename I, typename S, typename O, typename F,
+                typename P = ident,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I, S>() && RandomAccessIterator<O>() &&
+                    IndirectInvokablePredicate<F, Project<I, P> >() &&
+                    IndirectlyCopyable<I, O>())>
+            std::pair<I, O>
+            policy_copy_if(E &&policy, I begin, S end, O out, F pred_, P proj_ = P{})
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                auto const n = end - begin;
+                return {begin + n, detail::copy_if_(policy, begin, n, out, pred, proj)};
+            }
+
+            template<typename E, typename Rng, typename O, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng &>() && RandomAccessIterator<O>() &&
+                    IndirectInvokablePredicate<F, Project<I, P> >() && IndirectlyCopyable<I, O>())>
+            std::pair<I, O>
+            policy_copy_if(E &&policy, Rng &rng, O out, F pred, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_copy_if(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(out), std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
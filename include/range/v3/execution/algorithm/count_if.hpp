@@ -0,0 +1,97 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_COUNT_IF_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_COUNT_IF_HPP
+
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+#include <range/v3/execution/per_thread.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename R, typename P>
+                iterator_difference_t<I> count_if_(sequenced_policy, I begin,
+                    iterator_difference_t<I> n, R &pred, P &proj)
+                {
+                    return count_if_fn{}(begin, begin + n, std::ref(pred), std::ref(proj));
+                }
+
+                // Each thread counts into its own slot; the slots are summed at the
+                // end.
+                template<typename I, typename R, typename P>
+                iterator_difference_t<I> count_if_(parallel_policy const &policy, I begin,
+                    iterator_difference_t<I> n, R &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    per_thread<D> counts{policy.pool(), D(0)};
+                    execution::parallel_for(policy, n, [&](D lo, D hi)
+                    {
+                        D c = 0;
+                        for(auto it = begin + lo, last = begin + hi; it != last; ++it)
+                            if(pred(proj(*it)))
+                                ++c;
+                        counts.local() += c;
+                    });
+                    D total = 0;
+                    counts.for_each([&](D c) { total += c; });
+                    return total;
+                }
+            }
+
+            // The execution policy variants of `count_if`.
+            template<typename E, typename I, typename S, typename R, typename P = ident,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I, S>() &&
+                    IndirectInvokablePredicate<R, Project<I, P> >())>
+            iterator_difference_t<I>
+            policy_count_if(E &&policy, I begin, S end, R pred_, P proj_ = P{})
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return detail::count_if_(policy, begin, end - begin, pred, proj);
+            }
+
+            template<typename E, typename Rng, typename R, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng>() &&
+                    IndirectInvokablePredicate<R, Project<I, P> >())>
+            iterator_difference_t<I>
+            policy_count_if(E &&policy, Rng &&rng, R pred, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_count_if(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,72 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_FOR_EACH_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_FOR_EACH_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            // The execution policy variants of `for_each`. The range is divided into
+            // index intervals that are processed concurrently, so the function may be
+            // called from several threads at once.
+            template<typename E, typename I, typename S, typename F, typename P = ident,
+                typename V = iterator_common_reference_t<I>,
+                typename X = concepts::Invokable::result_t<P, V>,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I, S>() &&
+                    IndirectInvokable<F, Project<I, P>>())>
+            I policy_for_each(E &&policy, I begin, S end, F fun_, P proj_ = P{})
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                auto const n = end - begin;
+                execution::parallel_for(policy, n,
+                    [&](iterator_difference_t<I> lo, iterator_difference_t<I> hi)
+                    {
+                        for(auto it = begin + lo, last = begin + hi; it != last; ++it)
+                            fun(proj(*it));
+                    });
+                return begin + n;
+            }
+
+            template<typename E, typename Rng, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng &>() &&
+                    IndirectInvokable<F, Project<I, P>>())>
+            I policy_for_each(E &&policy, Rng &rng, F fun, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_for_each(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(fun), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,146 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_PARTITION_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_PARTITION_HPP
+
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/swap.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename C, typename P>
+                I partition_(sequenced_policy, I begin, iterator_difference_t<I> n, C &pred,
+                    P &proj)
+                {
+                    return partition_fn{}(begin, begin + n, std::ref(pred), std::ref(proj));
+                }
+
+                // A run of misplaced elements: its offset within the sequence of all
+                // misplaced elements of its kind, and its position in the range.
+                template<typename D>
+                using partition_run = std::pair<D, D>;
+
+                template<typename D>
+                void add_partition_run(std::vector<partition_run<D>> &runs, D &count, D first,
+                    D last)
+                {
+                    if(first < last)
+                    {
+                        runs.emplace_back(count, first);
+                        count += last - first;
+                    }
+                }
+
+                // Each block is partitioned on its own, in parallel. If t elements
+                // satisfy the predicate in all, the rejected elements left in [0, t)
+                // and the accepted elements left in [t, n) are equal in number. They
+                // are collected as runs and swapped with each other, in parallel.
+                template<typename I, typename C, typename P>
+                I partition_(parallel_policy const &policy, I begin, iterator_difference_t<I> n,
+                    C &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    using run = partition_run<D>;
+                    D const block = detail::parallel_grain(policy.pool(), n);
+                    D const nblocks = (n + block - 1) / block;
+                    std::vector<D> mids(static_cast<std::size_t>(nblocks));
+                    execution::parallel_for(policy, nblocks, D(1), [&](D b0, D b1)
+                    {
+                        for(; b0 != b1; ++b0)
+                        {
+                            D const lo = b0 * block, hi = n - lo < block ? n : lo + block;
+                            mids[static_cast<std::size_t>(b0)] = partition_fn{}(begin + lo,
+                                begin + hi, std::ref(pred), std::ref(proj)) - begin;
+                        }
+                    });
+                    D t = 0;
+                    for(D b = 0; b != nblocks; ++b)
+                        t += mids[static_cast<std::size_t>(b)] - b * block;
+                    std::vector<run> rejected, accepted;
+                    D nrejected = 0, naccepted = 0;
+                    for(D b = 0; b != nblocks; ++b)
+                    {
+                        D const lo = b * block, hi = n - lo < block ? n : lo + block;
+                        D const mid = mids[static_cast<std::size_t>(b)];
+                        detail::add_partition_run(rejected, nrejected, mid, hi < t ? hi : t);
+                        detail::add_partition_run(accepted, naccepted, lo < t ? t : lo, mid);
+                    }
+                    RANGES_ASSERT(nrejected == naccepted);
+                    auto seek = [](std::vector<run> const &runs, D k)
+                    {
+                        return upper_bound(runs, k, ordered_less{}, &run::first) - 1;
+                    };
+                    execution::parallel_for(policy, nrejected, [&](D k0, D k1)
+                    {
+                        auto r = seek(rejected, k0), a = seek(accepted, k0);
+                        D rpos = r->second + (k0 - r->first), apos = a->second + (k0 - a->first);
+                        for(; k0 != k1; ++k0, ++rpos, ++apos)
+                        {
+                            if(r + 1 != rejected.end() && (r + 1)->first == k0)
+                                rpos = (++r)->second;
+                            if(a + 1 != accepted.end() && (a + 1)->first == k0)
+                                apos = (++a)->second;
+                            ranges::iter_swap(begin + rpos, begin + apos);
+                        }
+                    });
+                    return begin + t;
+                }
+            }
+
+            // The execution policy variants of `partition`. The order of the
+            // elements within each part is unspecified, as for the serial algorithm.
+            template<typename E, typename I, typename S, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(Partitionable<I, C, P>() && SplittableIteratorRange<I, S>())>
+            I policy_partition(E &&policy, I begin, S end, C pred_, P proj_ = P{})
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                return detail::partition_(policy, begin, end - begin, pred, proj);
+            }
+
+            template<typename E, typename Rng, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Partitionable<I, C, P>() && SplittableIterable<Rng &>())>
+            I policy_partition(E &&policy, Rng &rng, C pred, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_partition(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
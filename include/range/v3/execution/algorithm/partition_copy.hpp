@@ -0,0 +1,102 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_PARTITION_COPY_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_PARTITION_COPY_HPP
+
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/partition_copy.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_compact.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename O0, typename O1, typename C, typename P>
+                std::tuple<I, O0, O1> partition_copy_(sequenced_policy, I begin,
+                    iterator_difference_t<I> n, O0 o0, O1 o1, C &pred, P &proj)
+                {
+                    return partition_copy_fn{}(begin, begin + n, o0, o1, std::ref(pred),
+                        std::ref(proj));
+                }
+
+                // Every block writes its selected elements to o0 after those of the
+                // blocks before it, and the rest to o1 after the rest of the blocks
+                // before it.
+                template<typename I, typename O0, typename O1, typename C, typename P>
+                std::tuple<I, O0, O1> partition_copy_(parallel_policy const &policy, I begin,
+                    iterator_difference_t<I> n, O0 o0, O1 o1, C &pred, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    D const total = execution::parallel_compact(policy, n,
+                        [&](D i) -> bool { return pred(proj(*(begin + i))); },
+                        [&](D lo, D hi, unsigned char const *mask, D offset)
+                        {
+                            detail::partition_copy_block(begin + lo, begin + hi, mask,
+                                o0 + offset, o1 + (lo - offset),
+                                detail::branchless_compactable<I>{});
+                        });
+                    return std::tuple<I, O0, O1>{begin + n, o0 + total, o1 + (n - total)};
+                }
+            }
+
+            // The execution policy variants of `partition_copy`; see `copy_if`.
+            template<typename E, typename I, typename S, typename O0, typename O1, typename C,
+                typename P = ident,
+                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() &&
+                    SplittableIteratorRange<I, S>() && RandomAccessIterator<O0>() &&
+                    RandomAccessIterator<O1>())>
+            std::tuple<I, O0, O1>
+            policy_partition_copy(E &&policy, I begin, S end, O0 o0, O1 o1, C pred_,
+                P proj_ = P{})
+            {
+                auto && pred = invokable(pred_);
+                auto && proj = invokable(proj_);
+                return detail::partition_copy_(policy, begin, end - begin, o0, o1, pred, proj);
+            }
+
+            template<typename E, typename Rng, typename O0, typename O1, typename C,
+                typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(PartitionCopyable<I, O0, O1, C, P>() &&
+                    SplittableIterable<Rng &>() && RandomAccessIterator<O0>() &&
+                    RandomAccessIterator<O1>())>
+            std::tuple<I, O0, O1>
+            policy_partition_copy(E &&policy, Rng &rng, O0 o0, O1 o1, C pred, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_partition_copy(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(o0), std::move(o1), std::move(pred),
+                    std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
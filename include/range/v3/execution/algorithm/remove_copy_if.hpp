@@ -0,0 +1,65 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_REMOVE_COPY_IF_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_REMOVE_COPY_IF_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/remove_copy_if.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/algorithm/copy_if.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            // The execution policy variants of `remove_copy_if`; see `copy_if`.
+            template<typename E, typename I, typename S, typename O, typename C,
+                typename P = ident,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() &&
+                    SplittableIteratorRange<I, S>() && RandomAccessIterator<O>())>
+            std::pair<I, O> policy_remove_copy_if(E &&policy, I begin, S end, O out, C pred,
+                P proj = P{})
+            {
+                return execution::policy_copy_if(std::forward<E>(policy), std::move(begin),
+                    std::move(end), std::move(out), not_(invokable(std::move(pred))),
+                    std::move(proj));
+            }
+
+            template<typename E, typename Rng, typename O, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(RemoveCopyableIf<I, O, C, P>() &&
+                    SplittableIterable<Rng &>() && RandomAccessIterator<O>())>
+            std::pair<I, O> policy_remove_copy_if(E &&policy, Rng &rng, O out, C pred,
+                P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_remove_copy_if(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(out), std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
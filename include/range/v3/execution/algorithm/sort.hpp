@@ -0,0 +1,128 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_SORT_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_SORT_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                struct parallel_sort
+                {
+                    // Partitions down to pieces of at most cutoff elements, handing
+                    // the upper part of each split to the pool and sorting the pieces
+                    // serially. The pivot is chosen and parked as in the serial
+                    // introsort, and is then put in its final place between the two
+                    // parts.
+                    template<typename I, typename Size, typename C, typename P>
+                    static void introsort_loop(task_group &grp, I begin, I end,
+                        Size depth_limit, iterator_difference_t<I> cutoff, C &pred, P &proj)
+                    {
+                        while(end - begin > cutoff && depth_limit != 0)
+                        {
+                            ranges::iter_swap(begin, sort_fn::median_of_three(next(begin),
+                                begin + (end - begin) / 2, end - 1, pred, proj));
+                            I cut = ranges::detail::unguarded_partition(next(begin), end,
+                                proj(*begin), pred, proj);
+                            ranges::iter_swap(begin, prev(cut));
+                            --depth_limit;
+                            grp.run([&grp, cut, end, depth_limit, cutoff, &pred, &proj]
+                            {
+                                parallel_sort::introsort_loop(grp, cut, end, depth_limit,
+                                    cutoff, pred, proj);
+                            });
+                            end = prev(cut);
+                        }
+                        sort_fn::introsort_loop(begin, end, depth_limit, pred, proj);
+                        sort_fn::final_insertion_sort(begin, end, pred, proj);
+                    }
+
+                    template<typename I, typename C, typename P>
+                    static void sort_(sequenced_policy, I begin, I end, C &pred, P &proj)
+                    {
+                        sort_fn::introsort_loop(begin, end, sort_fn::log2(end - begin) * 2,
+                            pred, proj);
+                        sort_fn::final_insertion_sort(begin, end, pred, proj);
+                    }
+
+                    template<typename I, typename C, typename P>
+                    static void sort_(parallel_policy const &policy, I begin, I end, C &pred,
+                        P &proj)
+                    {
+                        auto const n = end - begin;
+                        task_group grp{policy.pool()};
+                        auto const cutoff = detail::parallel_grain(grp.pool(), n);
+                        auto root = [&]
+                        {
+                            parallel_sort::introsort_loop(grp, begin, end,
+                                sort_fn::log2(n) * 2, cutoff, pred, proj);
+                        };
+                        grp.invoke(root);
+                        grp.wait();
+                    }
+                };
+            }
+
+            // The execution policy variants of `sort`. With `par`, the range is
+            // partitioned in parallel and the partitions are sorted concurrently, so
+            // the comparison and projection may be called from several threads at
+            // once.
+            template<typename E, typename I, typename S, typename C = ordered_less,
+                typename P = ident,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() &&
+                    RandomAccessIterator<I>() && IteratorRange<I, S>())>
+            I policy_sort(E &&policy, I begin, S end_, C pred_ = C{}, P proj_ = P{})
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                if(begin == end_)
+                    return begin;
+                I end = next_to(begin, end_);
+                detail::parallel_sort::sort_(policy, begin, end, pred, proj);
+                return end;
+            }
+
+            template<typename E, typename Rng, typename C = ordered_less, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(Sortable<I, C, P>() &&
+                    RandomAccessIterable<Rng &>())>
+            I policy_sort(E &&policy, Rng & rng, C pred = C{}, P proj = P{})
+            {
+                return execution::policy_sort(std::forward<E>(policy), begin(rng), end(rng),
+                    std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,127 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_STABLE_PARTITION_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_STABLE_PARTITION_HPP
+
+#include <utility>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/swap.hpp>
+#include <range/v3/algorithm/rotate.hpp>
+#include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+#include <range/v3/execution/parallel_invoke.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename C, typename P>
+                I stable_partition_(sequenced_policy, I begin, iterator_difference_t<I> n,
+                    C &pred, P &proj)
+                {
+                    return stable_partition_fn{}(begin, begin + n, std::ref(pred),
+                        std::ref(proj));
+                }
+
+                template<typename I>
+                void parallel_reverse(parallel_policy const &policy, I begin, I end)
+                {
+                    using D = iterator_difference_t<I>;
+                    execution::parallel_for(policy, (end - begin) / 2, [&](D lo, D hi)
+                    {
+                        for(; lo != hi; ++lo)
+                            ranges::iter_swap(begin + lo, end - (lo + 1));
+                    });
+                }
+
+                // Rotates by three reversals, each of which is spread over the pool.
+                template<typename I>
+                I parallel_rotate(parallel_policy const &policy, I begin, I middle, I end)
+                {
+                    if(end - begin <= detail::parallel_grain(policy.pool(), end - begin))
+                        return rotate(begin, middle, end).begin();
+                    detail::parallel_reverse(policy, begin, middle);
+                    detail::parallel_reverse(policy, middle, end);
+                    detail::parallel_reverse(policy, begin, end);
+                    return begin + (end - middle);
+                }
+
+                // The two halves are stably partitioned concurrently, giving
+                // [T0 F0][T1 F1]; rotating F0 T1 then yields [T0 T1][F0 F1].
+                template<typename I, typename C, typename P>
+                I stable_partition_(parallel_policy const &policy, I begin,
+                    iterator_difference_t<I> n, iterator_difference_t<I> grain, C &pred,
+                    P &proj)
+                {
+                    if(n <= grain)
+                        return stable_partition_fn{}(begin, begin + n, std::ref(pred),
+                            std::ref(proj));
+                    auto const half = n / 2;
+                    I mid0{}, mid1{};
+                    execution::parallel_invoke(policy,
+                        [&]{ mid0 = detail::stable_partition_(policy, begin, half, grain, pred,
+                            proj); },
+                        [&]{ mid1 = detail::stable_partition_(policy, begin + half, n - half,
+                            grain, pred, proj); });
+                    return detail::parallel_rotate(policy, mid0, begin + half, mid1);
+                }
+
+                template<typename I, typename C, typename P>
+                I stable_partition_(parallel_policy const &policy, I begin,
+                    iterator_difference_t<I> n, C &pred, P &proj)
+                {
+                    return detail::stable_partition_(policy, begin, n,
+                        detail::parallel_grain(policy.pool(), n), pred, proj);
+                }
+            }
+
+            // The execution policy variants of `stable_partition`.
+            template<typename E, typename I, typename S, typename C, typename P = ident,
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() &&
+                    SplittableIteratorRange<I, S>())>
+            I policy_stable_partition(E &&policy, I begin, S end, C pred_, P proj_ = P{})
+            {
+                auto &&pred = invokable(pred_);
+                auto &&proj = invokable(proj_);
+                return detail::stable_partition_(policy, begin, end - begin, pred, proj);
+            }
+
+            template<typename E, typename Rng, typename C, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(StablePartitionable<I, C, P>() && SplittableIterable<Rng &>())>
+            I policy_stable_partition(E &&policy, Rng &rng, C pred, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_stable_partition(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(pred), std::move(proj));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,120 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_ALGORITHM_TRANSFORM_HPP
+#define RANGES_V3_EXECUTION_ALGORITHM_TRANSFORM_HPP
+
+#include <tuple>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            // The execution policy variants of `transform`. The inputs and the output
+            // must be random-access so that each thread can work on its own index
+            // interval, and the function may be called from several threads at once.
+            template<typename E, typename I, typename S, typename O, typename F,
+                typename P = ident,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I, S>() &&
+                    RandomAccessIterator<O>() && Transformable1<I, O, F, P>())>
+            std::pair<I, O> policy_transform(E &&policy, I begin, S end, O out, F fun_,
+                P proj_ = P{})
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj = invokable(proj_);
+                auto const n = end - begin;
+                execution::parallel_for(policy, n,
+                    [&](iterator_difference_t<I> lo, iterator_difference_t<I> hi)
+                    {
+                        auto o = out + lo;
+                        for(auto it = begin + lo, last = begin + hi; it != last; ++it, ++o)
+                            *o = fun(proj(*it));
+                    });
+                return {begin + n, out + n};
+            }
+
+            template<typename E, typename Rng, typename O, typename F, typename P = ident,
+                typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng &>() &&
+                    RandomAccessIterator<O>() && Transformable1<I, O, F, P>())>
+            std::pair<I, O> policy_transform(E &&policy, Rng & rng, O out, F fun, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_transform(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(out), std::move(fun), std::move(proj));
+            }
+
+            template<typename E, typename I0, typename S0, typename I1, typename S1, typename O,
+                typename F, typename P0 = ident, typename P1 = ident,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I0, S0>() &&
+                    SplittableIteratorRange<I1, S1>() && RandomAccessIterator<O>() &&
+                    Transformable2<I0, I1, O, F, P0, P1>())>
+            std::tuple<I0, I1, O> policy_transform(E &&policy, I0 begin0, S0 end0, I1 begin1,
+                S1 end1, O out, F fun_, P0 proj0_ = P0{}, P1 proj1_ = P1{})
+            {
+                auto &&fun = invokable(fun_);
+                auto &&proj0 = invokable(proj0_);
+                auto &&proj1 = invokable(proj1_);
+                auto const n0 = end0 - begin0;
+                auto const n1 = static_cast<iterator_difference_t<I0>>(end1 - begin1);
+                auto const n = n0 < n1 ? n0 : n1;
+                execution::parallel_for(policy, n,
+                    [&](iterator_difference_t<I0> lo, iterator_difference_t<I0> hi)
+                    {
+                        auto it1 = begin1 + lo;
+                        auto o = out + lo;
+                        for(auto it0 = begin0 + lo, last = begin0 + hi; it0 != last;
+                            ++it0, ++it1, ++o)
+                        {
+                            *o = fun(proj0(*it0), proj1(*it1));
+                        }
+                    });
+                return std::tuple<I0, I1, O>{begin0 + n, begin1 + n, out + n};
+            }
+
+            template<typename E, typename Rng0, typename Rng1, typename O, typename F,
+                typename P0 = ident, typename P1 = ident,
+                typename I0 = range_iterator_t<Rng0>,
+                typename I1 = range_iterator_t<Rng1>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng0 &>() &&
+                    SplittableIterable<Rng1 &>() && RandomAccessIterator<O>() &&
+                    Transformable2<I0, I1, O, F, P0, P1>())>
+            std::tuple<I0, I1, O> policy_transform(E &&policy, Rng0 & rng0, Rng1 & rng1, O out,
+                F fun, P0 proj0 = P0{}, P1 proj1 = P1{})
+            {
+                auto const n0 = static_cast<iterator_difference_t<I0>>(size(rng0));
+                auto const n1 = static_cast<iterator_difference_t<I1>>(size(rng1));
+                return execution::policy_transform(std::forward<E>(policy), begin(rng0),
+                    begin(rng0) + n0, begin(rng1), begin(rng1) + n1, std::move(out),
+                    std::move(fun), std::move(proj0), std::move(proj1));
+            }
+            /// \endcond
+        }
+    } // namespace v3
+} // namespace ranges
+
+#endif // include guard
@@ -0,0 +1,87 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_CONCEPTS_HPP
+#define RANGES_V3_EXECUTION_CONCEPTS_HPP
+
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \addtogroup group-execution
+            /// @{
+            template<typename T>
+            struct is_execution_policy
+              : std::false_type
+            {};
+
+            template<>
+            struct is_execution_policy<sequenced_policy>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_execution_policy<parallel_policy>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_execution_policy<parallel_unsequenced_policy>
+              : std::true_type
+            {};
+            /// @}
+        }
+
+        /// \addtogroup group-concepts
+        /// @{
+
+        /// Algorithms check this in a `CONCEPT_REQUIRES_` of its own, ahead of
+        /// their other requirements, so that calls without a policy never
+        /// instantiate the requirements of the policy overloads. It needs only
+        /// the declarations of the policies in `range_fwd.hpp`, so serial
+        /// algorithm headers can check it without including the thread pool.
+        template<typename T>
+        using ExecutionPolicy = execution::is_execution_policy<uncvref_t<T>>;
+
+        template<typename T>
+        using ParallelExecutionPolicy = meta::and_<
+            ExecutionPolicy<T>,
+            std::is_base_of<execution::parallel_policy, uncvref_t<T>>>;
+
+        /// An iterator range that can be cut into pieces at arbitrary positions in
+        /// constant time, so that the pieces can be handed to different threads.
+        template<typename I, typename S>
+        using SplittableIteratorRange = meta::fast_and<
+            RandomAccessIterator<I>,
+            SizedIteratorRange<I, S>>;
+
+        /// An iterable that can be cut into pieces at arbitrary positions in
+        /// constant time, such as a random-access container or a random-access,
+        /// sized view like `view::iota(0, n) | view::transform(f)` or
+        /// `view::zip(a, b)`.
+        template<typename Rng>
+        using SplittableIterable = meta::fast_and<
+            RandomAccessIterable<Rng>,
+            SizedIterable<Rng>>;
+        /// @}
+    }
+}
+
+#endif
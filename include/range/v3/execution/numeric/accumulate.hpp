@@ -0,0 +1,121 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_NUMERIC_ACCUMULATE_HPP
+#define RANGES_V3_EXECUTION_NUMERIC_ACCUMULATE_HPP
+
+#include <vector>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// Accumulating in parallel starts each piece from its first element and
+        /// combines the pieces' results in order, so the operation must be
+        /// associative and must also accept two accumulated values.
+        /// \ingroup group-concepts
+        template<typename I, typename T, typename Op = plus, typename P = ident,
+            typename V = iterator_value_t<I>,
+            typename X = concepts::Invokable::result_t<P, V>,
+            typename Y = concepts::Invokable::result_t<Op, T, T>>
+        using ParallelAccumulateable = meta::fast_and<
+            Accumulateable<I, T, Op, P>,
+            Constructible<T, X>,
+            Invokable<Op, T, T>,
+            Assignable<T &, Y>>;
+
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                template<typename I, typename T, typename Op, typename P>
+                T accumulate_(sequenced_policy, I begin, iterator_difference_t<I> n, T init,
+                    Op &op, P &proj)
+                {
+                    for(I end = begin + n; begin != end; ++begin)
+                        init = op(init, proj(*begin));
+                    return init;
+                }
+
+                // The range is cut into chunks of one grain each, and each chunk's
+                // result is stored at the chunk's index, so that the results can be
+                // combined in their original order afterward.
+                template<typename I, typename T, typename Op, typename P>
+                T accumulate_(parallel_policy const &policy, I begin, iterator_difference_t<I> n,
+                    T init, Op &op, P &proj)
+                {
+                    using D = iterator_difference_t<I>;
+                    D const grain = detail::parallel_grain(policy.pool(), n);
+                    D const chunks = (n + grain - 1) / grain;
+                    std::vector<optional<T>> partials(static_cast<std::size_t>(chunks));
+                    execution::parallel_for(policy, chunks, D(1), [&](D lo, D hi)
+                    {
+                        for(; lo != hi; ++lo)
+                        {
+                            auto it = begin + lo * grain;
+                            auto last = lo == chunks - 1 ? begin + n : it + grain;
+                            T acc(proj(*it));
+                            for(++it; it != last; ++it)
+                                acc = op(acc, proj(*it));
+                            partials[static_cast<std::size_t>(lo)] = std::move(acc);
+                        }
+                    });
+                    for(auto &p : partials)
+                        init = op(init, *p);
+                    return init;
+                }
+            }
+
+            // The execution policy variants of `accumulate`.
+            template<typename E, typename I, typename S, typename T, typename Op = plus,
+                typename P = ident,
+                CONCEPT_REQUIRES_(SplittableIteratorRange<I, S>() &&
+                    ParallelAccumulateable<I, T, Op, P>())>
+            T policy_accumulate(E &&policy, I begin, S end, T init, Op op_ = Op{},
+                P proj_ = P{})
+            {
+                auto &&op = invokable(op_);
+                auto &&proj = invokable(proj_);
+                return detail::accumulate_(policy, begin, end - begin, std::move(init), op,
+                    proj);
+            }
+
+            template<typename E, typename Rng, typename T, typename Op = plus,
+                typename P = ident, typename I = range_iterator_t<Rng>,
+                CONCEPT_REQUIRES_(SplittableIterable<Rng>() &&
+                    ParallelAccumulateable<I, T, Op, P>())>
+            T policy_accumulate(E &&policy, Rng && rng, T init, Op op = Op{}, P proj = P{})
+            {
+                auto const n = static_cast<iterator_difference_t<I>>(size(rng));
+                return execution::policy_accumulate(std::forward<E>(policy), begin(rng),
+                    begin(rng) + n, std::move(init), std::move(op), std::move(proj));
+            }
+            /// \endcond
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,193 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_PARALLEL_COMPACT_HPP
+#define RANGES_V3_EXECUTION_PARALLEL_COMPACT_HPP
+
+#include <vector>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/utility/iterator_traits.hpp>
+#include <range/v3/execution/policy.hpp>
+#include <range/v3/execution/parallel_for.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                // Elements of arithmetic type are compacted through a small buffer
+                // on the stack: every element is stored and the write position only
+                // advances past the selected ones. That trades a copy per element
+                // for a loop without data-dependent branches, which the compiler
+                // can vectorize when the input is contiguous.
+                template<typename I>
+                using branchless_compactable = meta::and_<
+                    std::is_arithmetic<iterator_value_t<I>>,
+                    std::is_lvalue_reference<iterator_reference_t<I>>>;
+
+                constexpr std::ptrdiff_t compact_buffer_size = 256;
+
+                template<typename I, typename O>
+                O compact_copy(I first, I last, unsigned char const *mask, O out,
+                    std::false_type)
+                {
+                    for(; first != last; ++first, ++mask)
+                    {
+                        if(*mask)
+                        {
+                            auto &&x = *first;
+                            *out = (decltype(x) &&) x;
+                            ++out;
+                        }
+                    }
+                    return out;
+                }
+
+                template<typename I, typename O>
+                O compact_copy(I first, I last, unsigned char const *mask, O out,
+                    std::true_type)
+                {
+                    iterator_value_t<I> buf[compact_buffer_size];
+                    while(first != last)
+                    {
+                        auto const len = last - first < compact_buffer_size ?
+                            last - first : compact_buffer_size;
+                        std::ptrdiff_t k = 0;
+                        for(std::ptrdiff_t i = 0; i != len; ++i)
+                        {
+                            buf[k] = first[i];
+                            k += mask[i];
+                        }
+                        for(std::ptrdiff_t i = 0; i != k; ++i, ++out)
+                            *out = buf[i];
+                        first += len;
+                        mask += len;
+                    }
+                    return out;
+                }
+
+                template<typename I, typename O0, typename O1>
+                void partition_copy_block(I first, I last, unsigned char const *mask,
+                    O0 o0, O1 o1, std::false_type)
+                {
+                    for(; first != last; ++first, ++mask)
+                    {
+                        auto &&x = *first;
+                        if(*mask)
+                        {
+                            *o0 = (decltype(x) &&) x;
+                            ++o0;
+                        }
+                        else
+                        {
+                            *o1 = (decltype(x) &&) x;
+                            ++o1;
+                        }
+                    }
+                }
+
+                template<typename I, typename O0, typename O1>
+                void partition_copy_block(I first, I last, unsigned char const *mask,
+                    O0 o0, O1 o1, std::true_type)
+                {
+                    iterator_value_t<I> buf0[compact_buffer_size];
+                    iterator_value_t<I> buf1[compact_buffer_size];
+                    while(first != last)
+                    {
+                        auto const len = last - first < compact_buffer_size ?
+                            last - first : compact_buffer_size;
+                        std::ptrdiff_t k0 = 0, k1 = 0;
+                        for(std::ptrdiff_t i = 0; i != len; ++i)
+                        {
+                            buf0[k0] = first[i];
+                            buf1[k1] = first[i];
+                            k0 += mask[i];
+                            k1 += 1 - mask[i];
+                        }
+                        for(std::ptrdiff_t i = 0; i != k0; ++i, ++o0)
+                            *o0 = buf0[i];
+                        for(std::ptrdiff_t i = 0; i != k1; ++i, ++o1)
+                            *o1 = buf1[i];
+                        first += len;
+                        mask += len;
+                    }
+                }
+            }
+            /// \endcond
+
+            /// \addtogroup group-execution
+            /// @{
+
+            /// Parallel stream compaction over the indices `[0, n)`, in three
+            /// passes over fixed blocks of indices:
+            ///   1. `select(i)` is called once for every index, and the number of
+            ///      selected indices in each block is counted;
+            ///   2. an exclusive scan of the counts gives, for every block, the
+            ///      number of indices selected before it;
+            ///   3. `scatter(lo, hi, mask, offset)` is called for every block
+            ///      `[lo, hi)`, where `mask[i - lo]` is nonzero if index `i` was
+            ///      selected, and `offset` is the number of selected indices
+            ///      before `lo`.
+            /// The calls within each pass may run concurrently.
+            /// \return The number of selected indices.
+            template<typename D, typename Select, typename Scatter,
+                CONCEPT_REQUIRES_(SignedIntegral<D>())>
+            D parallel_compact(parallel_policy const &policy, D n, Select select,
+                Scatter scatter)
+            {
+                if(n <= 0)
+                    return 0;
+                D const block = detail::parallel_grain(policy.pool(), n);
+                D const nblocks = (n + block - 1) / block;
+                std::vector<unsigned char> mask(static_cast<std::size_t>(n));
+                std::vector<D> counts(static_cast<std::size_t>(nblocks));
+                execution::parallel_for(policy, nblocks, D(1), [&](D b0, D b1)
+                {
+                    for(; b0 != b1; ++b0)
+                    {
+                        D const lo = b0 * block, hi = n - lo < block ? n : lo + block;
+                        D count = 0;
+                        for(D i = lo; i != hi; ++i)
+                            count += (mask[static_cast<std::size_t>(i)] = select(i) ? 1 : 0);
+                        counts[static_cast<std::size_t>(b0)] = count;
+                    }
+                });
+                D total = 0;
+                for(auto &count : counts)
+                {
+                    D const c = count;
+                    count = total;
+                    total += c;
+                }
+                execution::parallel_for(policy, nblocks, D(1), [&](D b0, D b1)
+                {
+                    for(; b0 != b1; ++b0)
+                    {
+                        D const lo = b0 * block, hi = n - lo < block ? n : lo + block;
+                        scatter(lo, hi, mask.data() + lo, counts[static_cast<std::size_t>(b0)]);
+                    }
+                });
+                return total;
+            }
+            /// @}
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,119 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_PARALLEL_FOR_HPP
+#define RANGES_V3_EXECUTION_PARALLEL_FOR_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/concepts.hpp>
+#include <range/v3/execution/policy.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                // Below this many elements per task, the cost of scheduling a task
+                // outweighs the benefit of running it in parallel.
+                constexpr std::ptrdiff_t parallel_min_grain = 1024;
+
+                // Aim for several pieces of work per thread so that stealing can even
+                // out an uneven load, but never pieces smaller than the minimum grain.
+                template<typename D>
+                D parallel_grain(thread_pool const &pool, D n)
+                {
+                    D const grain = n / static_cast<D>(8 * (pool.size() + 1));
+                    return grain < static_cast<D>(parallel_min_grain) ?
+                        static_cast<D>(parallel_min_grain) : grain;
+                }
+
+                // Recursively split [first, last) in half, handing the upper half to
+                // the pool, so that idle workers steal large pieces of work and the
+                // splitting itself happens in parallel.
+                template<typename D, typename Fun>
+                void parallel_for_(task_group &grp, D first, D last, D grain, Fun &fun)
+                {
+                    while(last - first > grain)
+                    {
+                        D const middle = first + (last - first) / 2;
+                        grp.run([&grp, middle, last, grain, &fun]
+                        {
+                            detail::parallel_for_(grp, middle, last, grain, fun);
+                        });
+                        last = middle;
+                    }
+                    fun(first, last);
+                }
+            }
+            /// \endcond
+
+            /// \addtogroup group-execution
+            /// @{
+
+            /// Calls `fun(lo, hi)` for a set of disjoint half-open index intervals
+            /// that together cover `[0, n)`, none of them longer than \p grain
+            /// unless \p grain is less than one. With `par`, the calls may run
+            /// concurrently on the threads of the policy's pool and on the calling
+            /// thread. Returns when all calls have finished. If any call throws,
+            /// the first exception is rethrown once all calls have finished.
+            template<typename D, typename Fun,
+                CONCEPT_REQUIRES_(SignedIntegral<D>())>
+            void parallel_for(parallel_policy const &policy, D n, D grain, Fun fun)
+            {
+                if(n <= 0)
+                    return;
+                grain = grain < D(1) ? D(1) : grain;
+                task_group grp{policy.pool()};
+                auto root = [&]{ detail::parallel_for_(grp, D(0), n, grain, fun); };
+                grp.invoke(root);
+                grp.wait();
+            }
+
+            /// \overload
+            template<typename D, typename Fun,
+                CONCEPT_REQUIRES_(SignedIntegral<D>())>
+            void parallel_for(sequenced_policy, D n, D, Fun fun)
+            {
+                if(n > 0)
+                    fun(D(0), n);
+            }
+
+            /// Like the above, with a grain chosen from \p n and the size of the
+            /// policy's pool.
+            template<typename D, typename Fun,
+                CONCEPT_REQUIRES_(SignedIntegral<D>())>
+            void parallel_for(parallel_policy const &policy, D n, Fun fun)
+            {
+                execution::parallel_for(policy, n, detail::parallel_grain(policy.pool(), n),
+                    std::move(fun));
+            }
+
+            /// \overload
+            template<typename D, typename Fun,
+                CONCEPT_REQUIRES_(SignedIntegral<D>())>
+            void parallel_for(sequenced_policy, D n, Fun fun)
+            {
+                if(n > 0)
+                    fun(D(0), n);
+            }
+            /// @}
+        }
+    }
+}
+
+#endif
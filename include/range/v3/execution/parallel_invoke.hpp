@@ -0,0 +1,57 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_PARALLEL_INVOKE_HPP
+#define RANGES_V3_EXECUTION_PARALLEL_INVOKE_HPP
+
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/execution/policy.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \addtogroup group-execution
+            /// @{
+
+            /// Fork-join: calls each of the nullary functions, possibly concurrently,
+            /// and returns once all of them have finished. The first function runs
+            /// on the calling thread. If any of them throws, the first exception is
+            /// rethrown after all have finished.
+            template<typename Fun, typename...Funs>
+            void parallel_invoke(parallel_policy const &policy, Fun fun, Funs...funs)
+            {
+                task_group grp{policy.pool()};
+                int expand[] = {0, (grp.run(std::move(funs)), 0)...};
+                (void)expand;
+                grp.invoke(fun);
+                grp.wait();
+            }
+
+            /// \overload
+            template<typename Fun, typename...Funs>
+            void parallel_invoke(sequenced_policy, Fun fun, Funs...funs)
+            {
+                fun();
+                int expand[] = {0, (funs(), 0)...};
+                (void)expand;
+            }
+            /// @}
+        }
+    }
+}
+
+#endif
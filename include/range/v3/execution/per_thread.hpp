@@ -0,0 +1,71 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_PER_THREAD_HPP
+#define RANGES_V3_EXECUTION_PER_THREAD_HPP
+
+#include <vector>
+#include <utility>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \addtogroup group-execution
+            /// @{
+
+            /// Scratch storage with one `T` for each worker of a pool, plus one for
+            /// the thread that creates the `per_thread` object. Tasks of a parallel
+            /// algorithm can use `local()` without synchronization. Because a worker
+            /// that waits on a nested fork-join may run other tasks of the same
+            /// algorithm, a task must not hold on to `local()` across such a wait.
+            template<typename T>
+            struct per_thread
+            {
+            private:
+                // Padding keeps neighboring workers' objects off each other's
+                // cache lines.
+                struct slot
+                {
+                    T value;
+                    char pad_[64];
+                };
+                thread_pool *pool_;
+                std::vector<slot> slots_;
+            public:
+                explicit per_thread(thread_pool &pool, T const &init = T{})
+                  : pool_(&pool), slots_(pool.size() + 1, slot{init, {}})
+                {}
+                /// The calling thread's object.
+                T &local()
+                {
+                    return slots_[pool_->worker_index()].value;
+                }
+                /// Calls `fun(t)` for every thread's object, in worker order. Use this
+                /// to combine the results once the parallel work has finished.
+                template<typename Fun>
+                void for_each(Fun fun)
+                {
+                    for(auto &s : slots_)
+                        fun(s.value);
+                }
+            };
+            /// @}
+        }
+    }
+}
+
+#endif
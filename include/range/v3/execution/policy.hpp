@@ -0,0 +1,100 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_POLICY_HPP
+#define RANGES_V3_EXECUTION_POLICY_HPP
+
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/execution/concepts.hpp>
+#include <range/v3/execution/thread_pool.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \addtogroup group-execution
+            /// @{
+
+            /// Requests that an algorithm run serially on the calling thread.
+            struct sequenced_policy
+            {};
+
+            /// Permits an algorithm to divide its work among the threads of a
+            /// `thread_pool`. Element access functions may be invoked concurrently
+            /// from several threads. Use `par.on(pool)` to run on a pool other than
+            /// `default_thread_pool()`.
+            struct parallel_policy
+            {
+            private:
+                thread_pool *pool_;
+            public:
+                constexpr parallel_policy()
+                  : pool_(nullptr)
+                {}
+                constexpr explicit parallel_policy(thread_pool &pool)
+                  : pool_(&pool)
+                {}
+                parallel_policy on(thread_pool &pool) const
+                {
+                    return parallel_policy{pool};
+                }
+                thread_pool &pool() const
+                {
+                    return pool_ ? *pool_ : default_thread_pool();
+                }
+            };
+
+            /// Like `parallel_policy`, and additionally permits the calls made on
+            /// any one thread to be interleaved, so that loops may be vectorized.
+            struct parallel_unsequenced_policy
+              : parallel_policy
+            {
+                constexpr parallel_unsequenced_policy() = default;
+                constexpr explicit parallel_unsequenced_policy(thread_pool &pool)
+                  : parallel_policy{pool}
+                {}
+                parallel_unsequenced_policy on(thread_pool &pool) const
+                {
+                    return parallel_unsequenced_policy{pool};
+                }
+            };
+
+            /// \ingroup group-execution
+            /// \sa `sequenced_policy`
+            namespace
+            {
+                constexpr auto&& seq = static_const<sequenced_policy>::value;
+            }
+
+            /// \ingroup group-execution
+            /// \sa `parallel_policy`
+            namespace
+            {
+                constexpr auto&& par = static_const<parallel_policy>::value;
+            }
+
+            /// \ingroup group-execution
+            /// \sa `parallel_unsequenced_policy`
+            namespace
+            {
+                constexpr auto&& par_unseq = static_const<parallel_unsequenced_policy>::value;
+            }
+            /// @}
+        }
+    }
+}
+
+#endif
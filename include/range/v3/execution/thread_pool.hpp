@@ -0,0 +1,294 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_EXECUTION_THREAD_POOL_HPP
+#define RANGES_V3_EXECUTION_THREAD_POOL_HPP
+
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <utility>
+#include <exception>
+#include <functional>
+#include <condition_variable>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        namespace execution
+        {
+            /// \cond
+            namespace detail
+            {
+                using task = std::function<void()>;
+
+                // A double-ended queue of tasks. The owning worker pushes and pops
+                // at the back so that it works depth-first on the most recently
+                // split piece of work; idle workers steal the oldest (and so
+                // typically largest) piece from the front.
+                struct work_queue
+                {
+                private:
+                    std::mutex mtx_;
+                    std::deque<task> tasks_;
+                public:
+                    void push(task t)
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        tasks_.push_back(std::move(t));
+                    }
+                    bool pop(task &t)
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        if(tasks_.empty())
+                            return false;
+                        t = std::move(tasks_.back());
+                        tasks_.pop_back();
+                        return true;
+                    }
+                    bool steal(task &t)
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        if(tasks_.empty())
+                            return false;
+                        t = std::move(tasks_.front());
+                        tasks_.pop_front();
+                        return true;
+                    }
+                };
+            }
+            /// \endcond
+
+            /// \addtogroup group-execution
+            /// @{
+
+            /// A fixed-size pool of worker threads that share work by stealing.
+            /// Each worker owns a queue of tasks; tasks submitted from a worker go
+            /// to that worker's queue and tasks submitted from any other thread go
+            /// to a shared injection queue. A worker that must wait for other tasks
+            /// to finish should help by calling `run_one` rather than blocking.
+            struct thread_pool
+            {
+                using task_type = detail::task;
+            private:
+                struct worker_id
+                {
+                    thread_pool const *pool;
+                    std::size_t index;
+                };
+                // queues_[i] belongs to worker i; the last queue receives tasks
+                // submitted from outside the pool.
+                std::vector<std::unique_ptr<detail::work_queue>> queues_;
+                std::vector<std::thread> threads_;
+                std::mutex mtx_;
+                std::condition_variable cv_;
+                std::atomic<std::size_t> pending_;
+                bool stop_;
+
+                static worker_id &this_worker()
+                {
+                    static thread_local worker_id id{nullptr, 0};
+                    return id;
+                }
+                std::size_t injection_queue() const
+                {
+                    return queues_.size() - 1;
+                }
+                bool take(task_type &t)
+                {
+                    std::size_t const nqueues = queues_.size();
+                    std::size_t const self = this->worker_index();
+                    if(self != this->injection_queue() && queues_[self]->pop(t))
+                        return true;
+                    // Start stealing from our neighbor so that thieves spread out.
+                    for(std::size_t i = 1; i <= nqueues; ++i)
+                        if(queues_[(self + i) % nqueues]->steal(t))
+                            return true;
+                    return false;
+                }
+                void work(std::size_t index)
+                {
+                    this_worker() = worker_id{this, index};
+                    while(true)
+                    {
+                        if(this->run_one())
+                            continue;
+                        std::unique_lock<std::mutex> lock{mtx_};
+                        cv_.wait(lock, [this]{ return stop_ || pending_.load() != 0; });
+                        if(stop_)
+                            return;
+                    }
+                }
+            public:
+                /// Creates a pool with \p nthreads worker threads. A request for
+                /// zero threads is treated as a request for one.
+                explicit thread_pool(std::size_t nthreads = std::thread::hardware_concurrency())
+                  : queues_{}, threads_{}, mtx_{}, cv_{}, pending_{0}, stop_{false}
+                {
+                    nthreads = nthreads ? nthreads : 1;
+                    queues_.reserve(nthreads + 1);
+                    for(std::size_t i = 0; i != nthreads + 1; ++i)
+                        queues_.emplace_back(new detail::work_queue);
+                    threads_.reserve(nthreads);
+                    for(std::size_t i = 0; i != nthreads; ++i)
+                        threads_.emplace_back([this, i]{ this->work(i); });
+                }
+                thread_pool(thread_pool const &) = delete;
+                thread_pool &operator=(thread_pool const &) = delete;
+                ~thread_pool()
+                {
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        stop_ = true;
+                    }
+                    cv_.notify_all();
+                    for(auto &th : threads_)
+                        th.join();
+                }
+                /// The number of worker threads.
+                std::size_t size() const
+                {
+                    return threads_.size();
+                }
+                /// The index of the calling thread within this pool, or `size()` if
+                /// the calling thread is not one of this pool's workers.
+                std::size_t worker_index() const
+                {
+                    worker_id const &id = this_worker();
+                    return id.pool == this ? id.index : this->size();
+                }
+                /// Schedules \p t to run on some thread of the pool.
+                void submit(task_type t)
+                {
+                    // Count the task before it becomes visible, so that a thread
+                    // that takes it at once never drives pending_ below zero.
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        ++pending_;
+                    }
+                    std::size_t const self = this->worker_index();
+                    queues_[self == this->size() ? this->injection_queue() : self]->push(
+                        std::move(t));
+                    cv_.notify_one();
+                }
+                /// Runs one queued task on the calling thread, if there is one.
+                /// \return `true` if a task was run.
+                bool run_one()
+                {
+                    task_type t;
+                    if(!this->take(t))
+                        return false;
+                    --pending_;
+                    t();
+                    return true;
+                }
+            };
+
+            /// The pool used by `par` when no other pool is specified. It is created
+            /// on first use with `RANGES_DEFAULT_THREAD_COUNT` workers, or one worker
+            /// per hardware thread if that macro is zero or not defined.
+            inline thread_pool &default_thread_pool()
+            {
+#if defined(RANGES_DEFAULT_THREAD_COUNT) && RANGES_DEFAULT_THREAD_COUNT > 0
+                static thread_pool pool{RANGES_DEFAULT_THREAD_COUNT};
+#else
+                static thread_pool pool;
+#endif
+                return pool;
+            }
+
+            /// Counts the outstanding tasks of one fork-join computation and
+            /// records the first exception any of them throws.
+            struct task_group
+            {
+            private:
+                thread_pool &pool_;
+                std::atomic<std::size_t> count_;
+                std::mutex mtx_;
+                std::condition_variable cv_;
+                std::exception_ptr except_;
+
+                void done()
+                {
+                    // Notify under the lock: once the count reaches zero, the waiter
+                    // is free to destroy this object as soon as it can lock mtx_.
+                    std::lock_guard<std::mutex> lock{mtx_};
+                    if(--count_ == 0)
+                        cv_.notify_all();
+                }
+            public:
+                explicit task_group(thread_pool &pool)
+                  : pool_(pool), count_{0}, mtx_{}, cv_{}, except_{}
+                {}
+                task_group(task_group const &) = delete;
+                task_group &operator=(task_group const &) = delete;
+                thread_pool &pool() const
+                {
+                    return pool_;
+                }
+                /// Runs a copy of \p fun as a task in the pool. Anything \p fun refers
+                /// to must stay alive until `wait` returns.
+                template<typename Fun>
+                void run(Fun fun)
+                {
+                    ++count_;
+                    pool_.submit([this, fun]() mutable
+                    {
+                        this->invoke(fun);
+                        this->done();
+                    });
+                }
+                /// Calls \p fun on the calling thread, recording any exception.
+                template<typename Fun>
+                void invoke(Fun &fun)
+                {
+                    try
+                    {
+                        fun();
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock{mtx_};
+                        if(!except_)
+                            except_ = std::current_exception();
+                    }
+                }
+                /// Waits until all of this group's tasks have finished, then rethrows
+                /// the first exception, if any. A worker of the pool helps by running
+                /// queued tasks while it waits, so nested fork-join cannot deadlock.
+                /// Any other thread blocks, so that the only threads running tasks
+                /// are the pool's workers and the threads that created the work.
+                void wait()
+                {
+                    if(pool_.worker_index() != pool_.size())
+                    {
+                        while(count_.load() != 0)
+                            if(!pool_.run_one())
+                                std::this_thread::yield();
+                    }
+                    std::unique_lock<std::mutex> lock{mtx_};
+                    cv_.wait(lock, [this]{ return count_.load() == 0; });
+                    if(except_)
+                        std::rethrow_exception(except_);
+                }
+            };
+            /// @}
+        }
+    }
+}
+
+#endif
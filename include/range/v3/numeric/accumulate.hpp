@@ -13,18 +13,36 @@
 #ifndef RANGES_V3_NUMERIC_ACCUMULATE_HPP
 #define RANGES_V3_NUMERIC_ACCUMULATE_HPP
 
+#include <utility>
+#include <type_traits>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/distance.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/integral_iota.hpp>
 #include <range/v3/utility/iterator_traits.hpp>
 #include <range/v3/utility/iterator_concepts.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
+#include <range/v3/execution/concepts.hpp>
 
 namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename T, typename Op, typename P>
+            using iota_summable = meta::and_c<
+                is_integral_iota<Rng>::value,
+                (std::is_integral<T>::value && !std::is_same<T, bool>::value),
+                std::is_same<Op, plus>::value,
+                std::is_same<P, ident>::value>;
+        }
+        /// \endcond
+
         template<typename I, typename T, typename Op = plus, typename P = ident,
             typename V = iterator_value_t<I>,
             typename X = concepts::Invokable::result_t<P, V>,
@@ -37,9 +55,40 @@ namespace ranges
 
         struct accumulate_fn
         {
+        private:
+            template<typename Rng, typename T, typename Op, typename P>
+            RANGES_CXX14_CONSTEXPR T range_(Rng &rng, T &init, Op &op, P &proj, std::false_type) const
+            {
+                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
+                    std::move(proj));
+            }
+            template<typename Rng, typename T, typename Op, typename P>
+            static T range_(Rng &rng, T &init, Op &op_, P &proj_, std::true_type)
+            {
+                using R = range_reference_t<Rng>;
+                auto &&op = invokable(op_);
+                auto &&proj = invokable(proj_);
+                for_each_while(rng, [&](R r) -> bool
+                {
+                    init = op(init, proj(std::forward<R>(r)));
+                    return true;
+                });
+                return init;
+            }
+            // The sum of the integers from a view::iota or view::ints, in closed
+            // form.
+            template<typename Rng, typename T, typename Op, typename P>
+            static RANGES_CXX14_CONSTEXPR T range_(Rng &rng, T &init, Op &, P &, detail::integral_iota_tag)
+            {
+                using U = meta::eval<std::make_unsigned<decltype(init + *begin(rng))>>;
+                return static_cast<T>(static_cast<U>(init) +
+                    detail::iota_sum<U>(*begin(rng), distance(rng)));
+            }
+
+        public:
             template<typename I, typename S, typename T, typename Op = plus, typename P = ident,
                 CONCEPT_REQUIRES_(IteratorRange<I, S>() && Accumulateable<I, T, Op, P>())>
-            T operator()(I begin, S end, T init, Op op_ = Op{}, P proj_ = P{}) const
+            RANGES_CXX14_CONSTEXPR T operator()(I begin, S end, T init, Op op_ = Op{}, P proj_ = P{}) const
             {
                 auto &&op = invokable(op_);
                 auto &&proj = invokable(proj_);
@@ -51,11 +100,21 @@ namespace ranges
             template<typename Rng, typename T, typename Op = plus, typename P = ident,
                 typename I = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(Iterable<Rng>() && Accumulateable<I, T, Op, P>())>
-            T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
+            RANGES_CXX14_CONSTEXPR T operator()(Rng && rng, T init, Op op = Op{}, P proj = P{}) const
             {
-                return (*this)(begin(rng), end(rng), std::move(init), std::move(op),
-                    std::move(proj));
+                return this->range_(rng, init, op, proj,
+                    meta::if_<detail::iota_summable<uncvref_t<Rng>, T, Op, P>,
+                        detail::integral_iota_tag, detail::has_for_each_while<Rng>>{});
             }
+
+            // Execution policy variants; see range/v3/execution/numeric/accumulate.hpp.
+            template<typename E, typename...Args,
+                CONCEPT_REQUIRES_(ExecutionPolicy<E>())>
+            auto operator()(E &&policy, Args &&...args) const
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                policy_accumulate(std::forward<E>(policy), std::forward<Args>(args)...)
+            )
         };
 
         namespace
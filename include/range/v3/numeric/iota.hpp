@@ -27,7 +27,7 @@ namespace ranges
         {
             template<typename O, typename S, class T,
                 CONCEPT_REQUIRES_(OutputIterator<O, T>() && IteratorRange<O, S>() && WeaklyIncrementable<T>())>
-            O operator()(O begin, S end, T val) const
+            RANGES_CXX14_CONSTEXPR O operator()(O begin, S end, T val) const
             {
                 for(; begin != end; ++begin, ++val)
                     *begin = val;
@@ -36,7 +36,7 @@ namespace ranges
 
             template<typename Rng, class T, typename O = range_iterator_t<Rng>,
                 CONCEPT_REQUIRES_(OutputIterable<Rng &, T>() && WeaklyIncrementable<T>())>
-            O operator()(Rng &rng, T val) const
+            RANGES_CXX14_CONSTEXPR O operator()(Rng &rng, T val) const
             {
                 return (*this)(begin(rng), end(rng), std::move(val));
             }
@@ -205,6 +205,39 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            // Whether an iterator got from a view is also an iterator into every
+            // copy of the view, for as long as the copy lives. It is so for views
+            // that are a pair of iterators, but not for adaptors whose iterators
+            // point back into the view, as those of range_adaptor do. Views that
+            // cache their begin iterator keep the cache across copies only when
+            // it is so.
+            template<typename Rng>
+            struct copies_share_iterators
+              : std::false_type
+            {};
+
+            template<typename I, typename S>
+            struct copies_share_iterators<range<I, S>>
+              : std::true_type
+            {};
+
+            template<typename I, typename S>
+            struct copies_share_iterators<sized_range<I, S>>
+              : std::true_type
+            {};
+
+            // The begin cache for a copy of a view over Rng.
+            template<typename Rng, typename Cache>
+            Cache copy_begin_cache(Cache const &cache)
+            {
+                return copies_share_iterators<Rng>::value ? cache : Cache{};
+            }
+        }
+        /// \endcond
+
         struct make_range_fn
         {
             /// \return `{begin, end}`
@@ -82,63 +82,70 @@ namespace ranges
             };
 
             template<typename Rng>
-            static auto begin_cursor(Rng & rng, long)
+            static constexpr auto begin_cursor(Rng & rng, long)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 rng.begin_cursor()
             )
             template<typename Rng>
-            static auto begin_cursor(Rng & rng, int)
+            static constexpr auto begin_cursor(Rng & rng, int)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 static_cast<Rng const &>(rng).begin_cursor()
             )
             template<typename Rng>
-            static auto end_cursor(Rng & rng, long)
+            static constexpr auto end_cursor(Rng & rng, long)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 rng.end_cursor()
             )
             template<typename Rng>
-            static auto end_cursor(Rng & rng, int)
+            static constexpr auto end_cursor(Rng & rng, int)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 static_cast<Rng const &>(rng).end_cursor()
             )
 
             template<typename Rng>
-            static auto begin_adaptor(Rng & rng, long)
+            static constexpr auto begin_adaptor(Rng & rng, long)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 rng.begin_adaptor()
             )
             template<typename Rng>
-            static auto begin_adaptor(Rng & rng, int)
+            static constexpr auto begin_adaptor(Rng & rng, int)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 static_cast<Rng const &>(rng).begin_adaptor()
             )
             template<typename Rng>
-            static auto end_adaptor(Rng & rng, long)
+            static constexpr auto end_adaptor(Rng & rng, long)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 rng.end_adaptor()
             )
             template<typename Rng>
-            static auto end_adaptor(Rng & rng, int)
+            static constexpr auto end_adaptor(Rng & rng, int)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 static_cast<Rng const &>(rng).end_adaptor()
             )
 
+            template<typename Rng, typename F>
+            static auto for_each_while(Rng & rng, F & fun)
+            RANGES_DECLTYPE_AUTO_RETURN
+            (
+                rng.for_each_while(fun)
+            )
+
             template<typename Cur>
-            static auto current(Cur const &pos)
+            static constexpr auto current(Cur const &pos)
             RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
             (
                 pos.current()
             )
             template<typename Cur>
-            static auto next(Cur & pos)
+            static RANGES_CXX14_CONSTEXPR auto next(Cur & pos)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 pos.next()
@@ -150,7 +157,7 @@ namespace ranges
                 pos.done()
             )
             template<typename Cur>
-            static auto equal(Cur const &pos0, Cur const &pos1)
+            static constexpr auto equal(Cur const &pos0, Cur const &pos1)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 pos0.equal(pos1)
@@ -162,19 +169,19 @@ namespace ranges
                 end.equal(pos)
             )
             template<typename Cur>
-            static auto prev(Cur & pos)
+            static RANGES_CXX14_CONSTEXPR auto prev(Cur & pos)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 pos.prev()
             )
             template<typename Cur, typename D>
-            static auto advance(Cur & pos, D n)
+            static RANGES_CXX14_CONSTEXPR auto advance(Cur & pos, D n)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 pos.advance(n)
             )
             template<typename Cur>
-            static auto distance_to(Cur const &pos0, Cur const &pos1)
+            static constexpr auto distance_to(Cur const &pos0, Cur const &pos1)
             RANGES_DECLTYPE_AUTO_RETURN
             (
                 pos0.distance_to(pos1)
@@ -242,12 +249,12 @@ namespace ranges
             using single_pass_t = typename single_pass<Cur>::type;
 
             template<typename Cur, typename S>
-            static Cur cursor(basic_iterator<Cur, S> it)
+            static constexpr Cur cursor(basic_iterator<Cur, S> it)
             {
                 return std::move(it.pos());
             }
             template<typename S>
-            static S sentinel(basic_sentinel<S> s)
+            static constexpr S sentinel(basic_sentinel<S> s)
             {
                 return std::move(s.end());
             }
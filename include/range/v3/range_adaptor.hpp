@@ -13,6 +13,8 @@
 #ifndef RANGES_V3_RANGE_ADAPTOR_HPP
 #define RANGES_V3_RANGE_ADAPTOR_HPP
 
+#include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/distance.hpp>
@@ -50,6 +52,46 @@ namespace ranges
             struct adaptor_base_current_mem_fn
             {};
 
+            // A base for adaptors and cursors that need a function object. An
+            // empty one that can be default-constructed has no state to keep,
+            // so none is stored: fun() hands out a fresh one instead, and the
+            // adaptor adds nothing to the size of its iterators. Deriving from
+            // the function object itself would do the same, but would bring its
+            // members into the adaptor's scope.
+            template<typename Fun,
+                bool Empty = std::is_empty<Fun>::value &&
+                    std::is_default_constructible<Fun>::value>
+            struct adaptor_fun
+            {
+            private:
+                Fun fun_;
+            public:
+                adaptor_fun() = default;
+                adaptor_fun(Fun fun)
+                  : fun_(std::move(fun))
+                {}
+                Fun &fun()
+                {
+                    return fun_;
+                }
+                Fun const &fun() const
+                {
+                    return fun_;
+                }
+            };
+
+            template<typename Fun>
+            struct adaptor_fun<Fun, true>
+            {
+                adaptor_fun() = default;
+                adaptor_fun(Fun const &)
+                {}
+                Fun fun() const
+                {
+                    return Fun{};
+                }
+            };
+
             template<typename BaseIter, typename Adapt, typename Enable = void>
             struct adaptor_value_type2
             {};
@@ -332,6 +374,11 @@ namespace ranges
                 {
                     return this->get().first;
                 }
+                // ...and the adaptor that decides where the adapted range ends.
+                Adapt const &adaptor() const
+                {
+                    return this->get().second;
+                }
             };
             template<typename I, typename IA, typename S = adaptor_sentinel>
             constexpr auto equal(adaptor_cursor<I, IA> const &that) const ->
@@ -416,6 +463,21 @@ namespace ranges
                 auto pos = adapt.end(derived());
                 return {std::move(pos), std::move(adapt)};
             }
+        protected:
+            // The iterator at a position of the base, for views that loop over
+            // the base themselves in for_each_while.
+            template<typename D = Derived, CONCEPT_REQUIRES_(Same<D, Derived>())>
+            detail::facade_iterator_t<D> iterator_at_(detail::adapted_iterator_t<D> pos,
+                detail::begin_adaptor_t<D> adapt)
+            {
+                return {adaptor_cursor_t<D>{std::move(pos), std::move(adapt)}};
+            }
+            template<typename D = Derived, CONCEPT_REQUIRES_(Same<D, Derived>())>
+            detail::facade_iterator_t<D> iterator_at_(detail::adapted_iterator_t<D> pos)
+            {
+                return this->iterator_at_(std::move(pos),
+                    range_access::begin_adaptor(derived(), 42));
+            }
         public:
             range_adaptor() = default;
             constexpr range_adaptor(BaseRng && rng)
@@ -33,6 +33,12 @@
 /// \defgroup group-actions Actions
 /// Eager, mutating, composable algorithms
 
+/// \defgroup group-execution Execution
+/// Thread pools and execution policies for parallel algorithms
+
+/// \defgroup group-containers Containers
+/// Owning containers that complement the standard ones
+
 /// \defgroup group-concepts Concepts
 /// Concept-checking classes and utilities
 
@@ -139,6 +145,11 @@ namespace ranges
         {
             template<typename Action>
             struct action;
+
+            struct drop_fn;
+            struct remove_if_fn;
+            struct take_fn;
+            struct transform_fn;
         }
 
         namespace view
@@ -147,6 +158,13 @@ namespace ranges
             struct view;
         }
 
+        namespace execution
+        {
+            struct sequenced_policy;
+            struct parallel_policy;
+            struct parallel_unsequenced_policy;
+        }
+
         namespace adl_advance_detail
         {
             struct advance_fn;
@@ -462,6 +480,14 @@ namespace ranges
             struct bounded_fn;
         }
 
+        template<typename Rng>
+        struct chunk_view;
+
+        namespace view
+        {
+            struct chunk_fn;
+        }
+
         template<typename Rng>
         struct const_view;
 
@@ -596,6 +622,9 @@ namespace ranges
             struct split_fn;
         }
 
+        template<typename Rng>
+        struct split_table;
+
         template<typename Rng>
         struct single_view;
 
@@ -64,26 +64,26 @@ namespace ranges
           : private basic_range<Inf>
         {
         protected:
-            Derived & derived()
+            RANGES_CXX14_CONSTEXPR Derived & derived()
             {
                 return static_cast<Derived &>(*this);
             }
             /// \overload
-            Derived const & derived() const
+            constexpr Derived const & derived() const
             {
                 return static_cast<Derived const &>(*this);
             }
         public:
             // A few ways of testing whether a range can be empty:
-            bool empty() const
+            constexpr bool empty() const
             {
                 return derived().begin() == derived().end();
             }
-            bool operator!() const
+            constexpr bool operator!() const
             {
                 return empty();
             }
-            explicit operator bool() const
+            constexpr explicit operator bool() const
             {
                 return !empty();
             }
@@ -91,42 +91,42 @@ namespace ranges
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>() &&
                     SizedIteratorRange<range_iterator_t<D>, range_sentinel_t<D>>())>
-            range_size_t<D> size() const
+            constexpr range_size_t<D> size() const
             {
                 return iter_size(derived().begin(), derived().end());
             }
             /// Access the first element in a range:
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>())>
-            range_reference_t<D> front()
+            RANGES_CXX14_CONSTEXPR range_reference_t<D> front()
             {
                 return *derived().begin();
             }
             /// \overload
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>())>
-            range_reference_t<D const> front() const
+            constexpr range_reference_t<D const> front() const
             {
                 return *derived().begin();
             }
             /// Access the last element in a range:
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>() && BoundedRange<D>() && BidirectionalRange<D>())>
-            range_reference_t<D> back()
+            RANGES_CXX14_CONSTEXPR range_reference_t<D> back()
             {
                 return *prev(derived().end());
             }
             /// \overload
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>() && BoundedRange<D const>() && BidirectionalRange<D const>())>
-            range_reference_t<D const> back() const
+            constexpr range_reference_t<D const> back() const
             {
                 return *prev(derived().end());
             }
             /// Simple indexing:
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>() && RandomAccessRange<D>())>
-            auto operator[](range_difference_t<D> n) ->
+            RANGES_CXX14_CONSTEXPR auto operator[](range_difference_t<D> n) ->
                 decltype(std::declval<D &>().begin()[n])
             {
                 return derived().begin()[n];
@@ -134,7 +134,7 @@ namespace ranges
             /// \overload
             template<typename D = Derived,
                 CONCEPT_REQUIRES_(Same<D, Derived>() && RandomAccessRange<D const>())>
-            auto operator[](range_difference_t<D> n) const ->
+            constexpr auto operator[](range_difference_t<D> n) const ->
                 decltype(std::declval<D const &>().begin()[n])
             {
                 return derived().begin()[n];
@@ -34,14 +34,14 @@ namespace ranges
             }
 
             template<typename Rng>
-            auto size_(Rng && rng, int) ->
+            constexpr auto size_(Rng && rng, int) ->
                 decltype(rng.size())
             {
                 return rng.size();
             }
 
             template<typename Rng>
-            auto size(Rng && rng) ->
+            constexpr auto size(Rng && rng) ->
                 decltype(adl_size_detail::size_(std::forward<Rng>(rng), 42))
             {
                 return adl_size_detail::size_(std::forward<Rng>(rng), 42);
@@ -14,6 +14,8 @@
 #ifndef RANGES_V3_TO_CONTAINER_HPP
 #define RANGES_V3_TO_CONTAINER_HPP
 
+#include <utility>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_traits.hpp>
@@ -62,6 +64,38 @@ namespace ranges
                     return Cont{I{begin(rng)}, I{end(rng)}};
                 }
             };
+
+            // to_<ContT> builds a ContT<V> from a range of V. When there is no
+            // such container but V is a pair, as for associative containers like
+            // std::map and flat_hash_map, it builds a ContT<Key, Mapped> instead.
+            template<template<typename...> class ContT, typename V, typename = void>
+            struct key_value_container
+            {};
+
+            template<template<typename...> class ContT, typename K, typename M>
+            struct key_value_container<ContT, std::pair<K, M>,
+                void_t<ContT<typename std::remove_const<K>::type, M>>>
+            {
+                using type = ContT<typename std::remove_const<K>::type, M>;
+            };
+
+            template<template<typename...> class ContT, typename V, typename = void>
+            struct container_for
+              : key_value_container<ContT, V>
+            {};
+
+            template<template<typename...> class ContT, typename V>
+            struct container_for<ContT, V, void_t<ContT<V>>>
+            {
+                using type = ContT<V>;
+            };
+
+            template<template<typename...> class ContT>
+            struct quote_container
+            {
+                template<typename V>
+                using apply = meta::eval<container_for<ContT, V>>;
+            };
         }
         /// \endcond
 
@@ -76,14 +110,14 @@ namespace ranges
 
         /// \brief For initializing a container of the specified type with the elements of an Iterable
         template<template<typename...> class ContT>
-        detail::to_container_fn<meta::quote<ContT>> to_()
+        detail::to_container_fn<detail::quote_container<ContT>> to_()
         {
             return {};
         }
 
         /// \overload
         template<template<typename...> class ContT, typename Rng,
-            typename Cont = meta::apply<meta::quote<ContT>, range_value_t<Rng>>,
+            typename Cont = meta::apply<detail::quote_container<ContT>, range_value_t<Rng>>,
             CONCEPT_REQUIRES_(Iterable<Rng>() && detail::ConvertibleToContainer<Rng, Cont>())>
         Cont to_(Rng && rng)
         {
@@ -92,7 +126,7 @@ namespace ranges
 
         /// \overload
         template<template<typename...> class ContT, typename T,
-            typename Cont = meta::apply<meta::quote<ContT>, T>,
+            typename Cont = meta::apply<detail::quote_container<ContT>, T>,
             CONCEPT_REQUIRES_(detail::ConvertibleToContainer<std::initializer_list<T>, Cont>())>
         Cont to_(std::initializer_list<T> list)
         {
@@ -70,7 +70,7 @@ namespace ranges
             {
                 using type = Val;
                 template<typename I>
-                static type apply(I const & i)
+                static constexpr type apply(I const & i)
                 {
                     return *i;
                 }
@@ -381,15 +381,15 @@ namespace ranges
             T t_;
         public:
             constexpr basic_mixin() = default;
-            basic_mixin(T t)
+            constexpr basic_mixin(T t)
               : t_(std::move(t))
             {}
-            T &get() noexcept
+            RANGES_CXX14_CONSTEXPR T &get() noexcept
             {
                 return t_;
             }
             /// \overload
-            T const &get() const noexcept
+            constexpr T const &get() const noexcept
             {
                 return t_;
             }
@@ -405,11 +405,11 @@ namespace ranges
             friend range_access;
             template<typename Cur, typename OtherSentinel>
             friend struct basic_iterator;
-            S &end()
+            RANGES_CXX14_CONSTEXPR S &end()
             {
                 return this->detail::mixin_base<S>::get();
             }
-            S const &end() const
+            constexpr S const &end() const
             {
                 return this->detail::mixin_base<S>::get();
             }
@@ -417,7 +417,7 @@ namespace ranges
             using detail::mixin_base<S>::get;
         public:
             basic_sentinel() = default;
-            basic_sentinel(S end)
+            constexpr basic_sentinel(S end)
               : detail::mixin_base<S>(std::move(end))
             {}
             using detail::mixin_base<S>::mixin_base;
@@ -447,11 +447,11 @@ namespace ranges
                     detail::cursor_concept_t<Cur>>;
 
             using detail::mixin_base<Cur>::get;
-            Cur &pos() noexcept
+            RANGES_CXX14_CONSTEXPR Cur &pos() noexcept
             {
                 return this->detail::mixin_base<Cur>::get();
             }
-            Cur const &pos() const noexcept
+            constexpr Cur const &pos() const noexcept
             {
                 return this->detail::mixin_base<Cur>::get();
             }
@@ -497,12 +497,12 @@ namespace ranges
                 detail::operator_brackets_dispatch<basic_iterator, value_type, reference, common_reference>;
         public:
             constexpr basic_iterator() = default;
-            basic_iterator(Cur pos)
+            constexpr basic_iterator(Cur pos)
               : detail::mixin_base<Cur>{std::move(pos)}
             {}
             // Mix in any additional constructors defined and exported by the cursor
             using detail::mixin_base<Cur>::mixin_base;
-            reference operator*() const
+            constexpr reference operator*() const
                 noexcept(noexcept(range_access::current(std::declval<basic_iterator const &>().pos())))
             {
                 return range_access::current(pos());
@@ -511,12 +511,12 @@ namespace ranges
             {
                 return detail::operator_arrow_dispatch<reference>::apply(**this);
             }
-            basic_iterator& operator++()
+            RANGES_CXX14_CONSTEXPR basic_iterator& operator++()
             {
                 range_access::next(pos());
                 return *this;
             }
-            postfix_increment_result_t operator++(int)
+            RANGES_CXX14_CONSTEXPR postfix_increment_result_t operator++(int)
             {
                 postfix_increment_result_t tmp{*this};
                 ++*this;
@@ -552,71 +552,71 @@ namespace ranges
                 return !(left == right);
             }
             CONCEPT_REQUIRES(detail::BidirectionalCursor<Cur>())
-            basic_iterator& operator--()
+            RANGES_CXX14_CONSTEXPR basic_iterator& operator--()
             {
                 range_access::prev(pos());
                 return *this;
             }
             CONCEPT_REQUIRES(detail::BidirectionalCursor<Cur>())
-            basic_iterator operator--(int)
+            RANGES_CXX14_CONSTEXPR basic_iterator operator--(int)
             {
                 basic_iterator tmp{*this};
                 --*this;
                 return tmp;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            basic_iterator& operator+=(difference_type n)
+            RANGES_CXX14_CONSTEXPR basic_iterator& operator+=(difference_type n)
             {
                 range_access::advance(pos(), n);
                 return *this;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            friend basic_iterator operator+(basic_iterator left, difference_type n)
+            friend RANGES_CXX14_CONSTEXPR basic_iterator operator+(basic_iterator left, difference_type n)
             {
                 left += n;
                 return left;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            friend basic_iterator operator+(difference_type n, basic_iterator right)
+            friend RANGES_CXX14_CONSTEXPR basic_iterator operator+(difference_type n, basic_iterator right)
             {
                 right += n;
                 return right;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            basic_iterator& operator-=(difference_type n)
+            RANGES_CXX14_CONSTEXPR basic_iterator& operator-=(difference_type n)
             {
                 range_access::advance(pos(), -n);
                 return *this;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            friend basic_iterator operator-(basic_iterator left, difference_type n)
+            friend RANGES_CXX14_CONSTEXPR basic_iterator operator-(basic_iterator left, difference_type n)
             {
                 left -= n;
                 return left;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            difference_type operator-(basic_iterator const &right) const
+            constexpr difference_type operator-(basic_iterator const &right) const
             {
                 return range_access::distance_to(right.pos(), pos());
             }
             // symmetric comparisons
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            bool operator<(basic_iterator const &that) const
+            constexpr bool operator<(basic_iterator const &that) const
             {
                 return 0 < (that - *this);
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            bool operator<=(basic_iterator const &that) const
+            constexpr bool operator<=(basic_iterator const &that) const
             {
                 return 0 <= (that - *this);
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            bool operator>(basic_iterator const &that) const
+            constexpr bool operator>(basic_iterator const &that) const
             {
                 return (that - *this) < 0;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            bool operator>=(basic_iterator const &that) const
+            constexpr bool operator>=(basic_iterator const &that) const
             {
                 return (that - *this) <= 0;
             }
@@ -670,7 +670,7 @@ namespace ranges
                 return true;
             }
             CONCEPT_REQUIRES(detail::RandomAccessCursor<Cur>())
-            typename operator_brackets_dispatch_t::type
+            constexpr typename operator_brackets_dispatch_t::type
             operator[](difference_type n) const
             {
                 return operator_brackets_dispatch_t::apply(*this + n);
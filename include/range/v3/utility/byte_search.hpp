@@ -0,0 +1,111 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_BYTE_SEARCH_HPP
+#define RANGES_V3_UTILITY_BYTE_SEARCH_HPP
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // Searching contiguous runs of bytes is handed to the C library, whose
+            // memchr, strchr and strlen scan a vector register's worth of bytes
+            // per step on every platform we care about.
+            template<typename T>
+            using is_byte = std::integral_constant<bool,
+                std::is_same<T, char>::value ||
+                std::is_same<T, signed char>::value ||
+                std::is_same<T, unsigned char>::value>;
+
+            template<typename I>
+            struct is_contiguous_byte_iterator
+              : std::false_type
+            {};
+
+            template<typename B>
+            struct is_contiguous_byte_iterator<B *>
+              : is_byte<typename std::remove_cv<B>::type>
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::string::iterator>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::string::const_iterator>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::vector<char>::iterator>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::vector<char>::const_iterator>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::vector<unsigned char>::iterator>
+              : std::true_type
+            {};
+
+            template<>
+            struct is_contiguous_byte_iterator<std::vector<unsigned char>::const_iterator>
+              : std::true_type
+            {};
+
+            // Returns the position of the first byte in [first, last) equal to
+            // val, or last if there is none.
+            template<typename I, typename V>
+            I find_byte(I first, I last, V val)
+            {
+                static_assert(is_contiguous_byte_iterator<I>::value,
+                    "find_byte requires an iterator into contiguous bytes");
+                if(first == last)
+                    return last;
+                auto const p = &*first;
+                void const *q = std::memchr(p, static_cast<unsigned char>(val),
+                    static_cast<std::size_t>(last - first));
+                using B = typename std::remove_pointer<decltype(p)>::type;
+                return q ? first + (static_cast<B const *>(q) - p) : last;
+            }
+
+            // Returns a pointer to the first byte at or after p that is either
+            // equal to val or is the null terminator.
+            template<typename B, typename V>
+            B *find_byte_or_nul(B *p, V val)
+            {
+                static_assert(is_byte<typename std::remove_cv<B>::type>::value,
+                    "find_byte_or_nul requires a pointer to bytes");
+                char const *const s = reinterpret_cast<char const *>(p);
+                char const *q = static_cast<unsigned char>(val) == 0u ? nullptr :
+                    std::strchr(s, static_cast<unsigned char>(val));
+                return p + ((q ? q : s + std::strlen(s)) - s);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
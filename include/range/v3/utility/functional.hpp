@@ -63,7 +63,7 @@ namespace ranges
         struct ident
         {
             template<typename T>
-            T && operator()(T && t) const noexcept
+            constexpr T && operator()(T && t) const noexcept
             {
                 return (T &&) t;
             }
@@ -72,7 +72,7 @@ namespace ranges
         struct plus
         {
             template<typename T, typename U>
-            auto operator()(T && t, U && u) const ->
+            constexpr auto operator()(T && t, U && u) const ->
                 decltype((T &&) t + (U &&) u)
             {
                 return (T &&) t + (U &&) u;
@@ -82,7 +82,7 @@ namespace ranges
         struct minus
         {
             template<typename T, typename U>
-            auto operator()(T && t, U && u) const ->
+            constexpr auto operator()(T && t, U && u) const ->
                 decltype((T &&) t - (U &&) u)
             {
                 return (T &&) t - (U &&) u;
@@ -92,7 +92,7 @@ namespace ranges
         struct multiplies
         {
             template<typename T, typename U>
-            auto operator()(T && t, U && u) const ->
+            constexpr auto operator()(T && t, U && u) const ->
                 decltype((T &&) t * (U &&) u)
             {
                 return (T &&) t * (U &&) u;
@@ -102,7 +102,7 @@ namespace ranges
         struct bitwise_or
         {
             template<typename T, typename U>
-            auto operator()(T && t, U && u) const ->
+            constexpr auto operator()(T && t, U && u) const ->
                 decltype((T &&) t | (U &&) u)
             {
                 return (T &&) t | (U &&) u;
@@ -155,17 +155,17 @@ namespace ranges
                 R (*pfn_)(Args...);
             public:
                 ptr_fn_() = default;
-                explicit ptr_fn_(R (*pfn)(Args...))
+                constexpr explicit ptr_fn_(R (*pfn)(Args...))
                   : pfn_(pfn)
                 {}
-                R operator()(Args...args) const
+                constexpr R operator()(Args...args) const
                 {
                     return (*pfn_)(std::forward<Args>(args)...);
                 }
             };
         public:
             template<typename R, typename ...Args>
-            ptr_fn_<R, Args...> operator()(R (*p)(Args...)) const
+            constexpr ptr_fn_<R, Args...> operator()(R (*p)(Args...)) const
             {
                 return ptr_fn_<R, Args...>(p);
             }
@@ -175,7 +175,7 @@ namespace ranges
                 return std::mem_fn(p);
             }
             template<typename T, typename U = detail::decay_t<T>>
-            auto operator()(T && t) const ->
+            constexpr auto operator()(T && t) const ->
                 enable_if_t<!std::is_pointer<U>::value && !std::is_member_pointer<U>::value, T>
             {
                 return std::forward<T>(t);
@@ -827,7 +827,7 @@ namespace ranges
           : ImplFn
         {
         private:
-            ImplFn const & base() const
+            constexpr ImplFn const & base() const
             {
                 return *this;
             }
@@ -835,21 +835,21 @@ namespace ranges
             using ImplFn::operator();
 
             template<typename V0, typename...Args>
-            auto operator()(std::initializer_list<V0> &&rng0, Args &&...args) const ->
+            constexpr auto operator()(std::initializer_list<V0> &&rng0, Args &&...args) const ->
                 decltype(std::declval<ImplFn const &>()(std::move(rng0), std::declval<Args>()...))
             {
                 return base()(std::move(rng0), std::forward<Args>(args)...);
             }
             /// \overload
             template<typename Rng0, typename V1, typename...Args>
-            auto operator()(Rng0 && rng0, std::initializer_list<V1> &&rng1, Args &&...args) const ->
+            constexpr auto operator()(Rng0 && rng0, std::initializer_list<V1> &&rng1, Args &&...args) const ->
                 decltype(std::declval<ImplFn const &>()(std::declval<Rng0>(), std::move(rng1), std::declval<Args>()...))
             {
                 return base()(std::forward<Rng0>(rng0), std::move(rng1), std::forward<Args>(args)...);
             }
             /// \overload
             template<typename V0, typename V1, typename...Args>
-            auto operator()(std::initializer_list<V0> rng0, std::initializer_list<V1> &&rng1, Args &&...args) const ->
+            constexpr auto operator()(std::initializer_list<V0> rng0, std::initializer_list<V1> &&rng1, Args &&...args) const ->
                 decltype(std::declval<ImplFn const &>()(std::move(rng0), std::move(rng1), std::declval<Args>()...))
             {
                 return base()(std::move(rng0), std::move(rng1), std::forward<Args>(args)...);
@@ -0,0 +1,131 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_HASH_INDEX_HPP
+#define RANGES_V3_UTILITY_HASH_INDEX_HPP
+
+#include <limits>
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/functional.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // The distinct keys seen so far, in the order they were first seen. The
+            // keys live in a vector; an open-addressing table of indices into that
+            // vector, probed linearly and kept at most half full, finds them. Key
+            // number i can be used to index any other vector kept in step with
+            // the keys, such as one of per-key aggregates.
+            template<typename Key, typename Hash = std::hash<Key>, typename Eq = ranges::equal_to>
+            struct hash_index
+            {
+            private:
+                static constexpr std::size_t min_slots = 16;
+                static constexpr std::size_t bits = std::numeric_limits<std::size_t>::digits;
+                std::vector<Key> keys_;
+                // One more than the index of a key, or zero for an empty slot.
+                std::vector<std::size_t> slots_;
+                std::size_t shift_;
+                Hash hash_;
+                Eq eq_;
+
+                // Fibonacci hashing: take the high bits of the product with 2^N/phi,
+                // so that hashers that return their argument, like std::hash<int>,
+                // still spread keys that share their low bits.
+                std::size_t home(std::size_t h) const
+                {
+                    return (h * static_cast<std::size_t>(0x9E3779B97F4A7C15ull)) >> shift_;
+                }
+                std::size_t next(std::size_t i) const
+                {
+                    return (i + 1) & (slots_.size() - 1);
+                }
+                void rehash(std::size_t nslots)
+                {
+                    std::size_t log2 = 0;
+                    while((std::size_t(1) << log2) < nslots)
+                        ++log2;
+                    slots_.assign(std::size_t(1) << log2, 0);
+                    shift_ = bits - log2;
+                    for(std::size_t k = 0; k != keys_.size(); ++k)
+                    {
+                        std::size_t i = this->home(hash_(keys_[k]));
+                        while(slots_[i] != 0)
+                            i = this->next(i);
+                        slots_[i] = k + 1;
+                    }
+                }
+            public:
+                explicit hash_index(Hash hash = Hash{}, Eq eq = Eq{})
+                  : keys_{}, slots_{}, shift_(bits), hash_(std::move(hash)), eq_(std::move(eq))
+                {}
+                std::size_t size() const
+                {
+                    return keys_.size();
+                }
+                std::vector<Key> &keys()
+                {
+                    return keys_;
+                }
+                std::vector<Key> const &keys() const
+                {
+                    return keys_;
+                }
+                /// Makes room for \p n keys without rehashing.
+                void reserve(std::size_t n)
+                {
+                    keys_.reserve(n);
+                    if(2 * n > slots_.size())
+                        this->rehash(std::max(2 * n, min_slots));
+                }
+                void clear()
+                {
+                    keys_.clear();
+                    std::fill(slots_.begin(), slots_.end(), std::size_t(0));
+                }
+                /// Finds \p key, adding it if it is not there yet.
+                /// \return The index of the key, and whether it was added.
+                template<typename K>
+                std::pair<std::size_t, bool> insert(K && key)
+                {
+                    if(2 * (keys_.size() + 1) > slots_.size())
+                        this->rehash(std::max(2 * slots_.size(), min_slots));
+                    std::size_t i = this->home(hash_(key));
+                    for(; slots_[i] != 0; i = this->next(i))
+                        if(eq_(keys_[slots_[i] - 1], key))
+                            return {slots_[i] - 1, false};
+                    keys_.emplace_back(std::forward<K>(key));
+                    slots_[i] = keys_.size();
+                    return {keys_.size() - 1, true};
+                }
+            };
+
+            template<typename Key, typename Hash, typename Eq>
+            constexpr std::size_t hash_index<Key, Hash, Eq>::min_slots;
+
+            template<typename Key, typename Hash, typename Eq>
+            constexpr std::size_t hash_index<Key, Hash, Eq>::bits;
+        }
+        /// \endcond
+    }
+}
+
+#endif
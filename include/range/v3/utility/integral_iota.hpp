@@ -0,0 +1,72 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_INTEGRAL_IOTA_HPP
+#define RANGES_V3_UTILITY_INTEGRAL_IOTA_HPP
+
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/utility/meta.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // view::iota and view::ints of two integers, the elements of which
+            // some algorithms compute with in closed form rather than one by one.
+            template<typename Rng>
+            struct is_integral_iota
+              : std::false_type
+            {};
+
+            template<typename Val>
+            struct is_integral_iota<take_view<iota_view<Val>>>
+              : meta::bool_<std::is_integral<Val>::value && !std::is_same<Val, bool>::value>
+            {};
+
+            struct integral_iota_tag
+            {};
+
+            // first + (first + 1) + ... + (first + n - 1), modulo 2^N for the N
+            // bits of the unsigned type U, which is what adding up the elements
+            // one by one gives wherever it is defined.
+            template<typename U, typename Val, typename D>
+            RANGES_CXX14_CONSTEXPR U iota_sum(Val first, D n)
+            {
+                // Of n and n - 1, the even one is halved before either is
+                // reduced modulo 2^N, so the product is exact modulo 2^N.
+                bool const even = n % 2 == 0;
+                D const a = even ? n / 2 : n;
+                D const b = even ? n - 1 : (n - 1) / 2;
+                return static_cast<U>(static_cast<U>(first) * static_cast<U>(n) +
+                    static_cast<U>(a) * static_cast<U>(b));
+            }
+
+            // Whether val is one of first, first + 1, ..., first + n - 1.
+            template<typename Val, typename D>
+            constexpr bool iota_contains(Val first, D n, Val val)
+            {
+                using UV = meta::eval<std::make_unsigned<Val>>;
+                using UD = meta::eval<std::make_unsigned<D>>;
+                return !(val < first) &&
+                    static_cast<UD>(static_cast<UV>(static_cast<UV>(val) -
+                        static_cast<UV>(first))) < static_cast<UD>(n);
+            }
+        }
+        /// \endcond
+    }
+}
+
+#endif
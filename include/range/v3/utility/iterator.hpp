@@ -36,7 +36,7 @@ namespace ranges
             using std::advance;
 
             template<typename I>
-            void advance_impl(I &i, iterator_difference_t<I> n, concepts::InputIterator *)
+            RANGES_CXX14_CONSTEXPR void advance_impl(I &i, iterator_difference_t<I> n, concepts::InputIterator *)
             {
                 RANGES_ASSERT(n >= 0);
                 for(; n > 0; --n)
@@ -44,7 +44,7 @@ namespace ranges
             }
 
             template<typename I>
-            void advance_impl(I &i, iterator_difference_t<I> n, concepts::BidirectionalIterator *)
+            RANGES_CXX14_CONSTEXPR void advance_impl(I &i, iterator_difference_t<I> n, concepts::BidirectionalIterator *)
             {
                 if(n > 0)
                     for(; n > 0; --n)
@@ -55,7 +55,7 @@ namespace ranges
             }
 
             template<typename I>
-            void advance_impl(I &i, iterator_difference_t<I> n, concepts::RandomAccessIterator *)
+            RANGES_CXX14_CONSTEXPR void advance_impl(I &i, iterator_difference_t<I> n, concepts::RandomAccessIterator *)
             {
                 i += n;
             }
@@ -64,15 +64,22 @@ namespace ranges
             // decrement an iterator that is bidirectional from the perspective of range-v3,
             // but only input from the perspective of std::advance.
             template<typename Cur, typename Sent>
-            void advance(basic_iterator<Cur, Sent> &i, iterator_difference_t<basic_iterator<Cur, Sent>> n)
+            RANGES_CXX14_CONSTEXPR void advance(basic_iterator<Cur, Sent> &i, iterator_difference_t<basic_iterator<Cur, Sent>> n)
             {
                 adl_advance_detail::advance_impl(i, n, iterator_concept<basic_iterator<Cur, Sent>>{});
             }
 
+            // std::advance is not constexpr before C++17.
+            template<typename T>
+            RANGES_CXX14_CONSTEXPR void advance(T *&i, std::ptrdiff_t n)
+            {
+                i += n;
+            }
+
             struct advance_fn
             {
                 template<typename I>
-                void operator()(I &i, iterator_difference_t<I> n) const
+                RANGES_CXX14_CONSTEXPR void operator()(I &i, iterator_difference_t<I> n) const
                 {
                     // Use ADL here to give custom iterator types (like counted_iterator)
                     // a chance to optimize it (see view/counted.hpp)
@@ -92,24 +99,24 @@ namespace ranges
         {
         private:
             template<typename I, typename S>
-            static void impl(I &i, S s, concepts::IteratorRange*)
+            static RANGES_CXX14_CONSTEXPR void impl(I &i, S s, concepts::IteratorRange*)
             {
                 while(i != s)
                     ++i;
             }
             template<typename I, typename S>
-            static void impl(I &i, S s, concepts::SizedIteratorRange*)
+            static RANGES_CXX14_CONSTEXPR void impl(I &i, S s, concepts::SizedIteratorRange*)
             {
                 advance(i, s - i);
             }
         public:
             template<typename I>
-            void operator()(I &i, I s) const
+            RANGES_CXX14_CONSTEXPR void operator()(I &i, I s) const
             {
                 i = std::move(s);
             }
             template<typename I, typename S>
-            void operator()(I &i, S s) const
+            RANGES_CXX14_CONSTEXPR void operator()(I &i, S s) const
             {
                 advance_to_fn::impl(i, std::move(s), sized_iterator_range_concept<I, S>());
             }
@@ -126,7 +133,7 @@ namespace ranges
         {
         private:
             template<typename I, typename D, typename S>
-            static D impl(I &it, D n, S bound, concepts::IteratorRange*, concepts::InputIterator*)
+            static RANGES_CXX14_CONSTEXPR D impl(I &it, D n, S bound, concepts::IteratorRange*, concepts::InputIterator*)
             {
                 RANGES_ASSERT(0 <= n);
                 for(; 0 != n && it != bound; --n)
@@ -134,7 +141,7 @@ namespace ranges
                 return n;
             }
             template<typename I, typename D, typename S>
-            static D impl(I &it, D n, S bound, concepts::IteratorRange*,
+            static RANGES_CXX14_CONSTEXPR D impl(I &it, D n, S bound, concepts::IteratorRange*,
                 concepts::BidirectionalIterator*)
             {
                 if(0 <= n)
@@ -146,7 +153,7 @@ namespace ranges
                 return n;
             }
             template<typename I, typename D, typename S, typename Concept>
-            static D impl(I &it, D n, S bound, concepts::SizedIteratorRange*, Concept)
+            static RANGES_CXX14_CONSTEXPR D impl(I &it, D n, S bound, concepts::SizedIteratorRange*, Concept)
             {
                 D d = bound - it;
                 if(0 <= n ? n >= d : n <= d)
@@ -159,7 +166,7 @@ namespace ranges
             }
         public:
             template<typename I, typename S>
-            iterator_difference_t<I> operator()(I &it, iterator_difference_t<I> n, S bound) const
+            RANGES_CXX14_CONSTEXPR iterator_difference_t<I> operator()(I &it, iterator_difference_t<I> n, S bound) const
             {
                 return advance_bounded_fn::impl(it, n, std::move(bound),
                     sized_iterator_range_concept<I, S>(), iterator_concept<I>());
@@ -176,7 +183,7 @@ namespace ranges
         struct next_fn
         {
             template<typename I>
-            I operator()(I it, iterator_difference_t<I> n = 1) const
+            RANGES_CXX14_CONSTEXPR I operator()(I it, iterator_difference_t<I> n = 1) const
             {
                 advance(it, n);
                 return it;
@@ -193,7 +200,7 @@ namespace ranges
         struct prev_fn
         {
             template<typename I>
-            I operator()(I it, iterator_difference_t<I> n = 1) const
+            RANGES_CXX14_CONSTEXPR I operator()(I it, iterator_difference_t<I> n = 1) const
             {
                 advance(it, -n);
                 return it;
@@ -210,7 +217,7 @@ namespace ranges
         struct next_to_fn
         {
             template<typename I, typename S>
-            I operator()(I it, S s) const
+            RANGES_CXX14_CONSTEXPR I operator()(I it, S s) const
             {
                 advance_to(it, std::move(s));
                 return it;
@@ -227,7 +234,7 @@ namespace ranges
         struct next_bounded_fn
         {
             template<typename I, typename S>
-            I operator()(I it, iterator_difference_t<I> n, S bound) const
+            RANGES_CXX14_CONSTEXPR I operator()(I it, iterator_difference_t<I> n, S bound) const
             {
                 advance_bounded(it, n, std::move(bound));
                 return it;
@@ -245,27 +252,27 @@ namespace ranges
         {
         private:
             template<typename I, typename S, typename D>
-            std::pair<D, I> impl_i(I begin, S end, D d, concepts::IteratorRange*, concepts::IteratorRange*) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> impl_i(I begin, S end, D d, concepts::IteratorRange*, concepts::IteratorRange*) const
             {
                 for(; begin != end; ++begin)
                     ++d;
                 return {d, begin};
             }
             template<typename I, typename S, typename D>
-            std::pair<D, I> impl_i(I begin, S end_, D d, concepts::IteratorRange*, concepts::SizedIteratorRange*) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> impl_i(I begin, S end_, D d, concepts::IteratorRange*, concepts::SizedIteratorRange*) const
             {
                 I end = next_to(begin, end_);
                 return {(end - begin) + d, end};
             }
             template<typename I, typename S, typename D, typename Concept>
-            std::pair<D, I> impl_i(I begin, S end, D d, concepts::SizedIteratorRange*, Concept) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> impl_i(I begin, S end, D d, concepts::SizedIteratorRange*, Concept) const
             {
                 return {(end - begin) + d, next_to(begin, end)};
             }
         public:
             template<typename I, typename S, typename D = iterator_difference_t<I>,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() && Integral<D>())>
-            std::pair<D, I> operator()(I begin, S end, D d = 0) const
+            RANGES_CXX14_CONSTEXPR std::pair<D, I> operator()(I begin, S end, D d = 0) const
             {
                 return this->impl_i(std::move(begin), std::move(end), d,
                     sized_iterator_range_concept<I, S>(), sized_iterator_range_concept<I, I>());
@@ -283,19 +290,19 @@ namespace ranges
         {
         private:
             template<typename I, typename S, typename D>
-            D impl_i(I begin, S end, D d, concepts::IteratorRange*) const
+            RANGES_CXX14_CONSTEXPR D impl_i(I begin, S end, D d, concepts::IteratorRange*) const
             {
                 return iter_enumerate(std::move(begin), std::move(end), d).first;
             }
             template<typename I, typename S, typename D>
-            D impl_i(I begin, S end, D d, concepts::SizedIteratorRange*) const
+            RANGES_CXX14_CONSTEXPR D impl_i(I begin, S end, D d, concepts::SizedIteratorRange*) const
             {
                 return static_cast<D>(end - begin) + d;
             }
         public:
             template<typename I, typename S, typename D = iterator_difference_t<I>,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>() && Integral<D>())>
-            D operator()(I begin, S end, D d = 0) const
+            RANGES_CXX14_CONSTEXPR D operator()(I begin, S end, D d = 0) const
             {
                 return this->impl_i(std::move(begin), std::move(end), d,
                     sized_iterator_range_concept<I, S>());
@@ -313,7 +320,7 @@ namespace ranges
         {
         private:
             template<typename I, typename S>
-            int impl_i(I begin, S end, iterator_difference_t<I> n, concepts::IteratorRange*) const
+            RANGES_CXX14_CONSTEXPR int impl_i(I begin, S end, iterator_difference_t<I> n, concepts::IteratorRange*) const
             {
                 if (n >= 0) {
                     for (; n > 0; --n) {
@@ -329,7 +336,7 @@ namespace ranges
                 }
             }
             template<typename I, typename S>
-            int impl_i(I begin, S end, iterator_difference_t<I> n, concepts::SizedIteratorRange*) const
+            RANGES_CXX14_CONSTEXPR int impl_i(I begin, S end, iterator_difference_t<I> n, concepts::SizedIteratorRange*) const
             {
                 iterator_difference_t<I> dist = static_cast<iterator_difference_t<I>>(end - begin);
                 if (dist > n)
@@ -342,7 +349,7 @@ namespace ranges
         public:
             template<typename I, typename S,
                 CONCEPT_REQUIRES_(InputIterator<I>() && IteratorRange<I, S>())>
-            int operator()(I begin, S end, iterator_difference_t<I> n) const
+            RANGES_CXX14_CONSTEXPR int operator()(I begin, S end, iterator_difference_t<I> n) const
             {
                 return this->impl_i(std::move(begin), std::move(end), n,
                     sized_iterator_range_concept<I, S>());
@@ -360,7 +367,7 @@ namespace ranges
         struct iter_size_fn
         {
             template<typename I, typename S, CONCEPT_REQUIRES_(SizedIteratorRange<I, S>())>
-            iterator_size_t<I> operator()(I begin, S end) const
+            RANGES_CXX14_CONSTEXPR iterator_size_t<I> operator()(I begin, S end) const
             {
                 RANGES_ASSERT(0 <= (end - begin));
                 return static_cast<iterator_size_t<I>>(end - begin);
@@ -378,7 +385,7 @@ namespace ranges
         {
             template<typename Readable0, typename Readable1,
                 CONCEPT_REQUIRES_(IndirectlySwappable<Readable0, Readable1>())>
-            void operator()(Readable0 a, Readable1 b) const
+            RANGES_CXX14_CONSTEXPR void operator()(Readable0 a, Readable1 b) const
                 noexcept(is_nothrow_indirectly_swappable<Readable0, Readable1>::value)
             {
                 indirect_swap(std::move(a), std::move(b));
@@ -396,7 +403,7 @@ namespace ranges
         {
             template<typename I,
                 CONCEPT_REQUIRES_(Readable<I>())>
-            iterator_rvalue_reference_t<I> operator()(I const &i) const
+            RANGES_CXX14_CONSTEXPR iterator_rvalue_reference_t<I> operator()(I const &i) const
                 noexcept(noexcept(indirect_move(i)))
             {
                 return indirect_move(i);
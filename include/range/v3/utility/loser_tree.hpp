@@ -0,0 +1,161 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+#ifndef RANGES_V3_UTILITY_LOSER_TREE_HPP
+#define RANGES_V3_UTILITY_LOSER_TREE_HPP
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <range/v3/range_fwd.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            // A tournament over the heads of k sorted runs, for merging them. Each
+            // internal node of the tree holds the run that lost the match played
+            // there, and the root holds the overall winner, the run with the
+            // least head. When the winner's head is taken, only the matches on
+            // the path from its leaf to the root are replayed, against the losers
+            // stored along it: log2(k) comparisons per element, and no moves of
+            // elements. Ties go to the run that was added first, so merges are
+            // stable. The comparison and projection are passed in, rather than
+            // stored, so that the owner decides where they live.
+            template<typename I, typename S>
+            struct loser_tree
+            {
+            private:
+                struct run
+                {
+                    I it;
+                    S end;
+                };
+                std::vector<run> runs_;
+                // tree_[0] is the winner; tree_[n], for 0 < n < k, the loser at
+                // node n. The children of node n are 2n and 2n + 1, and run i
+                // is the leaf k + i.
+                std::vector<std::size_t> tree_;
+                std::size_t active_ = 0;
+
+                bool done(std::size_t i) const
+                {
+                    return runs_[i].it == runs_[i].end;
+                }
+                // Whether run a wins against run b, which is not exhausted. Of
+                // equivalent heads, the one of the earlier run wins; the index
+                // is looked at only when the heads are equivalent, since a
+                // branch on it would be as hard to predict as the comparison.
+                template<typename C, typename P>
+                bool beats_live(std::size_t a, std::size_t b, C &pred, P &proj) const
+                {
+                    return !done(a) && (pred(proj(*runs_[a].it), proj(*runs_[b].it)) ||
+                        (a < b && !pred(proj(*runs_[b].it), proj(*runs_[a].it))));
+                }
+                // Exhausted runs lose to all others.
+                template<typename C, typename P>
+                bool beats(std::size_t a, std::size_t b, C &pred, P &proj) const
+                {
+                    return done(b) || this->beats_live(a, b, pred, proj);
+                }
+            public:
+                void clear()
+                {
+                    runs_.clear();
+                    tree_.clear();
+                    active_ = 0;
+                }
+                void reserve(std::size_t k)
+                {
+                    runs_.reserve(k);
+                }
+                void add(I it, S end)
+                {
+                    runs_.push_back(run{std::move(it), std::move(end)});
+                }
+                /// Plays the tournament among the runs added so far.
+                template<typename C, typename P>
+                void build(C &pred, P &proj)
+                {
+                    std::size_t const k = runs_.size();
+                    active_ = 0;
+                    for(std::size_t i = 0; i != k; ++i)
+                        active_ += !done(i);
+                    if(k == 0)
+                    {
+                        tree_.clear();
+                        return;
+                    }
+                    std::vector<std::size_t> winners(2 * k);
+                    for(std::size_t i = 0; i != k; ++i)
+                        winners[k + i] = i;
+                    tree_.assign(k, 0);
+                    for(std::size_t n = k - 1; n != 0; --n)
+                    {
+                        std::size_t const a = winners[2 * n], b = winners[2 * n + 1];
+                        bool const a_wins = this->beats(a, b, pred, proj);
+                        winners[n] = a_wins ? a : b;
+                        tree_[n] = a_wins ? b : a;
+                    }
+                    tree_[0] = k == 1 ? 0 : winners[1];
+                }
+                bool empty() const
+                {
+                    return active_ == 0;
+                }
+                /// The number of runs that are not exhausted.
+                std::size_t active() const
+                {
+                    return active_;
+                }
+                /// The position of the least head. The tree must not be empty.
+                I const &top() const
+                {
+                    return runs_[tree_[0]].it;
+                }
+                /// The end of the winning run, for copying the rest of it once it
+                /// is the only one left.
+                S const &top_end() const
+                {
+                    return runs_[tree_[0]].end;
+                }
+                /// Advances the winning run past its head and replays its path.
+                template<typename C, typename P>
+                void pop(C &pred, P &proj)
+                {
+                    std::size_t w = tree_[0];
+                    std::size_t n = (runs_.size() + w) / 2;
+                    // A run that has just been exhausted loses to the first run
+                    // on its path that is not; from there on the matches are
+                    // between live runs.
+                    if(++runs_[w].it == runs_[w].end)
+                    {
+                        --active_;
+                        for(; n != 0 && done(w); n /= 2)
+                            if(!done(tree_[n]))
+                                std::swap(tree_[n], w);
+                    }
+                    for(; n != 0; n /= 2)
+                        if(this->beats_live(tree_[n], w, pred, proj))
+                            std::swap(tree_[n], w);
+                    tree_[0] = w;
+                }
+            };
+        }
+        /// \endcond
+    }
+}
+
+#endif
@@ -32,7 +32,7 @@ namespace ranges
             {
                 template<typename T,
                     typename U = meta::eval<std::remove_reference<T>>>
-                U && operator()(T && t) const noexcept
+                constexpr U && operator()(T && t) const noexcept
                 {
                     return static_cast<U &&>(t);
                 }
@@ -70,7 +70,7 @@ namespace ranges
             template<typename I,
                 typename R = decltype(*std::declval<I>()),
                 typename U = meta::eval<std::remove_reference<R>>>
-            aux::move_t<R> indirect_move(I const &i)
+            constexpr aux::move_t<R> indirect_move(I const &i)
                 noexcept(std::is_reference<R>::value ||
                     std::is_nothrow_constructible<detail::decay_t<U>, U &&>::value)
             {
@@ -80,7 +80,7 @@ namespace ranges
             struct indirect_move_fn
             {
                 template<typename I>
-                auto operator()(I const &i) const
+                constexpr auto operator()(I const &i) const
                     noexcept(noexcept(indirect_move(i))) ->
                     decltype(indirect_move(i))
                 {
@@ -60,15 +60,38 @@ namespace ranges
             swap(std::tuple<Ts...> &&left, std::tuple<Us...> &&right)
                 noexcept(meta::and_c<is_nothrow_swappable<Ts, Us>::value...>::value);
 
+            template<typename T, typename U>
+            using is_builtin_swap = meta::bool_<
+                std::is_same<T, U>::value && std::is_lvalue_reference<T>::value &&
+                !std::is_const<meta::eval<std::remove_reference<T>>>::value &&
+                (std::is_arithmetic<uncvref_t<T>>::value || std::is_pointer<uncvref_t<T>>::value)>;
+
             // Function wrapper here, now that declarations have been seen.
             struct swap_fn
             {
+            private:
+                // std::swap is not constexpr before C++20, so numbers and pointers,
+                // for which there can be no other swap, are exchanged here.
+                template<typename T>
+                static RANGES_CXX14_CONSTEXPR void impl_(T &t, T &u, std::true_type) noexcept
+                {
+                    T tmp = t;
+                    t = u;
+                    u = tmp;
+                }
                 template<typename T, typename U>
-                typename std::enable_if<is_swappable<T, U>::value>::type
-                operator()(T && t, U && u) const noexcept(is_nothrow_swappable<T, U>::value)
+                static void impl_(T && t, U && u, std::false_type)
+                    noexcept(is_nothrow_swappable<T, U>::value)
                 {
                     swap(std::forward<T>(t), std::forward<U>(u));
                 }
+            public:
+                template<typename T, typename U>
+                RANGES_CXX14_CONSTEXPR typename std::enable_if<is_swappable<T, U>::value>::type
+                operator()(T && t, U && u) const noexcept(is_nothrow_swappable<T, U>::value)
+                {
+                    swap_fn::impl_(std::forward<T>(t), std::forward<U>(u), is_builtin_swap<T, U>());
+                }
             };
 
             // Now implementations
@@ -135,7 +158,7 @@ namespace ranges
 
             // Forward-declarations first!
             template<typename Readable0, typename Readable1>
-            typename std::enable_if<
+            RANGES_CXX14_CONSTEXPR typename std::enable_if<
                 is_swappable<decltype(*std::declval<Readable0>()),
                              decltype(*std::declval<Readable1>())>::value>::type
             indirect_swap(Readable0 a, Readable1 b)
@@ -157,7 +180,7 @@ namespace ranges
             struct indirect_swap_fn
             {
                 template<typename Readable0, typename Readable1>
-                typename std::enable_if<is_indirectly_swappable<Readable0, Readable1>::value>::type
+                RANGES_CXX14_CONSTEXPR typename std::enable_if<is_indirectly_swappable<Readable0, Readable1>::value>::type
                 operator()(Readable0 a, Readable1 b) const
                     noexcept(is_nothrow_indirectly_swappable<Readable0, Readable1>::value)
                 {
@@ -190,14 +213,14 @@ namespace ranges
             //    properly constrain std::iter_swap and rename this.
 
             template<typename Readable0, typename Readable1>
-            typename std::enable_if<
+            RANGES_CXX14_CONSTEXPR typename std::enable_if<
                 is_swappable<decltype(*std::declval<Readable0>()),
                              decltype(*std::declval<Readable1>())>::value>::type
             indirect_swap(Readable0 a, Readable1 b)
                 noexcept(is_nothrow_swappable<decltype(*std::declval<Readable0>()),
                                               decltype(*std::declval<Readable1>())>::value)
             {
-                swap(*a, *b);
+                swap_fn{}(*a, *b);
             }
 
             template<typename Readable0, typename Readable1>
@@ -21,10 +21,13 @@
 #include <range/v3/view/any_range.hpp>
 #include <range/v3/view/bounded.hpp>
 #include <range/v3/view/c_str.hpp>
+#include <range/v3/view/cache_begin.hpp>
+#include <range/v3/view/chunk.hpp>
 #include <range/v3/view/concat.hpp>
 #include <range/v3/view/const.hpp>
 #include <range/v3/view/counted.hpp>
 #include <range/v3/view/delimit.hpp>
+#include <range/v3/view/distinct.hpp>
 #include <range/v3/view/drop.hpp>
 #include <range/v3/view/drop_while.hpp>
 #include <range/v3/view/empty.hpp>
@@ -38,6 +41,7 @@
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/join.hpp>
 #include <range/v3/view/map.hpp>
+#include <range/v3/view/merge_k.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/partial_sum.hpp>
 #include <range/v3/view/repeat.hpp>
@@ -48,6 +52,9 @@
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/single.hpp>
 #include <range/v3/view/slice.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/sliding_extremum.hpp>
+#include <range/v3/view/sliding_fold.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/tail.hpp>
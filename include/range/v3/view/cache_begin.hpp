@@ -0,0 +1,129 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CACHE_BEGIN_HPP
+#define RANGES_V3_VIEW_CACHE_BEGIN_HPP
+
+#include <memory>
+#include <utility>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_interface.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// Moves a view into storage that all copies of this view share, with
+        /// the begin iterator of the view cached alongside it. However often
+        /// the view is copied, `begin` of the wrapped view is called at most
+        /// once, and every later call to `begin` on any copy is O(1). Copying
+        /// costs a reference count update. The copies share the cache, so
+        /// calling `begin` on copies in different threads is a data race until
+        /// it has been called once.
+        template<typename Rng>
+        struct cache_begin_view
+          : range_interface<cache_begin_view<Rng>, is_infinite<Rng>::value>
+        {
+        private:
+            struct state
+            {
+                Rng rng_;
+                optional<range_iterator_t<Rng>> begin_;
+            };
+            std::shared_ptr<state> state_;
+        public:
+            cache_begin_view() = default;
+            explicit cache_begin_view(Rng rng)
+              : state_(std::make_shared<state>(state{std::move(rng), {}}))
+            {}
+            range_iterator_t<Rng> begin() const
+            {
+                auto &begin_ = state_->begin_;
+                if(!begin_)
+                    begin_ = ranges::begin(state_->rng_);
+                return *begin_;
+            }
+            range_sentinel_t<Rng> end() const
+            {
+                return ranges::end(state_->rng_);
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            range_size_t<Rng> size() const
+            {
+                return ranges::size(state_->rng_);
+            }
+            Rng const & base() const
+            {
+                return state_->rng_;
+            }
+        };
+
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct copies_share_iterators<cache_begin_view<Rng>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
+        namespace view
+        {
+            struct cache_begin_fn
+            {
+                template<typename Rng>
+                using Concept = ForwardIterable<Rng>;
+
+                template<typename Rng, CONCEPT_REQUIRES_(Concept<Rng>())>
+                cache_begin_view<all_t<Rng>> operator()(Rng && rng) const
+                {
+                    return cache_begin_view<all_t<Rng>>{all(std::forward<Rng>(rng))};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                // For error reporting
+                template<typename Rng, CONCEPT_REQUIRES_(!Concept<Rng>())>
+                void operator()(Rng &&) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::cache_begin operates must be a model of the "
+                        "ForwardIterable concept.");
+                }
+            #endif
+            };
+
+            /// \relates cache_begin_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& cache_begin = static_const<view<cache_begin_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,279 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2013-2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_CHUNK_HPP
+#define RANGES_V3_VIEW_CHUNK_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+        template<typename Rng>
+        struct chunk_view
+          : range_facade<chunk_view<Rng>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            using size_type_ = range_size_t<Rng>;
+            // Random-access, sized bases get a random-access range of chunks. The
+            // chunk position is kept as an offset from the start of the base, so
+            // moving to any chunk is O(1).
+            using random_access_t =
+                meta::and_<RandomAccessIterable<Rng>, SizedIterable<Rng>>;
+            Rng rng_;
+            difference_type_ n_;
+
+            // Forward-only cursor: the end of the current chunk is found eagerly so
+            // that the chunk can be handed out as a sized range.
+            template<bool IsConst>
+            struct forward_cursor
+            {
+            private:
+                friend range_access;
+                friend chunk_view;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                range_iterator_t<base_t> cur_;
+                range_iterator_t<base_t> next_;
+                range_sentinel_t<base_t> last_;
+                difference_type_ n_;
+                size_type_ size_;
+
+                void satisfy()
+                {
+                    next_ = cur_;
+                    size_ = static_cast<size_type_>(n_ - advance_bounded(next_, n_, last_));
+                }
+                sized_range<iterator_t> current() const
+                {
+                    return {cur_, next_, size_};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(cur_ != last_);
+                    cur_ = next_;
+                    this->satisfy();
+                }
+                bool done() const
+                {
+                    return cur_ == last_;
+                }
+                bool equal(forward_cursor const &that) const
+                {
+                    return cur_ == that.cur_;
+                }
+                forward_cursor(begin_tag, base_t &rng, difference_type_ n)
+                  : cur_(ranges::begin(rng)), next_{}, last_(ranges::end(rng)), n_(n), size_{}
+                {
+                    this->satisfy();
+                }
+            public:
+                forward_cursor() = default;
+            };
+
+            template<bool IsConst>
+            struct random_access_cursor
+            {
+            private:
+                friend range_access;
+                friend chunk_view;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t first_;
+                difference_type_ pos_;
+                difference_type_ size_;
+                difference_type_ n_;
+
+                // Index of the chunk that starts at pos_. Only the final chunk can be
+                // short, so the end position rounds up to one past the last chunk.
+                difference_type_ chunk_index() const
+                {
+                    return (pos_ + n_ - 1) / n_;
+                }
+                range<iterator_t> current() const
+                {
+                    RANGES_ASSERT(pos_ < size_);
+                    return {first_ + pos_, first_ + (size_ - pos_ < n_ ? size_ : pos_ + n_)};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(pos_ < size_);
+                    pos_ = size_ - pos_ < n_ ? size_ : pos_ + n_;
+                }
+                void prev()
+                {
+                    RANGES_ASSERT(pos_ > 0);
+                    pos_ = ((pos_ - 1) / n_) * n_;
+                }
+                void advance(difference_type_ n)
+                {
+                    difference_type_ const pos = (this->chunk_index() + n) * n_;
+                    RANGES_ASSERT(pos >= 0 && pos - size_ < n_);
+                    pos_ = pos < size_ ? pos : size_;
+                }
+                difference_type_ distance_to(random_access_cursor const &that) const
+                {
+                    return that.chunk_index() - this->chunk_index();
+                }
+                bool done() const
+                {
+                    return pos_ == size_;
+                }
+                bool equal(random_access_cursor const &that) const
+                {
+                    return pos_ == that.pos_;
+                }
+                random_access_cursor(begin_tag, base_t &rng, difference_type_ n)
+                  : first_(ranges::begin(rng)), pos_(0)
+                  , size_(static_cast<difference_type_>(ranges::size(rng))), n_(n)
+                {}
+                random_access_cursor(end_tag, base_t &rng, difference_type_ n)
+                  : random_access_cursor{begin_tag{}, rng, n}
+                {
+                    pos_ = size_;
+                }
+            public:
+                random_access_cursor() = default;
+            };
+
+            template<bool IsConst>
+            using cursor =
+                meta::if_<random_access_t, random_access_cursor<IsConst>, forward_cursor<IsConst>>;
+            template<bool IsConst>
+            using sentinel = meta::if_<random_access_t, cursor<IsConst>, default_sentinel>;
+
+            template<bool IsConst, typename BaseRng>
+            static sentinel<IsConst> end_cursor_(BaseRng &rng, difference_type_ n, std::true_type)
+            {
+                return {end_tag{}, rng, n};
+            }
+            template<bool IsConst, typename BaseRng>
+            static sentinel<IsConst> end_cursor_(BaseRng &, difference_type_, std::false_type)
+            {
+                return {};
+            }
+
+            cursor<false> begin_cursor()
+            {
+                return {begin_tag{}, rng_, n_};
+            }
+            sentinel<false> end_cursor()
+            {
+                return chunk_view::end_cursor_<false>(rng_, n_, random_access_t{});
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {begin_tag{}, rng_, n_};
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            sentinel<true> end_cursor() const
+            {
+                return chunk_view::end_cursor_<true>(rng_, n_, random_access_t{});
+            }
+        public:
+            chunk_view() = default;
+            chunk_view(Rng rng, difference_type_ n)
+              : rng_(std::move(rng)), n_(n)
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            size_type_ size() const
+            {
+                return (ranges::size(rng_) + static_cast<size_type_>(n_) - 1) /
+                    static_cast<size_type_>(n_);
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct chunk_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(chunk_fn chunk, Int n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(chunk, std::placeholders::_1, n))
+                )
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Int, CONCEPT_REQUIRES_(!Integral<Int>())>
+                static detail::null_pipe bind(chunk_fn, Int)
+                {
+                    CONCEPT_ASSERT_MSG(Integral<Int>(),
+                        "The object passed to view::chunk must be a model of the Integral concept.");
+                    return {};
+                }
+            #endif
+            public:
+                template<typename Rng, CONCEPT_REQUIRES_(ForwardIterable<Rng>())>
+                chunk_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    return {all(std::forward<Rng>(rng)), n};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, CONCEPT_REQUIRES_(!ForwardIterable<Rng>())>
+                void operator()(Rng &&, T) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::chunk operates must be a model of the "
+                        "ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(Integral<T>(),
+                        "The second argument to view::chunk must be a model of the Integral "
+                        "concept.");
+                }
+            #endif
+            };
+
+            /// \relates chunk_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& chunk = static_const<view<chunk_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/tuple_algorithm.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 #include <range/v3/view/all.hpp>
 
 namespace ranges
@@ -63,6 +64,7 @@ namespace ranges
             using difference_type_ = common_type_t<range_difference_t<Rngs>...>;
             using size_type_ = meta::eval<std::make_unsigned<difference_type_>>;
             static constexpr std::size_t cranges{sizeof...(Rngs)};
+            using reference_ = common_reference_t<range_reference_t<Rngs const>...>;
             std::tuple<Rngs...> rngs_;
 
             struct sentinel;
@@ -206,6 +208,10 @@ namespace ranges
                 cursor(concat_view const &rng, end_tag)
                   : rng_(&rng), its_{meta::size_t<cranges-1>{}, end(std::get<cranges-1>(rng.rngs_))}
                 {}
+                template<std::size_t N, typename I>
+                cursor(concat_view const &rng, meta::size_t<N> which, I it)
+                  : rng_(&rng), its_{which, std::move(it)}
+                {}
                 reference current() const
                 {
                     // Kind of a dumb implementation. Surely there's a better way.
@@ -255,6 +261,39 @@ namespace ranges
                         ranges::get<cranges - 1>(pos.its_) == end_;
                 }
             };
+            // Passes the elements of each range on to fun as the reference type
+            // of the concatenation.
+            template<typename F>
+            struct push_fun
+            {
+                F &fun;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return fun(static_cast<reference_>(static_cast<T &&>(t)));
+                }
+            };
+            template<typename F>
+            cursor for_each_while_(F &fun, meta::size_t<cranges - 1> which) const
+            {
+                auto &rng = std::get<cranges - 1>(rngs_);
+                return {*this, which, ranges::for_each_while(rng, push_fun<F>{fun})};
+            }
+            template<typename F, std::size_t N>
+            cursor for_each_while_(F &fun, meta::size_t<N> which) const
+            {
+                auto &rng = std::get<N>(rngs_);
+                auto it = ranges::for_each_while(rng, push_fun<F>{fun});
+                if(it != ranges::end(rng))
+                    return {*this, which, std::move(it)};
+                return this->for_each_while_(fun, meta::size_t<N + 1>{});
+            }
+            template<typename F, typename D = concat_view,
+                CONCEPT_REQUIRES_(Same<D, concat_view>())>
+            range_iterator_t<D const> for_each_while(F &fun) const
+            {
+                return {this->for_each_while_(fun, meta::size_t<0>{})};
+            }
             cursor begin_cursor() const
             {
                 return {*this, begin_tag{}};
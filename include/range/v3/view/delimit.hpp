@@ -49,6 +49,10 @@ namespace ranges
                 {
                     return it == end || *it == value_;
                 }
+                Val const &value() const
+                {
+                    return value_;
+                }
                 Val value_;
             };
 
@@ -0,0 +1,198 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_DISTINCT_HPP
+#define RANGES_V3_VIEW_DISTINCT_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/hash_index.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename P>
+            using distinct_key_t =
+                decay_t<concepts::Invokable::result_t<P, range_reference_t<Rng>>>;
+        }
+        /// \endcond
+
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of a range whose projections have not been seen before,
+        /// in their original order. Unlike `view::unique`, equal keys need not be
+        /// adjacent: each distinct key is remembered in a hash table, so the
+        /// range is single-pass, and iterating it again starts afresh.
+        /// Incrementing an iterator searches straight away for the next element
+        /// with a new key. Bounding an infinite source with `take(n)` therefore
+        /// still searches past the n-th element, and never returns if there is
+        /// no other key to find.
+        template<typename Rng, typename P, typename H>
+        struct distinct_view
+          : range_facade<distinct_view<Rng, P, H>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using key_t = detail::distinct_key_t<Rng, P>;
+            Rng rng_;
+            semiregular_t<invokable_t<P>> proj_;
+            detail::hash_index<key_t, semiregular_t<H>> seen_;
+
+            struct cursor
+            {
+            private:
+                distinct_view *rng_;
+                range_iterator_t<Rng> cur_;
+                void satisfy()
+                {
+                    auto &&proj = rng_->proj_;
+                    auto &&seen = rng_->seen_;
+                    auto const end = ranges::end(rng_->rng_);
+                    for(; cur_ != end; ++cur_)
+                        if(seen.insert(proj(*cur_)).second)
+                            break;
+                }
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                explicit cursor(distinct_view &rng)
+                  : rng_(&rng), cur_(ranges::begin(rng.rng_))
+                {
+                    this->satisfy();
+                }
+                auto current() const -> decltype(*cur_)
+                {
+                    return *cur_;
+                }
+                void next()
+                {
+                    ++cur_;
+                    this->satisfy();
+                }
+                bool done() const
+                {
+                    return cur_ == ranges::end(rng_->rng_);
+                }
+            };
+            void reserve_(std::true_type)
+            {
+                seen_.reserve(static_cast<std::size_t>(ranges::size(rng_)));
+            }
+            void reserve_(std::false_type)
+            {}
+            cursor begin_cursor()
+            {
+                seen_.clear();
+                this->reserve_(SizedIterable<Rng>());
+                return cursor{*this};
+            }
+        public:
+            distinct_view() = default;
+            distinct_view(Rng rng, P proj, H hash)
+              : rng_(std::move(rng))
+              , proj_(invokable(std::move(proj)))
+              , seen_(std::move(hash))
+            {}
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct distinct_fn
+            {
+            private:
+                friend view_access;
+                template<typename P, CONCEPT_REQUIRES_(!Iterable<P>())>
+                static auto bind(distinct_fn distinct, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(distinct, std::placeholders::_1,
+                        protect(std::move(proj))))
+                )
+                template<typename P, typename H, CONCEPT_REQUIRES_(!Iterable<P>())>
+                static auto bind(distinct_fn distinct, P proj, H hash)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(distinct, std::placeholders::_1,
+                        protect(std::move(proj)), protect(std::move(hash))))
+                )
+            public:
+                template<typename Rng, typename P, typename H>
+                using Concept = meta::and_<
+                    InputIterable<Rng>,
+                    Invokable<P, range_reference_t<Rng>>,
+                    Function<H, detail::distinct_key_t<Rng, P> const &>>;
+
+                /// \param proj Maps each element to the key that identifies it.
+                /// \param hash Hashes keys; keys are compared with `==`.
+                template<typename Rng, typename P = ident,
+                    typename H = std::hash<detail::distinct_key_t<Rng, P>>,
+                    CONCEPT_REQUIRES_(Concept<Rng, P, H>())>
+                distinct_view<all_t<Rng>, P, H>
+                operator()(Rng && rng, P proj = P{}, H hash = H{}) const
+                {
+                    return {all(std::forward<Rng>(rng)), std::move(proj), std::move(hash)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename P = ident,
+                    CONCEPT_REQUIRES_(!InputIterable<Rng>() ||
+                        !Invokable<P, range_reference_t<Rng>>())>
+                void operator()(Rng &&, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rng>(),
+                        "The first argument to view::distinct must be a model of the "
+                        "InputIterable concept");
+                    CONCEPT_ASSERT_MSG(Invokable<P, range_reference_t<Rng>>(),
+                        "The projection passed to view::distinct must be callable with "
+                        "a value of the range");
+                }
+            #endif
+            };
+
+            /// \relates distinct_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& distinct = static_const<view<distinct_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
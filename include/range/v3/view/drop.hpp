@@ -35,20 +35,39 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            using drop_begin_cache_t = meta::if_<
+                RandomAccessIterable<Rng>,
+                empty,
+                box<optional<range_iterator_t<Rng>>, begin_tag>>;
+        }
+        /// \endcond
+
+        /// Unless the base is random-access, the first call to `begin` is
+        /// O(n) and the result is cached. Copies of the view keep the cache
+        /// when iterators into the base are valid for copies of it too, as for
+        /// views of containers; otherwise each copy searches again. Wrap the
+        /// view in `view::cache_begin` to share one search among all copies.
         template<typename Rng>
         struct drop_view
           : range_interface<drop_view<Rng>, is_infinite<Rng>::value>
-          , private meta::if_<
-                RandomAccessIterable<Rng>,
-                detail::empty,
-                box<optional<range_iterator_t<Rng>>, begin_tag>>
+          , private detail::drop_begin_cache_t<Rng>
         {
         private:
             friend range_access;
             using difference_type_ = range_difference_t<Rng>;
+            using begin_cache_t = detail::drop_begin_cache_t<Rng>;
             Rng rng_;
             difference_type_ n_;
 
+            begin_cache_t const &begin_cache_() const
+            {
+                return *this;
+            }
+
             range_iterator_t<Rng> get_begin_(std::true_type) const
             {
                 return next(ranges::begin(rng_), n_);
@@ -60,20 +79,15 @@ namespace ranges
                     begin_ = next(ranges::begin(rng_), n_);
                 return *begin_;
             }
-            void dirty_(std::true_type)
-            {}
-            void dirty_(std::false_type)
-            {
-                auto &begin_ = ranges::get<begin_tag>(*this);
-                begin_.reset();
-            }
         public:
             drop_view() = default;
             drop_view(drop_view &&that)
-              : rng_(std::move(that).rng_), n_(that.n_)
+              : begin_cache_t(detail::copy_begin_cache<Rng>(that.begin_cache_()))
+              , rng_(std::move(that).rng_), n_(that.n_)
             {}
             drop_view(drop_view const &that)
-              : rng_(that.rng_), n_(that.n_)
+              : begin_cache_t(detail::copy_begin_cache<Rng>(that.begin_cache_()))
+              , rng_(that.rng_), n_(that.n_)
             {}
             drop_view(Rng rng, difference_type_ n)
               : rng_(std::move(rng)), n_(n)
@@ -82,16 +96,18 @@ namespace ranges
             }
             drop_view& operator=(drop_view &&that)
             {
+                static_cast<begin_cache_t &>(*this) =
+                    detail::copy_begin_cache<Rng>(that.begin_cache_());
                 rng_ = std::move(that).rng_;
                 n_ = that.n_;
-                this->dirty_(RandomAccessIterable<Rng>{});
                 return *this;
             }
             drop_view& operator=(drop_view const &that)
             {
+                static_cast<begin_cache_t &>(*this) =
+                    detail::copy_begin_cache<Rng>(that.begin_cache_());
                 rng_ = that.rng_;
                 n_ = that.n_;
-                this->dirty_(RandomAccessIterable<Rng>{});
                 return *this;
             }
             range_iterator_t<Rng> begin()
@@ -129,6 +145,16 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct copies_share_iterators<drop_view<Rng>>
+              : copies_share_iterators<Rng>
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct drop_fn
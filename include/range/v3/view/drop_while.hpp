@@ -20,6 +20,7 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_interface.hpp>
+#include <range/v3/range.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
@@ -34,6 +35,8 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+        /// The first call to `begin` is O(n) and the result is cached; copies
+        /// keep the cache under the same terms as those of `drop_view`.
         template<typename Rng, typename Pred>
         struct drop_while_view
           : range_interface<drop_while_view<Rng, Pred>, is_infinite<Rng>::value>
@@ -54,10 +57,12 @@ namespace ranges
         public:
             drop_while_view() = default;
             drop_while_view(drop_while_view &&that)
-              : rng_(std::move(that).rng_), pred_(std::move(that).pred_), begin_{}
+              : rng_(std::move(that).rng_), pred_(std::move(that).pred_)
+              , begin_(detail::copy_begin_cache<Rng>(that.begin_))
             {}
             drop_while_view(drop_while_view const &that)
-              : rng_(that.rng_), pred_(that.pred_), begin_{}
+              : rng_(that.rng_), pred_(that.pred_)
+              , begin_(detail::copy_begin_cache<Rng>(that.begin_))
             {}
             drop_while_view(Rng rng, Pred pred)
               : rng_(std::move(rng)), pred_(invokable(std::move(pred))), begin_{}
@@ -66,14 +71,14 @@ namespace ranges
             {
                 rng_ = std::move(that).rng_;
                 pred_ = std::move(that).pred_;
-                begin_.reset();
+                begin_ = detail::copy_begin_cache<Rng>(that.begin_);
                 return *this;
             }
             drop_while_view& operator=(drop_while_view const &that)
             {
                 rng_ = that.rng_;
                 pred_ = that.pred_;
-                begin_.reset();
+                begin_ = detail::copy_begin_cache<Rng>(that.begin_);
                 return *this;
             }
             range_iterator_t<Rng> begin()
@@ -94,6 +99,16 @@ namespace ranges
             }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng, typename Pred>
+            struct copies_share_iterators<drop_while_view<Rng, Pred>>
+              : copies_share_iterators<Rng>
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct drop_while_fn
@@ -119,20 +119,20 @@ namespace ranges
             using iota_difference_t = meta::eval<iota_difference<Val>>;
 
             template<typename Val, CONCEPT_REQUIRES_(!Integral<Val>())>
-            iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
+            constexpr iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
             {
                 return v0 - v1;
             }
 
             template<typename Val, CONCEPT_REQUIRES_(SignedIntegral<Val>())>
-            iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
+            constexpr iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
             {
                 using D = iota_difference_t<Val>;
                 return (D) v0 - (D) v1;
             }
 
             template<typename Val, CONCEPT_REQUIRES_(UnsignedIntegral<Val>())>
-            iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
+            constexpr iota_difference_t<Val> iota_minus(Val const &v0, Val const &v1)
             {
                 using D = iota_difference_t<Val>;
                 return (D) (v0 - v1);
@@ -157,45 +157,45 @@ namespace ranges
             Val2 to_;
             bool done_ = false;
 
-            Val current() const
+            constexpr Val current() const
             {
                 return from_;
             }
-            void next()
+            RANGES_CXX14_CONSTEXPR void next()
             {
                 if(from_ == to_)
                     done_ = true;
                 else
                     ++from_;
             }
-            bool done() const
+            constexpr bool done() const
             {
                 return done_;
             }
             CONCEPT_REQUIRES(Incrementable<Val>())
-            bool equal(iota_view const &that) const
+            constexpr bool equal(iota_view const &that) const
             {
                 return that.from_ == from_;
             }
             CONCEPT_REQUIRES(BidirectionalIncrementable<Val>())
-            void prev()
+            RANGES_CXX14_CONSTEXPR void prev()
             {
                 --from_;
             }
             CONCEPT_REQUIRES(RandomAccessIncrementable<Val>())
-            void advance(difference_type_ n)
+            RANGES_CXX14_CONSTEXPR void advance(difference_type_ n)
             {
                 RANGES_ASSERT(detail::iota_minus(to_, from_) >= n);
                 from_ += n;
             }
             CONCEPT_REQUIRES(RandomAccessIncrementable<Val>())
-            difference_type_ distance_to(iota_view const &that) const
+            constexpr difference_type_ distance_to(iota_view const &that) const
             {
                 return detail::iota_minus(that.from_, from_);
             }
         public:
             iota_view() = default;
-            iota_view(Val from, Val2 to)
+            constexpr iota_view(Val from, Val2 to)
               : from_(std::move(from)), to_(std::move(to))
             {}
         };
@@ -211,11 +211,11 @@ namespace ranges
 
             Val value_;
 
-            Val current() const
+            constexpr Val current() const
             {
                 return value_;
             }
-            void next()
+            RANGES_CXX14_CONSTEXPR void next()
             {
                 ++value_;
             }
@@ -224,22 +224,22 @@ namespace ranges
                 return false;
             }
             CONCEPT_REQUIRES(Incrementable<Val>())
-            bool equal(iota_view const &that) const
+            constexpr bool equal(iota_view const &that) const
             {
                 return that.value_ == value_;
             }
             CONCEPT_REQUIRES(BidirectionalIncrementable<Val>())
-            void prev()
+            RANGES_CXX14_CONSTEXPR void prev()
             {
                 --value_;
             }
             CONCEPT_REQUIRES(RandomAccessIncrementable<Val>())
-            void advance(difference_type_ n)
+            RANGES_CXX14_CONSTEXPR void advance(difference_type_ n)
             {
                 value_ += n;
             }
             CONCEPT_REQUIRES(RandomAccessIncrementable<Val>())
-            difference_type_ distance_to(iota_view const &that) const
+            constexpr difference_type_ distance_to(iota_view const &that) const
             {
                 return detail::iota_minus(that.value_, value_);
             }
@@ -256,13 +256,13 @@ namespace ranges
             {
             private:
                 template<typename Val>
-                static take_view<iota_view<Val>>
+                static constexpr take_view<iota_view<Val>>
                 impl(Val from, Val to, concepts::RandomAccessIncrementable *)
                 {
                     return {iota_view<Val>{std::move(from)}, detail::iota_minus(to, from) + 1};
                 }
                 template<typename Val, typename Val2>
-                static iota_view<Val, Val2>
+                static constexpr iota_view<Val, Val2>
                 impl(Val from, Val2 to, concepts::WeaklyIncrementable *)
                 {
                     return {std::move(from), std::move(to)};
@@ -270,14 +270,14 @@ namespace ranges
             public:
                 template<typename Val,
                     CONCEPT_REQUIRES_(WeaklyIncrementable<Val>())>
-                iota_view<Val> operator()(Val value) const
+                constexpr iota_view<Val> operator()(Val value) const
                 {
                     CONCEPT_ASSERT(WeaklyIncrementable<Val>());
                     return iota_view<Val>{std::move(value)};
                 }
                 template<typename Val, typename Val2,
                     CONCEPT_REQUIRES_(WeaklyIncrementable<Val>() && EqualityComparable<Val, Val2>())>
-                meta::if_<
+                constexpr meta::if_<
                     meta::and_<RandomAccessIncrementable<Val>, Same<Val, Val2>>,
                     take_view<iota_view<Val>>,
                     iota_view<Val, Val2>>
@@ -324,13 +324,13 @@ namespace ranges
 
                 template<typename Val,
                     CONCEPT_REQUIRES_(Integral<Val>())>
-                iota_view<Val> operator()(Val value) const
+                constexpr iota_view<Val> operator()(Val value) const
                 {
                     return iota_view<Val>{value};
                 }
                 template<typename Val,
                     CONCEPT_REQUIRES_(Integral<Val>())>
-                take_view<iota_view<Val>> operator()(Val from, Val to) const
+                constexpr take_view<iota_view<Val>> operator()(Val from, Val to) const
                 {
                     return {iota_view<Val>{from}, detail::iota_minus(to, from) + 1};
                 }
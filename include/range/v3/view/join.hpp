@@ -15,6 +15,7 @@
 #define RANGES_V3_VIEW_JOIN_HPP
 
 #include <utility>
+#include <functional>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
@@ -22,6 +23,7 @@
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -79,6 +81,9 @@ namespace ranges
                 adaptor(join_view &rng)
                   : rng_(&rng), it_{}
                 {}
+                adaptor(join_view &rng, range_iterator_t<range_value_t<Rng>> it)
+                  : rng_(&rng), it_(std::move(it))
+                {}
                 range_iterator_t<Rng> begin(join_view &)
                 {
                     auto it = ranges::begin(rng_->mutable_base());
@@ -130,6 +135,24 @@ namespace ranges
                 return {};
 #endif
             }
+            // Loops over each inner range in turn, setting cur_ as the
+            // iterators do, so that the position it stops at is an iterator.
+            template<typename F, typename D = join_view,
+                CONCEPT_REQUIRES_(Same<D, join_view>())>
+            range_iterator_t<D> for_each_while(F &fun)
+            {
+                auto &base = this->mutable_base();
+                auto it = ranges::begin(base);
+                auto const end = ranges::end(base);
+                for(; it != end; ++it)
+                {
+                    cur_ = view::all(*it);
+                    auto inner = ranges::for_each_while(cur_, std::ref(fun));
+                    if(inner != ranges::end(cur_))
+                        return this->iterator_at_(std::move(it), adaptor{*this, std::move(inner)});
+                }
+                return this->iterator_at_(std::move(it), this->end_adaptor());
+            }
             // TODO: could support const iteration if range_reference_t<Rng> is a true reference.
         public:
             join_view() = default;
@@ -0,0 +1,172 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_MERGE_K_HPP
+#define RANGES_V3_VIEW_MERGE_K_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/loser_tree.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The elements of a range of sorted ranges, merged into one sorted
+        /// sequence as it is iterated, so that only as much of the inputs is
+        /// read as the consumer asks for. The heads of the inner ranges play a
+        /// tournament in a loser tree, which the view keeps, so the view is
+        /// single-pass; iterating it again starts a new merge. Equivalent
+        /// elements come in the order of the ranges they belong to.
+        template<typename Rngs, typename C, typename P>
+        struct merge_k_view
+          : range_facade<merge_k_view<Rngs, C, P>, false>
+        {
+        private:
+            friend range_access;
+            using Rng = meta::eval<std::remove_reference<range_reference_t<Rngs>>>;
+            Rngs rngs_;
+            semiregular_t<invokable_t<C>> pred_;
+            semiregular_t<invokable_t<P>> proj_;
+            detail::loser_tree<range_iterator_t<Rng>, range_sentinel_t<Rng>> tree_;
+
+            struct cursor
+            {
+            private:
+                merge_k_view *rng_;
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                explicit cursor(merge_k_view &rng)
+                  : rng_(&rng)
+                {}
+                auto current() const -> decltype(*rng_->tree_.top())
+                {
+                    return *rng_->tree_.top();
+                }
+                void next()
+                {
+                    rng_->tree_.pop(rng_->pred_, rng_->proj_);
+                }
+                bool done() const
+                {
+                    return rng_->tree_.empty();
+                }
+            };
+            cursor begin_cursor()
+            {
+                tree_.clear();
+                for(auto &&rng : rngs_)
+                    tree_.add(begin(rng), end(rng));
+                tree_.build(pred_, proj_);
+                return cursor{*this};
+            }
+        public:
+            merge_k_view() = default;
+            merge_k_view(Rngs rngs, C pred, P proj)
+              : rngs_(std::move(rngs))
+              , pred_(invokable(std::move(pred)))
+              , proj_(invokable(std::move(proj)))
+            {}
+            Rngs & base()
+            {
+                return rngs_;
+            }
+            Rngs const & base() const
+            {
+                return rngs_;
+            }
+        };
+
+        namespace view
+        {
+            struct merge_k_fn
+            {
+            private:
+                friend view_access;
+                template<typename C, CONCEPT_REQUIRES_(!Iterable<C>())>
+                static auto bind(merge_k_fn merge_k, C pred)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(merge_k, std::placeholders::_1,
+                        protect(std::move(pred))))
+                )
+                template<typename C, typename P, CONCEPT_REQUIRES_(!Iterable<C>())>
+                static auto bind(merge_k_fn merge_k, C pred, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(merge_k, std::placeholders::_1,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+            public:
+                template<typename Rngs, typename C, typename P,
+                    typename Rng = meta::eval<std::remove_reference<range_reference_t<Rngs>>>,
+                    typename I = range_iterator_t<Rng>>
+                using Concept = meta::and_<
+                    InputIterable<Rngs>,
+                    std::is_lvalue_reference<range_reference_t<Rngs>>,
+                    InputIterable<Rng>,
+                    IndirectInvokableRelation<C, Project<I, P>, Project<I, P>>>;
+
+                /// \param pred The order the inner ranges are sorted by.
+                /// \param proj Projects the elements before comparing them.
+                template<typename Rngs, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rngs, C, P>())>
+                merge_k_view<all_t<Rngs>, C, P>
+                operator()(Rngs && rngs, C pred = C{}, P proj = P{}) const
+                {
+                    return {all(std::forward<Rngs>(rngs)), std::move(pred), std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rngs, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rngs, C, P>())>
+                void operator()(Rngs &&, C = C{}, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(InputIterable<Rngs>(),
+                        "The first argument to view::merge_k must be a model of the "
+                        "InputIterable concept");
+                    CONCEPT_ASSERT_MSG(std::is_lvalue_reference<range_reference_t<Rngs>>(),
+                        "The ranges merged by view::merge_k must be lvalues, since the "
+                        "view keeps iterators into them");
+                }
+            #endif
+            };
+
+            /// \relates merge_k_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& merge_k = static_const<view<merge_k_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -26,7 +26,6 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/utility/meta.hpp>
-#include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
@@ -48,63 +47,75 @@ namespace ranges
             semiregular_t<invokable_t<Fun>> fun_;
             using single_pass = SinglePass<range_iterator_t<Rng>>;
             using use_sentinel_t = meta::or_<meta::not_<BoundedIterable<Rng>>, single_pass>;
+            template<bool IsConst>
+            using fun_ref_t = semiregular_ref_or_val_t<invokable_t<Fun>, IsConst>;
 
+            // The iterators hold the function and the end of the base rather
+            // than a pointer back to the view.
             template<bool IsConst>
-            struct adaptor : adaptor_base
+            struct adaptor
+              : adaptor_base
+              , private detail::adaptor_fun<fun_ref_t<IsConst>>
             {
             private:
-                using partial_sum_view_t = meta::apply<meta::add_const_if_c<IsConst>, partial_sum_view>;
-                optional<range_value_t<Rng>> sum_;
-                partial_sum_view_t *rng_;
+                using fun_ref_ = fun_ref_t<IsConst>;
+                // Read only before the end is reached, so it needs no empty state
+                // of its own unless the value type has no default constructor.
+                semiregular_t<range_value_t<Rng>> sum_;
+                range_sentinel_t<Rng> end_;
                 using adaptor_base::prev;
             public:
                 using single_pass = partial_sum_view::single_pass;
                 adaptor() = default;
-                adaptor(partial_sum_view_t &rng)
-                  : sum_{}, rng_(&rng)
+                adaptor(fun_ref_ fun, range_sentinel_t<Rng> end)
+                  : detail::adaptor_fun<fun_ref_>(std::move(fun)), sum_(), end_(std::move(end))
                 {}
-                adaptor(partial_sum_view_t &rng, range_value_t<Rng> sum)
-                  : sum_(std::move(sum)), rng_(&rng)
+                adaptor(fun_ref_ fun, range_sentinel_t<Rng> end, range_value_t<Rng> sum)
+                  : detail::adaptor_fun<fun_ref_>(std::move(fun)), sum_(std::move(sum))
+                  , end_(std::move(end))
                 {}
                 range_value_t<Rng> current(range_iterator_t<Rng> it) const
                 {
-                    return *sum_;
+                    return sum_;
                 }
                 void next(range_iterator_t<Rng> &it)
                 {
                     using R = range_common_reference_t<Rng>;
-                    if(++it != ranges::end(rng_->mutable_base()))
+                    if(++it != end_)
                     {
-                        sum_ = rng_->fun_(R(*sum_), R(*it));
+                        range_value_t<Rng> &sum = sum_;
+                        sum_ = this->fun()(R(sum), R(*it));
                     }
                 }
             };
 
+            template<bool IsConst>
+            adaptor<IsConst> make_begin_adaptor_(fun_ref_t<IsConst> fun) const
+            {
+                auto &&base = this->mutable_base();
+                return empty(base) ? adaptor<IsConst>{std::move(fun), ranges::end(base)} :
+                    adaptor<IsConst>{std::move(fun), ranges::end(base), front(base)};
+            }
             adaptor<false> begin_adaptor()
             {
-                return empty(this->base()) ? adaptor<false>{*this} :
-                    adaptor<false>{*this, front(this->base())};
+                return this->make_begin_adaptor_<false>(fun_);
             }
+            // The end never reads its sum, so it is not given one.
             meta::if_<use_sentinel_t, adaptor_base, adaptor<false>> end_adaptor()
             {
-                if(use_sentinel_t() || empty(this->base()))
-                    return {*this};
-                return {*this, front(this->base())};
+                return {fun_, ranges::end(this->mutable_base())};
             }
             CONCEPT_REQUIRES(Invokable<Fun const, range_common_reference_t<Rng>,
                 range_common_reference_t<Rng>>())
             adaptor<true> begin_adaptor() const
             {
-                return empty(this->base()) ? adaptor<true>{*this} :
-                    adaptor<true>{*this, front(this->base())};
+                return this->make_begin_adaptor_<true>(fun_);
             }
             CONCEPT_REQUIRES(Invokable<Fun const, range_common_reference_t<Rng>,
                 range_common_reference_t<Rng>>())
             meta::if_<use_sentinel_t, adaptor_base, adaptor<true>> end_adaptor() const
             {
-                if(use_sentinel_t() || empty(this->base()))
-                    return {*this};
-                return {*this, front(this->base())};
+                return {fun_, ranges::end(this->mutable_base())};
             }
         public:
             partial_sum_view() = default;
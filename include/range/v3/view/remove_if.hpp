@@ -18,15 +18,18 @@
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
 #include <range/v3/range_concepts.hpp>
+#include <range/v3/utility/box.hpp>
 #include <range/v3/utility/meta.hpp>
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/algorithm/find_if_not.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 #include <range/v3/view/view.hpp>
 
 namespace ranges
@@ -35,6 +38,30 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+        /// \cond
+        namespace detail
+        {
+            // Passes the elements of the base that pred does not hold of on to
+            // fun.
+            template<typename P, typename F>
+            struct remove_if_sink
+            {
+                P &pred;
+                F &fun;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return pred(t) || fun(static_cast<T &&>(t));
+                }
+            };
+        }
+        /// \endcond
+
+        /// The first call to `begin` is O(n) and the result is cached. Copies
+        /// of the view keep the cache when iterators into the base are valid for
+        /// copies of it too, as for views of containers; otherwise each copy
+        /// searches again. Wrap the view in `view::cache_begin` to share one
+        /// search among all copies.
         template<typename Rng, typename Pred>
         struct remove_if_view
           : range_adaptor<remove_if_view<Rng, Pred>, Rng>
@@ -85,8 +112,13 @@ namespace ranges
             {
                 return {*this};
             }
-            // TODO: if end is a sentinel, it holds an unnecessary pointer back to
-            // this range.
+            // If end is a sentinel, it needs nothing from this range.
+            CONCEPT_REQUIRES(!BoundedIterable<Rng>())
+            adaptor_base end_adaptor()
+            {
+                return {};
+            }
+            CONCEPT_REQUIRES(BoundedIterable<Rng>())
             adaptor end_adaptor()
             {
                 return {*this};
@@ -96,12 +128,12 @@ namespace ranges
             remove_if_view(remove_if_view &&that)
               : range_adaptor_t<remove_if_view>(std::move(that))
               , pred_(std::move(that).pred_)
-              , begin_{}
+              , begin_(detail::copy_begin_cache<Rng>(that.begin_))
             {}
             remove_if_view(remove_if_view const &that)
               : range_adaptor_t<remove_if_view>(that)
               , pred_(that.pred_)
-              , begin_{}
+              , begin_(detail::copy_begin_cache<Rng>(that.begin_))
             {}
             remove_if_view(Rng rng, Pred pred)
               : range_adaptor_t<remove_if_view>{std::move(rng)}
@@ -112,18 +144,73 @@ namespace ranges
             {
                 this->range_adaptor_t<remove_if_view>::operator=(std::move(that));
                 pred_ = std::move(that).pred_;
-                begin_.reset();
+                begin_ = detail::copy_begin_cache<Rng>(that.begin_);
                 return *this;
             }
             remove_if_view& operator=(remove_if_view const &that)
             {
                 this->range_adaptor_t<remove_if_view>::operator=(that);
                 pred_ = that.pred_;
-                begin_.reset();
+                begin_ = detail::copy_begin_cache<Rng>(that.begin_);
                 return *this;
             }
+            /// The predicate of the elements that are removed.
+            invokable_t<Pred> const & pred() const
+            {
+                return pred_;
+            }
+        private:
+            template<typename F, typename D = remove_if_view,
+                CONCEPT_REQUIRES_(Same<D, remove_if_view>())>
+            range_iterator_t<D> for_each_while(F &fun)
+            {
+                detail::remove_if_sink<semiregular_t<invokable_t<Pred>>, F> sink{pred_, fun};
+                return this->iterator_at_(ranges::for_each_while(this->base(), sink));
+            }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_remove_if_view
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Pred>
+            struct is_remove_if_view<remove_if_view<Rng, Pred>>
+              : std::true_type
+            {};
+
+            // Whether either of two predicates holds. The second is asked only
+            // if the first does not hold, as it would be had the first removed
+            // the element already.
+            template<typename Pred0, typename Pred1>
+            struct either_pred
+              : private box<Pred0, meta::size_t<0>>
+              , private box<Pred1, meta::size_t<1>>
+            {
+                either_pred() = default;
+                either_pred(Pred0 pred0, Pred1 pred1)
+                  : box<Pred0, meta::size_t<0>>{std::move(pred0)}
+                  , box<Pred1, meta::size_t<1>>{std::move(pred1)}
+                {}
+                template<typename...Ts>
+                auto operator()(Ts &&...ts)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    static_cast<bool>(ranges::get<0>(*this)(ts...) || ranges::get<1>(*this)(ts...))
+                )
+                template<typename...Ts>
+                auto operator()(Ts &&...ts) const
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    static_cast<bool>(ranges::get<0>(*this)(ts...) || ranges::get<1>(*this)(ts...))
+                )
+            };
+        }
+        /// \endcond
+
         namespace view
         {
             struct remove_if_fn
@@ -143,12 +230,24 @@ namespace ranges
                     IndirectInvokablePredicate<Pred, range_iterator_t<Rng>>>;
 
                 template<typename Rng, typename Pred,
-                    CONCEPT_REQUIRES_(Concept<Rng, Pred>())>
+                    CONCEPT_REQUIRES_(Concept<Rng, Pred>() &&
+                        !detail::is_remove_if_view<detail::decay_t<Rng>>())>
                 remove_if_view<all_t<Rng>, Pred>
                 operator()(Rng && rng, Pred pred) const
                 {
                     return {all(std::forward<Rng>(rng)), std::move(pred)};
                 }
+                /// Removing elements from a `remove_if_view` makes one
+                /// `remove_if_view` of its base that removes the elements of
+                /// which either predicate holds, so that stacked filters make
+                /// one flat iterator rather than nested ones.
+                template<typename Rng, typename Pred, typename Pred0,
+                    CONCEPT_REQUIRES_(Concept<remove_if_view<Rng, Pred0>, Pred>())>
+                remove_if_view<Rng, detail::either_pred<invokable_t<Pred0>, invokable_t<Pred>>>
+                operator()(remove_if_view<Rng, Pred0> rng, Pred pred) const
+                {
+                    return {std::move(rng.base()), {rng.pred(), invokable(std::move(pred))}};
+                }
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Pred,
                     CONCEPT_REQUIRES_(!Concept<Rng, Pred>())>
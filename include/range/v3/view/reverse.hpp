@@ -16,11 +16,17 @@
 
 #include <utility>
 #include <iterator>
+#include <type_traits>
 #include <range/v3/range_fwd.hpp>
 #include <range/v3/size.hpp>
 #include <range/v3/begin_end.hpp>
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_adaptor.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/utility/box.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/optional.hpp>
+#include <range/v3/utility/iterator.hpp>
 #include <range/v3/utility/static_const.hpp>
 #include <range/v3/view/view.hpp>
 
@@ -30,77 +36,137 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            using reverse_end_cache_t = meta::if_<
+                BoundedIterable<Rng>,
+                empty,
+                box<optional<range_iterator_t<Rng>>, end_tag>>;
+        }
+        /// \endcond
+
+        /// The elements of a bidirectional range in reverse order. Like
+        /// `std::reverse_iterator`, a position holds the base iterator one past
+        /// the element it denotes, so moving and comparing positions are plain
+        /// operations on the base iterator, with no checks against the ends of
+        /// the base. If the base is not bounded, the first call to `begin` walks
+        /// it to find its end, which is cached; copies keep the cache under the
+        /// same terms as those of `drop_view`.
         template<typename Rng>
         struct reverse_view
           : range_adaptor<reverse_view<Rng>, Rng>
+          , private detail::reverse_end_cache_t<Rng>
         {
         private:
             CONCEPT_ASSERT(BidirectionalIterable<Rng>());
-            CONCEPT_ASSERT(BoundedIterable<Rng>());
             friend range_access;
+            using iterator_t = range_iterator_t<Rng>;
+            using end_cache_t = detail::reverse_end_cache_t<Rng>;
 
-            // A rather convoluted implementation to avoid the problem std::reverse_iterator
-            // has adapting iterators that return references to internal data.
             struct adaptor : adaptor_base
             {
-            private:
-                reverse_view const *rng_;
-            public:
-                adaptor() = default;
-                adaptor(reverse_view const &rng)
-                  : rng_(&rng)
-                {}
-                range_iterator_t<Rng> begin(reverse_view const &rng) const
+                using value_type = range_value_t<Rng>;
+                iterator_t begin(reverse_view const &rng) const
+                {
+                    return rng.get_end_(std::true_type{});
+                }
+                iterator_t begin(reverse_view &rng) const
+                {
+                    return rng.get_end_(BoundedIterable<Rng>{});
+                }
+                iterator_t end(reverse_view const &rng) const
                 {
-                    auto it = ranges::end(rng.mutable_base());
-                    ranges::advance_bounded(it, -1, ranges::begin(rng.mutable_base()));
-                    return it;
+                    return ranges::begin(rng.mutable_base());
                 }
-                void next(range_iterator_t<Rng> &it) const
+                static range_reference_t<Rng> current(iterator_t const &it)
                 {
-                    if(0 != ranges::advance_bounded(it, -1, ranges::begin(rng_->mutable_base())))
-                        it = ranges::end(rng_->mutable_base());
+                    return *ranges::prev(it);
                 }
-                void prev(range_iterator_t<Rng> &it) const
+                static range_rvalue_reference_t<Rng> indirect_move(iterator_t const &it)
                 {
-                    if(0 != ranges::advance_bounded(it, 1, ranges::end(rng_->mutable_base())))
-                        it = ranges::begin(rng_->mutable_base());
+                    return iter_move(ranges::prev(it));
+                }
+                static void next(iterator_t &it)
+                {
+                    --it;
+                }
+                static void prev(iterator_t &it)
+                {
+                    ++it;
                 }
                 CONCEPT_REQUIRES(RandomAccessIterable<Rng>())
-                void advance(range_iterator_t<Rng> &it, range_difference_t<Rng> n) const
+                static void advance(iterator_t &it, range_difference_t<Rng> n)
                 {
-                    if(n > 0)
-                        ranges::advance(it, -n + 1), this->next(it);
-                    else if(n < 0)
-                        this->prev(it), ranges::advance(it, -n - 1);
+                    it -= n;
                 }
                 CONCEPT_REQUIRES(RandomAccessIterable<Rng>())
-                range_difference_t<Rng>
-                distance_to(range_iterator_t<Rng> const &here, range_iterator_t<Rng> const &there,
-                    adaptor const &other_adapt) const
+                static range_difference_t<Rng>
+                distance_to(iterator_t const &here, iterator_t const &there)
                 {
-                    RANGES_ASSERT(rng_ == other_adapt.rng_);
-                    if(there == ranges::end(rng_->mutable_base()))
-                        return here == ranges::end(rng_->mutable_base())
-                            ? 0 : (here - ranges::begin(rng_->mutable_base())) + 1;
-                    else if(here == ranges::end(rng_->mutable_base()))
-                        return (ranges::begin(rng_->mutable_base()) - there) - 1;
                     return here - there;
                 }
             };
+            end_cache_t const &end_cache_() const
+            {
+                return *this;
+            }
+            iterator_t get_end_(std::true_type) const
+            {
+                return ranges::end(this->mutable_base());
+            }
+            iterator_t get_end_(std::false_type)
+            {
+                auto &end_ = ranges::get<end_tag>(*this);
+                if(!end_)
+                    end_ = ranges::next_to(ranges::begin(this->mutable_base()),
+                        ranges::end(this->mutable_base()));
+                return *end_;
+            }
+            // Finding the end of a base that is not bounded fills the cache, so
+            // such a view can only be iterated when it is not const.
+            CONCEPT_REQUIRES(BoundedIterable<Rng>())
             adaptor begin_adaptor() const
             {
-                return {*this};
+                return {};
+            }
+            CONCEPT_REQUIRES(!BoundedIterable<Rng>())
+            adaptor begin_adaptor()
+            {
+                return {};
             }
             adaptor end_adaptor() const
             {
-                return {*this};
+                return {};
             }
         public:
             reverse_view() = default;
+            reverse_view(reverse_view &&that)
+              : range_adaptor_t<reverse_view>(std::move(that))
+              , end_cache_t(detail::copy_begin_cache<Rng>(that.end_cache_()))
+            {}
+            reverse_view(reverse_view const &that)
+              : range_adaptor_t<reverse_view>(that)
+              , end_cache_t(detail::copy_begin_cache<Rng>(that.end_cache_()))
+            {}
             reverse_view(Rng rng)
               : range_adaptor_t<reverse_view>{std::move(rng)}
             {}
+            reverse_view& operator=(reverse_view &&that)
+            {
+                static_cast<end_cache_t &>(*this) =
+                    detail::copy_begin_cache<Rng>(that.end_cache_());
+                static_cast<range_adaptor_t<reverse_view> &>(*this) = std::move(that);
+                return *this;
+            }
+            reverse_view& operator=(reverse_view const &that)
+            {
+                static_cast<end_cache_t &>(*this) =
+                    detail::copy_begin_cache<Rng>(that.end_cache_());
+                static_cast<range_adaptor_t<reverse_view> &>(*this) = that;
+                return *this;
+            }
             CONCEPT_REQUIRES(SizedIterable<Rng>())
             range_size_t<Rng> size() const
             {
@@ -113,9 +179,7 @@ namespace ranges
             struct reverse_fn
             {
                 template<typename Rng>
-                using Concept = meta::and_<
-                    BidirectionalIterable<Rng>,
-                    BoundedIterable<Rng>>;
+                using Concept = BidirectionalIterable<Rng>;
 
                 template<typename Rng, CONCEPT_REQUIRES_(Concept<Rng>())>
                 reverse_view<all_t<Rng>> operator()(Rng && rng) const
@@ -130,9 +194,6 @@ namespace ranges
                     CONCEPT_ASSERT_MSG(BidirectionalIterable<Rng>(),
                         "The object on which view::reverse operates must be a model of the "
                         "BidirectionalIterable concept.");
-                    CONCEPT_ASSERT_MSG(BoundedIterable<Rng>(),
-                        "To reverse an iterable object, its end iterator must be a model of "
-                        "the BidirectionalIterator concept.");
                 }
             #endif
             };
@@ -0,0 +1,286 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SLIDING_HPP
+#define RANGES_V3_VIEW_SLIDING_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The windows of `n` consecutive elements of a range, as sized
+        /// subranges: the first window starts at the first element, and each
+        /// next one starts one element later, up to the one that ends at the
+        /// last element. A range of fewer than `n` elements has no windows.
+        /// Moving to the next window is O(1) whatever `n` is; nothing is read
+        /// from the base until the windows are.
+        template<typename Rng>
+        struct sliding_view
+          : range_facade<sliding_view<Rng>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            using size_type_ = range_size_t<Rng>;
+            // Random-access, sized bases get a random-access range of windows,
+            // kept as the offset of the window from the start of the base.
+            using random_access_t =
+                meta::and_<RandomAccessIterable<Rng>, SizedIterable<Rng>>;
+            Rng rng_;
+            difference_type_ n_;
+
+            // Keeps both ends of the window, so that moving it moves each by one.
+            template<bool IsConst>
+            struct forward_cursor
+            {
+            private:
+                friend range_access;
+                friend sliding_view;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t first_;
+                // The last element of the window, or the end of the base if the
+                // window does not fit.
+                iterator_t last_;
+                range_sentinel_t<base_t> end_;
+                difference_type_ n_;
+
+                sized_range<iterator_t> current() const
+                {
+                    return {first_, ranges::next(last_), static_cast<size_type_>(n_)};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(last_ != end_);
+                    ++first_;
+                    ++last_;
+                }
+                CONCEPT_REQUIRES(BidirectionalIterable<base_t>())
+                void prev()
+                {
+                    --first_;
+                    --last_;
+                }
+                bool done() const
+                {
+                    return last_ == end_;
+                }
+                bool equal(forward_cursor const &that) const
+                {
+                    return first_ == that.first_;
+                }
+                forward_cursor(begin_tag, base_t &rng, difference_type_ n)
+                  : first_(ranges::begin(rng)), last_(first_), end_(ranges::end(rng)), n_(n)
+                {
+                    advance_bounded(last_, n_ - 1, end_);
+                }
+            public:
+                forward_cursor() = default;
+            };
+
+            template<bool IsConst>
+            struct random_access_cursor
+            {
+            private:
+                friend range_access;
+                friend sliding_view;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                iterator_t first_;
+                difference_type_ pos_;
+                difference_type_ count_;
+                difference_type_ n_;
+
+                range<iterator_t> current() const
+                {
+                    RANGES_ASSERT(pos_ < count_);
+                    return {first_ + pos_, first_ + (pos_ + n_)};
+                }
+                void next()
+                {
+                    RANGES_ASSERT(pos_ < count_);
+                    ++pos_;
+                }
+                void prev()
+                {
+                    RANGES_ASSERT(pos_ > 0);
+                    --pos_;
+                }
+                void advance(difference_type_ n)
+                {
+                    RANGES_ASSERT(0 <= pos_ + n && pos_ + n <= count_);
+                    pos_ += n;
+                }
+                difference_type_ distance_to(random_access_cursor const &that) const
+                {
+                    return that.pos_ - pos_;
+                }
+                bool done() const
+                {
+                    return pos_ == count_;
+                }
+                bool equal(random_access_cursor const &that) const
+                {
+                    return pos_ == that.pos_;
+                }
+                random_access_cursor(begin_tag, base_t &rng, difference_type_ n)
+                  : first_(ranges::begin(rng)), pos_(0)
+                  , count_(sliding_view::count_(
+                        static_cast<difference_type_>(ranges::size(rng)), n))
+                  , n_(n)
+                {}
+                random_access_cursor(end_tag, base_t &rng, difference_type_ n)
+                  : random_access_cursor{begin_tag{}, rng, n}
+                {
+                    pos_ = count_;
+                }
+            public:
+                random_access_cursor() = default;
+            };
+
+            template<bool IsConst>
+            using cursor =
+                meta::if_<random_access_t, random_access_cursor<IsConst>, forward_cursor<IsConst>>;
+            template<bool IsConst>
+            using sentinel = meta::if_<random_access_t, cursor<IsConst>, default_sentinel>;
+
+            static difference_type_ count_(difference_type_ size, difference_type_ n)
+            {
+                return size < n ? 0 : size - n + 1;
+            }
+            template<bool IsConst, typename BaseRng>
+            static sentinel<IsConst> end_cursor_(BaseRng &rng, difference_type_ n, std::true_type)
+            {
+                return {end_tag{}, rng, n};
+            }
+            template<bool IsConst, typename BaseRng>
+            static sentinel<IsConst> end_cursor_(BaseRng &, difference_type_, std::false_type)
+            {
+                return {};
+            }
+
+            cursor<false> begin_cursor()
+            {
+                return {begin_tag{}, rng_, n_};
+            }
+            sentinel<false> end_cursor()
+            {
+                return sliding_view::end_cursor_<false>(rng_, n_, random_access_t{});
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            cursor<true> begin_cursor() const
+            {
+                return {begin_tag{}, rng_, n_};
+            }
+            CONCEPT_REQUIRES(ForwardIterable<Rng const>())
+            sentinel<true> end_cursor() const
+            {
+                return sliding_view::end_cursor_<true>(rng_, n_, random_access_t{});
+            }
+        public:
+            sliding_view() = default;
+            sliding_view(Rng rng, difference_type_ n)
+              : rng_(std::move(rng)), n_(n)
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            size_type_ size() const
+            {
+                return static_cast<size_type_>(sliding_view::count_(
+                    static_cast<difference_type_>(ranges::size(rng_)), n_));
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct sliding_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_fn sliding, Int n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n))
+                )
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Int, CONCEPT_REQUIRES_(!Integral<Int>())>
+                static detail::null_pipe bind(sliding_fn, Int)
+                {
+                    CONCEPT_ASSERT_MSG(Integral<Int>(),
+                        "The object passed to view::sliding must be a model of the Integral "
+                        "concept.");
+                    return {};
+                }
+            #endif
+            public:
+                template<typename Rng, CONCEPT_REQUIRES_(ForwardIterable<Rng>())>
+                sliding_view<all_t<Rng>> operator()(Rng && rng, range_difference_t<Rng> n) const
+                {
+                    return {all(std::forward<Rng>(rng)), n};
+                }
+
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, CONCEPT_REQUIRES_(!ForwardIterable<Rng>())>
+                void operator()(Rng &&, T) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::sliding operates must be a model of the "
+                        "ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(Integral<T>(),
+                        "The second argument to view::sliding must be a model of the Integral "
+                        "concept.");
+                }
+            #endif
+            };
+
+            /// \relates sliding_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& sliding = static_const<view<sliding_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
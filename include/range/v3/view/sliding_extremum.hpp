@@ -0,0 +1,247 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SLIDING_EXTREMUM_HPP
+#define RANGES_V3_VIEW_SLIDING_EXTREMUM_HPP
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/iterator_concepts.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The least (or, if `Max`, the greatest) element of each window of `n`
+        /// consecutive elements of a range, as `view::sliding` would give them;
+        /// of equivalent elements, the first. The candidates of the current
+        /// window, those not followed by a lesser element, are kept in order
+        /// in a ring buffer: each element enters it once and leaves it at most
+        /// once, so each step is O(1) amortized. The buffer is kept in the view,
+        /// so the view is single-pass; iterating it again starts over.
+        template<typename Rng, typename C, typename P, bool Max>
+        struct sliding_extremum_view
+          : range_facade<sliding_extremum_view<Rng, C, P, Max>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using iterator_t = range_iterator_t<Rng>;
+            using difference_type_ = range_difference_t<Rng>;
+            using entry_t = std::pair<iterator_t, difference_type_>;
+            Rng rng_;
+            difference_type_ n_;
+            semiregular_t<invokable_t<C>> pred_;
+            semiregular_t<invokable_t<P>> proj_;
+            // The candidates, oldest first, with their indices. The size of the
+            // buffer is zero or a power of two.
+            std::vector<entry_t> ring_;
+            std::size_t head_ = 0;
+            std::size_t size_ = 0;
+            // The next element to enter a window, and its index.
+            iterator_t in_;
+            difference_type_ idx_ = 0;
+            bool done_ = true;
+
+            entry_t &at_(std::size_t i)
+            {
+                return ring_[(head_ + i) & (ring_.size() - 1)];
+            }
+            // Whether a, which entered before b, can no longer be the extremum
+            // of a window once b is in it.
+            bool dominated_(iterator_t const &a, iterator_t const &b)
+            {
+                return Max ? pred_(proj_(*a), proj_(*b)) : pred_(proj_(*b), proj_(*a));
+            }
+            void grow_()
+            {
+                std::vector<entry_t> ring(ring_.empty() ? 8 : 2 * ring_.size());
+                for(std::size_t i = 0; i != size_; ++i)
+                    ring[i] = this->at_(i);
+                ring_.swap(ring);
+                head_ = 0;
+            }
+            // Slides the window over the next element. The window then ends at
+            // index idx_ - 1, and at most one candidate can have left it.
+            void push_()
+            {
+                while(size_ != 0 && this->dominated_(this->at_(size_ - 1).first, in_))
+                    --size_;
+                if(size_ == ring_.size())
+                    this->grow_();
+                this->at_(size_) = entry_t{in_, idx_};
+                ++size_;
+                ++in_;
+                ++idx_;
+                if(this->at_(0).second < idx_ - n_)
+                {
+                    head_ = (head_ + 1) & (ring_.size() - 1);
+                    --size_;
+                }
+            }
+
+            struct cursor
+            {
+            private:
+                sliding_extremum_view *rng_;
+            public:
+                using single_pass = std::true_type;
+                cursor() = default;
+                explicit cursor(sliding_extremum_view &rng)
+                  : rng_(&rng)
+                {}
+                range_reference_t<Rng> current() const
+                {
+                    return *rng_->at_(0).first;
+                }
+                void next()
+                {
+                    if(rng_->in_ == ranges::end(rng_->rng_))
+                        rng_->done_ = true;
+                    else
+                        rng_->push_();
+                }
+                bool done() const
+                {
+                    return rng_->done_;
+                }
+            };
+            cursor begin_cursor()
+            {
+                head_ = size_ = 0;
+                in_ = ranges::begin(rng_);
+                idx_ = 0;
+                auto const end = ranges::end(rng_);
+                while(idx_ != n_ && in_ != end)
+                    this->push_();
+                done_ = idx_ != n_;
+                return cursor{*this};
+            }
+        public:
+            sliding_extremum_view() = default;
+            sliding_extremum_view(Rng rng, difference_type_ n, C pred, P proj)
+              : rng_(std::move(rng)), n_(n)
+              , pred_(invokable(std::move(pred))), proj_(invokable(std::move(proj)))
+              , in_{}
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        template<typename Rng, typename C, typename P>
+        using sliding_min_view = sliding_extremum_view<Rng, C, P, false>;
+
+        template<typename Rng, typename C, typename P>
+        using sliding_max_view = sliding_extremum_view<Rng, C, P, true>;
+
+        namespace view
+        {
+            template<bool Max>
+            struct sliding_extremum_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_extremum_fn sliding, Int n)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n))
+                )
+                template<typename Int, typename C, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_extremum_fn sliding, Int n, C pred)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n,
+                        protect(std::move(pred))))
+                )
+                template<typename Int, typename C, typename P, CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_extremum_fn sliding, Int n, C pred, P proj)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding, std::placeholders::_1, n,
+                        protect(std::move(pred)), protect(std::move(proj))))
+                )
+            public:
+                template<typename Rng, typename C, typename P,
+                    typename I = range_iterator_t<Rng>>
+                using Concept = meta::and_<
+                    ForwardIterable<Rng>,
+                    IndirectInvokableRelation<C, Project<I, P>, Project<I, P>>>;
+
+                /// \param n The width of the windows.
+                /// \param pred The order of the elements.
+                /// \param proj Projects the elements before comparing them.
+                template<typename Rng, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(Concept<Rng, C, P>())>
+                sliding_extremum_view<all_t<Rng>, C, P, Max>
+                operator()(Rng && rng, range_difference_t<Rng> n, C pred = C{},
+                    P proj = P{}) const
+                {
+                    return {all(std::forward<Rng>(rng)), n, std::move(pred), std::move(proj)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename C = ordered_less, typename P = ident,
+                    CONCEPT_REQUIRES_(!Concept<Rng, C, P>())>
+                void operator()(Rng &&, T, C = C{}, P = P{}) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::sliding_min and view::sliding_max operate "
+                        "must be a model of the ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(IndirectInvokableRelation<C,
+                        Project<range_iterator_t<Rng>, P>, Project<range_iterator_t<Rng>, P>>(),
+                        "The predicate passed to view::sliding_min or view::sliding_max must "
+                        "be a relation on the projected elements of the range.");
+                }
+            #endif
+            };
+
+            using sliding_min_fn = sliding_extremum_fn<false>;
+            using sliding_max_fn = sliding_extremum_fn<true>;
+
+            /// \relates sliding_extremum_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& sliding_min = static_const<view<sliding_min_fn>>::value;
+                constexpr auto&& sliding_max = static_const<view<sliding_max_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
@@ -0,0 +1,233 @@
+/// \file
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+#ifndef RANGES_V3_VIEW_SLIDING_FOLD_HPP
+#define RANGES_V3_VIEW_SLIDING_FOLD_HPP
+
+#include <utility>
+#include <functional>
+#include <type_traits>
+#include <range/v3/range_fwd.hpp>
+#include <range/v3/size.hpp>
+#include <range/v3/begin_end.hpp>
+#include <range/v3/range_traits.hpp>
+#include <range/v3/range_concepts.hpp>
+#include <range/v3/range_facade.hpp>
+#include <range/v3/utility/meta.hpp>
+#include <range/v3/utility/functional.hpp>
+#include <range/v3/utility/semiregular.hpp>
+#include <range/v3/utility/static_const.hpp>
+#include <range/v3/view/all.hpp>
+#include <range/v3/view/view.hpp>
+
+namespace ranges
+{
+    inline namespace v3
+    {
+        /// \addtogroup group-views
+        /// @{
+
+        /// The fold with `op` of each window of `n` consecutive elements of a
+        /// range, as `view::sliding` would give them. Only the first window is
+        /// folded whole; each next fold is made from the one before by taking
+        /// the element that leaves the window out with `inverse_op` and folding
+        /// in the one that enters with `op`, in O(1) however wide the window.
+        /// The element taken out is the oldest of the window, not the last one
+        /// folded in, so `op` must be associative and commutative, and
+        /// `inverse_op(op(x, y), y)` must be equivalent to `x`. For floating
+        /// point sums, the rounding errors of the steps accumulate.
+        template<typename Rng, typename Op, typename Inv>
+        struct sliding_fold_view
+          : range_facade<sliding_fold_view<Rng, Op, Inv>, is_infinite<Rng>::value>
+        {
+        private:
+            friend range_access;
+            using difference_type_ = range_difference_t<Rng>;
+            using size_type_ = range_size_t<Rng>;
+            Rng rng_;
+            difference_type_ n_;
+            semiregular_t<invokable_t<Op>> op_;
+            semiregular_t<invokable_t<Inv>> inv_;
+
+            template<bool IsConst>
+            struct cursor
+            {
+            private:
+                friend range_access;
+                friend sliding_fold_view;
+                using view_t = meta::apply<meta::add_const_if_c<IsConst>, sliding_fold_view>;
+                using base_t = meta::apply<meta::add_const_if_c<IsConst>, Rng>;
+                using iterator_t = range_iterator_t<base_t>;
+                using value_t = range_value_t<Rng>;
+                using R = range_common_reference_t<base_t>;
+                view_t *rng_;
+                iterator_t first_;
+                // The last element of the window, or the end of the base if the
+                // window does not fit.
+                iterator_t last_;
+                range_sentinel_t<base_t> end_;
+                semiregular_t<value_t> sum_;
+
+                value_t current() const
+                {
+                    return sum_;
+                }
+                void next()
+                {
+                    RANGES_ASSERT(last_ != end_);
+                    if(++last_ != end_)
+                    {
+                        // *first_ was folded in first, not last, which is why op
+                        // must be commutative.
+                        value_t &sum = sum_;
+                        value_t rest = rng_->inv_(R(sum), R(*first_));
+                        sum_ = rng_->op_(R(rest), R(*last_));
+                    }
+                    ++first_;
+                }
+                bool done() const
+                {
+                    return last_ == end_;
+                }
+                bool equal(cursor const &that) const
+                {
+                    return first_ == that.first_;
+                }
+                cursor(view_t &rng)
+                  : rng_(&rng), first_(ranges::begin(rng.rng_)), last_(first_)
+                  , end_(ranges::end(rng.rng_)), sum_()
+                {
+                    if(first_ == end_)
+                        return;
+                    sum_ = *first_;
+                    for(difference_type_ i = 1; i != rng.n_; ++i)
+                    {
+                        if(++last_ == end_)
+                            return;
+                        value_t &sum = sum_;
+                        sum_ = rng.op_(R(sum), R(*last_));
+                    }
+                }
+            public:
+                cursor() = default;
+            };
+
+            cursor<false> begin_cursor()
+            {
+                return {*this};
+            }
+            template<typename BaseRng = Rng const,
+                typename R = range_common_reference_t<BaseRng>,
+                CONCEPT_REQUIRES_(ForwardIterable<BaseRng>() && Invokable<Op const, R, R>() &&
+                    Invokable<Inv const, R, R>())>
+            cursor<true> begin_cursor() const
+            {
+                return {*this};
+            }
+        public:
+            sliding_fold_view() = default;
+            sliding_fold_view(Rng rng, difference_type_ n, Op op, Inv inv)
+              : rng_(std::move(rng)), n_(n)
+              , op_(invokable(std::move(op))), inv_(invokable(std::move(inv)))
+            {
+                RANGES_ASSERT(0 < n_);
+            }
+            CONCEPT_REQUIRES(SizedIterable<Rng>())
+            size_type_ size() const
+            {
+                auto const size = ranges::size(rng_);
+                auto const n = static_cast<size_type_>(n_);
+                return size < n ? 0 : size - n + 1;
+            }
+            Rng & base()
+            {
+                return rng_;
+            }
+            Rng const & base() const
+            {
+                return rng_;
+            }
+        };
+
+        namespace view
+        {
+            struct sliding_fold_fn
+            {
+            private:
+                friend view_access;
+                template<typename Int, typename Op, typename Inv,
+                    CONCEPT_REQUIRES_(Integral<Int>())>
+                static auto bind(sliding_fold_fn sliding_fold, Int n, Op op, Inv inv)
+                RANGES_DECLTYPE_AUTO_RETURN
+                (
+                    make_pipeable(std::bind(sliding_fold, std::placeholders::_1, n,
+                        protect(std::move(op)), protect(std::move(inv))))
+                )
+                template<typename Rng, typename Fun>
+                using FoldFunction = meta::and_<
+                    IndirectInvokable<Fun, range_iterator_t<Rng>, range_iterator_t<Rng>>,
+                    Convertible<
+                        concepts::Invokable::result_t<Fun, range_common_reference_t<Rng>,
+                            range_common_reference_t<Rng>>,
+                        range_value_t<Rng>>>;
+            public:
+                template<typename Rng, typename Op, typename Inv>
+                using Concept = meta::and_<
+                    ForwardIterable<Rng>,
+                    FoldFunction<Rng, Op>,
+                    FoldFunction<Rng, Inv>>;
+
+                /// \param n The width of the windows.
+                /// \param op Folds an element into the fold of a window. It must be
+                /// associative and commutative.
+                /// \param inverse_op Takes the oldest element of a window back out
+                /// of its fold: `inverse_op(op(x, y), y)` must be equivalent to `x`.
+                template<typename Rng, typename Op, typename Inv,
+                    CONCEPT_REQUIRES_(Concept<Rng, Op, Inv>())>
+                sliding_fold_view<all_t<Rng>, Op, Inv>
+                operator()(Rng && rng, range_difference_t<Rng> n, Op op, Inv inverse_op) const
+                {
+                    return {all(std::forward<Rng>(rng)), n, std::move(op), std::move(inverse_op)};
+                }
+            #ifndef RANGES_DOXYGEN_INVOKED
+                template<typename Rng, typename T, typename Op, typename Inv,
+                    CONCEPT_REQUIRES_(!Concept<Rng, Op, Inv>())>
+                void operator()(Rng &&, T, Op, Inv) const
+                {
+                    CONCEPT_ASSERT_MSG(ForwardIterable<Rng>(),
+                        "The object on which view::sliding_fold operates must be a model of "
+                        "the ForwardIterable concept.");
+                    CONCEPT_ASSERT_MSG(FoldFunction<Rng, Op>(),
+                        "The operation passed to view::sliding_fold must be callable with two "
+                        "values from the range, and return a value convertible to its value "
+                        "type.");
+                    CONCEPT_ASSERT_MSG(FoldFunction<Rng, Inv>(),
+                        "The inverse operation passed to view::sliding_fold must be callable "
+                        "with two values from the range, and return a value convertible to its "
+                        "value type.");
+                }
+            #endif
+            };
+
+            /// \relates sliding_fold_fn
+            /// \ingroup group-views
+            namespace
+            {
+                constexpr auto&& sliding_fold = static_const<view<sliding_fold_fn>>::value;
+            }
+        }
+        /// @}
+    }
+}
+
+#endif
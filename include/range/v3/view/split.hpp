@@ -22,12 +22,15 @@
 #include <range/v3/range_traits.hpp>
 #include <range/v3/range_concepts.hpp>
 #include <range/v3/range_facade.hpp>
+#include <range/v3/utility/byte_search.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/semiregular.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/utility/unreachable.hpp>
 #include <range/v3/algorithm/adjacent_find.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/delimit.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/take_while.hpp>
@@ -36,6 +39,61 @@ namespace ranges
 {
     inline namespace v3
     {
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct split_element_pred
+            {
+                range_value_t<Rng> val_;
+                std::pair<bool, range_difference_t<Rng>>
+                operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
+                {
+                    using P = std::pair<bool, range_difference_t<Rng>>;
+                    RANGES_ASSERT(cur != end);
+                    return *cur == val_ ? P{true, 1} : P{false, 0};
+                }
+            };
+
+            // How split_view finds the next delimiter: by testing one position at
+            // a time, or, for a single-byte delimiter, with a byte search over
+            // either a bounded contiguous range or a null-terminated string.
+            struct split_search_each
+            {};
+            struct split_search_bytes
+            {};
+            struct split_search_c_str
+            {};
+
+            template<typename Rng, typename Fun>
+            struct split_search
+            {
+                using type = split_search_each;
+            };
+
+            template<typename Rng, typename R>
+            struct split_search<Rng, split_element_pred<R>>
+            {
+                using type =
+                    meta::if_c<
+                        is_contiguous_byte_iterator<range_iterator_t<Rng>>::value &&
+                            std::is_same<range_iterator_t<Rng>, range_sentinel_t<Rng>>::value,
+                        split_search_bytes,
+                        split_search_each>;
+            };
+
+            template<typename B, typename Val, typename R>
+            struct split_search<delimit_view<range<B *, unreachable>, Val>, split_element_pred<R>>
+            {
+                using type =
+                    meta::if_c<
+                        is_byte<typename std::remove_cv<B>::type>::value && is_byte<Val>::value,
+                        split_search_c_str,
+                        split_search_each>;
+            };
+        }
+        /// \endcond
+
         /// \addtogroup group-views
         /// @{
         template<typename Rng, typename Fun>
@@ -80,12 +138,8 @@ namespace ranges
                 {
                     return reference_{{view::iota(cur_), {zero_, cur_, last_, fun_}}};
                 }
-                void next()
+                void find_next(detail::split_search_each)
                 {
-                    RANGES_ASSERT(cur_ != last_);
-                    // If the last match consumed zero elements, bump the position.
-                    advance_bounded(cur_, (int)zero_, last_);
-                    zero_ = false;
                     for(; cur_ != last_; ++cur_)
                     {
                         std::pair<bool, range_difference_t<Rng>> p = fun_(cur_, last_);
@@ -97,6 +151,35 @@ namespace ranges
                         }
                     }
                 }
+                // A one-element delimiter never matches zero elements, so zero_
+                // stays false on these paths.
+                void find_next(detail::split_search_bytes)
+                {
+                    cur_ = detail::find_byte(cur_, last_, fun_.val_);
+                    if(cur_ != last_)
+                        ++cur_;
+                }
+                void find_next(detail::split_search_c_str)
+                {
+                    if(last_.adaptor().value() != 0)
+                        return this->find_next(detail::split_search_each{});
+                    if(cur_ == last_)
+                        return;
+                    // Find the delimiter or the terminator in one scan.
+                    auto const p = cur_.base();
+                    auto const q = detail::find_byte_or_nul(p, fun_.val_);
+                    cur_ += q - p;
+                    if(*q != 0)
+                        ++cur_;
+                }
+                void next()
+                {
+                    RANGES_ASSERT(cur_ != last_);
+                    // If the last match consumed zero elements, bump the position.
+                    advance_bounded(cur_, (int)zero_, last_);
+                    zero_ = false;
+                    this->find_next(meta::eval<detail::split_search<Rng, Fun>>{});
+                }
                 bool done() const
                 {
                     return cur_ == last_;
@@ -106,11 +189,14 @@ namespace ranges
                     return cur_ == that.cur_;
                 }
                 cursor(fun_ref_t fun, range_iterator_t<Rng> first, range_sentinel_t<Rng> last)
-                  : cur_(first), last_(last), fun_(fun)
+                  : zero_(false), cur_(first), last_(last), fun_(fun)
                 {
                     // For skipping an initial zero-length match
-                    auto p = fun(first, last);
-                    zero_ = p.first && 0 == p.second;
+                    if(first != last)
+                    {
+                        auto p = fun(first, last);
+                        zero_ = p.first && 0 == p.second;
+                    }
                 }
             public:
                 cursor() = default;
@@ -144,18 +230,11 @@ namespace ranges
                 (
                     make_pipeable(std::bind(split, std::placeholders::_1, bind_forward<T>(t)))
                 )
+            public:
+                // The delimiter protocol used for a single element and for a
+                // subrange. `action::split` reuses these.
                 template<typename Rng>
-                struct element_pred
-                {
-                    range_value_t<Rng> val_;
-                    std::pair<bool, range_difference_t<Rng>>
-                    operator()(range_iterator_t<Rng> cur, range_sentinel_t<Rng> end) const
-                    {
-                        using P = std::pair<bool, range_difference_t<Rng>>;
-                        RANGES_ASSERT(cur != end);
-                        return *cur == val_ ? P{true, 1} : P{false, 0};
-                    }
-                };
+                using element_pred = detail::split_element_pred<Rng>;
                 template<typename Rng, typename Sub>
                 struct subrange_pred
                 {
@@ -183,7 +262,6 @@ namespace ranges
                         }
                     }
                 };
-            public:
                 template<typename Rng, typename Fun>
                 using FunctionConcept = meta::and_<
                     ForwardIterable<Rng>,
@@ -14,7 +14,6 @@
 #ifndef RANGES_V3_VIEW_STRIDE_HPP
 #define RANGES_V3_VIEW_STRIDE_HPP
 
-#include <atomic>
 #include <utility>
 #include <type_traits>
 #include <range/v3/range_fwd.hpp>
@@ -37,6 +36,14 @@ namespace ranges
     {
         /// \addtogroup group-views
         /// @{
+
+        /// Every `stride`-th element of a range, starting with the first.
+        /// Iterators of bidirectional stride views remember how far short of
+        /// a whole stride the end of the base was when they reached it, so that
+        /// decrementing them lands on the right element. The end iterator gets
+        /// that offset from the size of the base when it has one. Otherwise it
+        /// finds it by walking the base on its first decrement, so that
+        /// iterating forwards never pays for it.
         template<typename Rng>
         struct stride_view
           : range_adaptor<stride_view<Rng>, Rng>
@@ -46,84 +53,74 @@ namespace ranges
             using size_type_ = range_size_t<Rng>;
             using difference_type_ = range_difference_t<Rng>;
 
-            // Bidirectional stride iterators need a runtime boolean to keep track
-            // of when the offset variable is dirty and needs to be lazily calculated.
-            // Ditto for random-access stride iterators when the end is a sentinel.
-            // If the size of the range is known a priori, then the runtime boolean
-            // is always unnecessary.
-            using dirty_t =
-                meta::if_c<
-                    (BidirectionalIterable<Rng>() && !SizedIterable<Rng>()),
-                    mutable_<std::atomic<bool>>,
-                    constant<bool, false>>;
-
-            // Bidirectional and random-access stride iterators need to remember how
-            // far past they end they are, so that when they're decremented, they can
-            // visit the correct elements.
+            // Only bidirectional stride iterators need to remember how far past
+            // the end they are.
             using offset_t =
                 meta::if_<
                     BidirectionalIterable<Rng>,
-                    mutable_<std::atomic<difference_type_>>,
+                    mutable_<difference_type_>,
                     constant<difference_type_, 0>>;
 
             difference_type_ stride_;
 
-            struct adaptor : adaptor_base, private dirty_t, private offset_t
+            difference_type_ end_offset_of_(difference_type_ dist) const
+            {
+                auto const tmp = dist % stride_;
+                return 0 != tmp ? stride_ - tmp : tmp;
+            }
+            difference_type_ end_offset_(std::true_type) const
+            {
+                return this->end_offset_of_(
+                    static_cast<difference_type_>(ranges::size(this->mutable_base())));
+            }
+            // The end iterator of a base that is not sized starts out with an
+            // unknown offset.
+            difference_type_ end_offset_(std::false_type) const
+            {
+                return -1;
+            }
+            difference_type_ walk_end_offset_() const
+            {
+                return this->end_offset_of_(ranges::distance(this->mutable_base()));
+            }
+
+            struct adaptor : adaptor_base, private offset_t
             {
             private:
                 using iterator = ranges::range_iterator_t<Rng>;
                 stride_view const *rng_;
-                dirty_t & dirty() { return *this; }
-                dirty_t const & dirty() const { return *this; }
                 offset_t & offset() { return *this; }
                 offset_t const & offset() const { return *this; }
-                void clean() const
+                // Advances by up to n elements, and records by how many the
+                // bound fell short.
+                template<typename S>
+                void advance_(iterator &it, difference_type_ n, S bound)
                 {
-                    // Harmless race here. Two threads might compute offset and set it
-                    // independently, but the result would be the same.
-                    if(dirty())
-                    {
-                        do_clean();
-                        dirty() = false;
-                    }
-                }
-                void do_clean() const
-                {
-                    auto tmp = ranges::distance(rng_->base()) % rng_->stride_;
-                    offset() = 0 != tmp ? rng_->stride_ - tmp : tmp;
+                    offset() = advance_bounded(it, n, std::move(bound));
                 }
             public:
                 adaptor() = default;
-                adaptor(stride_view const &rng, begin_tag)
-                  : dirty_t(false), offset_t(0), rng_(&rng)
+                adaptor(stride_view const &rng, difference_type_ offset)
+                  : offset_t(offset), rng_(&rng)
                 {}
-                adaptor(stride_view const &rng, end_tag)
-                  : dirty_t(true), offset_t(0), rng_(&rng)
-                {
-                    // Opportunistic eager cleaning when we can do so in O(1)
-                    if(BidirectionalIterable<Rng>() && SizedIterable<Rng>())
-                        do_clean();
-                }
                 void next(iterator &it)
                 {
                     RANGES_ASSERT(0 == offset());
                     RANGES_ASSERT(it != ranges::end(rng_->mutable_base()));
-                    offset() = advance_bounded(it, rng_->stride_ + offset(),
-                        ranges::end(rng_->mutable_base()));
+                    this->advance_(it, rng_->stride_, ranges::end(rng_->mutable_base()));
                 }
                 CONCEPT_REQUIRES(BidirectionalIterable<Rng>())
                 void prev(iterator &it)
                 {
-                    clean();
-                    offset() = advance_bounded(it, -rng_->stride_ + offset(),
+                    if(0 > offset())
+                        offset() = rng_->walk_end_offset_();
+                    this->advance_(it, -rng_->stride_ + offset(),
                         ranges::begin(rng_->mutable_base()));
                     RANGES_ASSERT(0 == offset());
                 }
                 CONCEPT_REQUIRES(RandomAccessIterable<Rng>())
                 difference_type_ distance_to(iterator here, iterator there, adaptor const &that) const
                 {
-                    clean();
-                    that.clean();
                     RANGES_ASSERT(rng_ == that.rng_);
                     RANGES_ASSERT(0 == ((there - here) + that.offset() - offset()) % rng_->stride_);
                     return ((there - here) + that.offset() - offset()) / rng_->stride_;
@@ -131,19 +128,17 @@ namespace ranges
                 CONCEPT_REQUIRES(RandomAccessIterable<Rng>())
                 void advance(iterator &it, difference_type_ n)
                 {
-                    if(n != 0)
-                        clean();
                     if(0 < n)
-                        offset() = advance_bounded(it, n * rng_->stride_ + offset(),
+                        this->advance_(it, n * rng_->stride_ + offset(),
                             ranges::end(rng_->mutable_base()));
                     else if(0 > n)
-                        offset() = advance_bounded(it, n * rng_->stride_ + offset(),
+                        this->advance_(it, n * rng_->stride_ + offset(),
                             ranges::begin(rng_->mutable_base()));
                 }
             };
             adaptor begin_adaptor() const
             {
-                return {*this, begin_tag{}};
+                return {*this, 0};
             }
             // If the underlying sequence object doesn't model BoundedIterable, then we can't
             // decrement the end and there's no reason to adapt the sentinel. Strictly
@@ -155,10 +150,15 @@ namespace ranges
             {
                 return {};
             }
-            CONCEPT_REQUIRES(BoundedIterable<Rng>())
+            CONCEPT_REQUIRES(BoundedIterable<Rng>() && !BidirectionalIterable<Rng>())
+            adaptor end_adaptor() const
+            {
+                return {*this, 0};
+            }
+            CONCEPT_REQUIRES(BoundedIterable<Rng>() && BidirectionalIterable<Rng>())
             adaptor end_adaptor() const
             {
-                return {*this, end_tag{}};
+                return {*this, this->end_offset_(SizedIterable<Rng>())};
             }
         public:
             stride_view() = default;
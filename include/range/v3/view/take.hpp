@@ -90,40 +90,40 @@ namespace ranges
                 difference_type_ n_;
             public:
                 take_view_() = default;
-                take_view_(Rng rng, difference_type_ n)
+                RANGES_CXX14_CONSTEXPR take_view_(Rng rng, difference_type_ n)
                   : rng_(std::move(rng)), n_(n)
                 {
                     RANGES_ASSERT(n >= 0);
                 }
-                range_iterator_t<Rng> begin()
+                RANGES_CXX14_CONSTEXPR range_iterator_t<Rng> begin()
                 {
                     return ranges::begin(rng_);
                 }
-                range_iterator_t<Rng> end()
+                RANGES_CXX14_CONSTEXPR range_iterator_t<Rng> end()
                 {
                     return next(ranges::begin(rng_), n_);
                 }
                 template<typename BaseRng = Rng,
                     CONCEPT_REQUIRES_(Iterable<BaseRng const>())>
-                range_iterator_t<BaseRng const> begin() const
+                constexpr range_iterator_t<BaseRng const> begin() const
                 {
                     return ranges::begin(rng_);
                 }
                 template<typename BaseRng = Rng,
                     CONCEPT_REQUIRES_(Iterable<BaseRng const>())>
-                range_iterator_t<BaseRng const> end() const
+                constexpr range_iterator_t<BaseRng const> end() const
                 {
                     return next(ranges::begin(rng_), n_);
                 }
-                range_size_t<Rng> size() const
+                constexpr range_size_t<Rng> size() const
                 {
                     return static_cast<range_size_t<Rng>>(n_);
                 }
-                Rng & base()
+                RANGES_CXX14_CONSTEXPR Rng & base()
                 {
                     return rng_;
                 }
-                Rng const & base() const
+                constexpr Rng const & base() const
                 {
                     return rng_;
                 }
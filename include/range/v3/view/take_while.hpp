@@ -44,17 +44,18 @@ namespace ranges
             template<bool IsConst>
             struct sentinel_adaptor
               : adaptor_base
+              , private detail::adaptor_fun<semiregular_ref_or_val_t<invokable_t<Pred>, IsConst>>
             {
             private:
-                semiregular_ref_or_val_t<invokable_t<Pred>, IsConst> pred_;
+                using pred_ref_ = semiregular_ref_or_val_t<invokable_t<Pred>, IsConst>;
             public:
                 sentinel_adaptor() = default;
-                sentinel_adaptor(semiregular_ref_or_val_t<invokable_t<Pred>, IsConst> pred)
-                  : pred_(std::move(pred))
+                sentinel_adaptor(pred_ref_ pred)
+                  : detail::adaptor_fun<pred_ref_>(std::move(pred))
                 {}
                 bool empty(range_iterator_t<Rng> it, range_sentinel_t<Rng> end) const
                 {
-                    return it == end || !pred_(*it);
+                    return it == end || !this->fun()(*it);
                 }
             };
 
@@ -29,6 +29,7 @@
 #include <range/v3/utility/optional.hpp>
 #include <range/v3/utility/functional.hpp>
 #include <range/v3/utility/static_const.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
 #include <range/v3/view/view.hpp>
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/zip_with.hpp>
@@ -50,27 +51,30 @@ namespace ranges
                 meta::or_<meta::not_<BoundedIterable<Rng>>, SinglePass<range_iterator_t<Rng>>>;
 
             template<bool IsConst>
-            struct adaptor : adaptor_base
+            struct adaptor
+              : adaptor_base
+              , private detail::adaptor_fun<semiregular_ref_or_val_t<invokable_t<Fun>, IsConst>>
             {
             private:
                 using fun_ref_ = semiregular_ref_or_val_t<invokable_t<Fun>, IsConst>;
-                fun_ref_ fun_;
+                using detail::adaptor_fun<fun_ref_>::fun;
             public:
                 using value_type =
-                    detail::decay_t<decltype(fun_(copy_tag{}, range_iterator_t<Rng>{}))>;
+                    detail::decay_t<decltype(std::declval<fun_ref_ const &>()(copy_tag{},
+                        range_iterator_t<Rng>{}))>;
                 adaptor() = default;
                 adaptor(fun_ref_ fun)
-                  : fun_(std::move(fun))
+                  : detail::adaptor_fun<fun_ref_>(std::move(fun))
                 {}
                 auto current(range_iterator_t<Rng> it) const
                 RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
                 (
-                    fun_(it)
+                    this->fun()(it)
                 )
                 auto indirect_move(range_iterator_t<Rng> it) const
                 RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
                 (
-                    fun_(move_tag{}, it)
+                    this->fun()(move_tag{}, it)
                 )
             };
 
@@ -103,8 +107,36 @@ namespace ranges
             {
                 return ranges::size(this->base());
             }
+            /// The function applied to each iterator.
+            invokable_t<Fun> const & fun() const
+            {
+                return fun_;
+            }
+        protected:
+            invokable_t<Fun> & mutable_fun_()
+            {
+                return fun_;
+            }
         };
 
+        /// \cond
+        namespace detail
+        {
+            // Passes the transform of each element of the base on to fun.
+            template<typename Fn, typename F>
+            struct transform_sink
+            {
+                Fn &fn;
+                F &fun;
+                template<typename T>
+                bool operator()(T &&t) const
+                {
+                    return fun(fn(static_cast<T &&>(t)));
+                }
+            };
+        }
+        /// \endcond
+
         template<typename Rng, typename Fun>
         struct transform_view
           : iter_transform_view<Rng, detail::indirect_fn_<Fun>>
@@ -114,8 +146,37 @@ namespace ranges
               : iter_transform_view<Rng, detail::indirect_fn_<Fun>>{std::move(rng),
                     {std::move(fun)}}
             {}
+            /// The function applied to each element.
+            invokable_t<Fun> const & fun() const
+            {
+                return this->iter_transform_view<Rng, detail::indirect_fn_<Fun>>::fun().fn();
+            }
+        private:
+            friend range_access;
+            template<typename F, typename D = transform_view,
+                CONCEPT_REQUIRES_(Same<D, transform_view>())>
+            range_iterator_t<D> for_each_while(F &fun)
+            {
+                detail::transform_sink<invokable_t<Fun>, F> sink{this->mutable_fun_().fn(), fun};
+                return this->iterator_at_(ranges::for_each_while(this->base(), sink));
+            }
         };
 
+        /// \cond
+        namespace detail
+        {
+            template<typename Rng>
+            struct is_transform_view
+              : std::false_type
+            {};
+
+            template<typename Rng, typename Fun>
+            struct is_transform_view<transform_view<Rng, Fun>>
+              : std::true_type
+            {};
+        }
+        /// \endcond
+
         namespace view
         {
             struct iter_transform_fn
@@ -193,11 +254,22 @@ namespace ranges
                     Invokable<Fun, range_reference_t<Rng> &&>>;
 
                 template<typename Rng, typename Fun,
-                    CONCEPT_REQUIRES_(Concept<Rng, Fun>())>
+                    CONCEPT_REQUIRES_(Concept<Rng, Fun>() &&
+                        !detail::is_transform_view<detail::decay_t<Rng>>())>
                 transform_view<all_t<Rng>, Fun> operator()(Rng && rng, Fun fun) const
                 {
                     return {all(std::forward<Rng>(rng)), std::move(fun)};
                 }
+                /// A transform of a `transform_view` is a `transform_view` of its
+                /// base with the two functions composed, so that stacked
+                /// transforms make one flat iterator rather than nested ones.
+                template<typename Rng, typename Fun, typename Fun0,
+                    CONCEPT_REQUIRES_(Concept<transform_view<Rng, Fun0>, Fun>())>
+                transform_view<Rng, composed<invokable_t<Fun>, invokable_t<Fun0>>>
+                operator()(transform_view<Rng, Fun0> rng, Fun fun) const
+                {
+                    return {std::move(rng.base()), compose(invokable(std::move(fun)), rng.fun())};
+                }
             #ifndef RANGES_DOXYGEN_INVOKED
                 template<typename Rng, typename Fun,
                     CONCEPT_REQUIRES_(!Concept<Rng, Fun>())>
@@ -120,6 +120,14 @@ namespace ranges
                 indirect_fn_(Fn fn)
                   : BaseFn(invokable(std::move(fn)))
                 {}
+                BaseFn & fn()
+                {
+                    return *this;
+                }
+                BaseFn const & fn() const
+                {
+                    return *this;
+                }
                 // value_type (needs no impl)
                 template<typename ...Its>
                 auto operator()(copy_tag, Its ...) const ->
@@ -274,25 +282,111 @@ namespace ranges
                 }
             };
 
+            // When all the ranges are sized and random-access, a position is
+            // the begin iterators and one index into all of them. Moving and
+            // comparing positions touches only the index, and the end is the
+            // least of the sizes, found once, so a loop over the zip is a loop
+            // over an index that the compiler can vectorize.
+            struct indexed_cursor
+            {
+            private:
+                using fun_ref_ = semiregular_ref_or_val_t<invokable_t<Fun>, true>;
+                fun_ref_ fun_;
+                std::tuple<range_iterator_t<Rngs>...> its_;
+                difference_type_ n_;
+
+                template<std::size_t...Is>
+                auto current_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_((std::get<Is>(its_) + static_cast<range_difference_t<Rngs>>(n_))...)
+                )
+                template<std::size_t...Is>
+                auto indirect_move_(index_sequence<Is...>) const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    fun_(move_tag{},
+                        (std::get<Is>(its_) + static_cast<range_difference_t<Rngs>>(n_))...)
+                )
+                template<typename Sent>
+                friend auto indirect_move(basic_iterator<indexed_cursor, Sent> const &it)
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    get_cursor(it).indirect_move_(make_index_sequence<sizeof...(Rngs)>{})
+                )
+            public:
+                using difference_type = difference_type_;
+                using value_type =
+                    detail::decay_t<decltype(fun_(copy_tag{}, range_iterator_t<Rngs>{}...))>;
+
+                indexed_cursor() = default;
+                indexed_cursor(fun_ref_ fun, std::tuple<range_iterator_t<Rngs>...> its,
+                    difference_type n = 0)
+                  : fun_(std::move(fun)), its_(std::move(its)), n_(n)
+                {}
+                auto current() const
+                RANGES_DECLTYPE_AUTO_RETURN_NOEXCEPT
+                (
+                    this->current_(make_index_sequence<sizeof...(Rngs)>{})
+                )
+                void next()
+                {
+                    ++n_;
+                }
+                bool equal(indexed_cursor const &that) const
+                {
+                    return n_ == that.n_;
+                }
+                void prev()
+                {
+                    --n_;
+                }
+                void advance(difference_type n)
+                {
+                    n_ += n;
+                }
+                difference_type distance_to(indexed_cursor const &that) const
+                {
+                    return that.n_ - n_;
+                }
+            };
+
             using are_bounded_t = meta::and_c<(bool) BoundedIterable<Rngs>()...>;
+            using are_indexed_t = meta::and_c<
+                ((bool) SizedIterable<Rngs>() && (bool) RandomAccessIterable<Rngs>())...>;
+            using cursor_t = meta::if_<are_indexed_t, indexed_cursor, cursor>;
+            using end_cursor_t = meta::if_<are_indexed_t, indexed_cursor,
+                meta::if_<are_bounded_t, cursor, sentinel>>;
+
+            template<typename Tup>
+            end_cursor_t end_cursor_(Tup &rngs, std::false_type) const
+            {
+                return {fun_, tuple_transform(rngs, end)};
+            }
+            template<typename Tup>
+            end_cursor_t end_cursor_(Tup &rngs, std::true_type) const
+            {
+                return {fun_, tuple_transform(rngs, begin),
+                    static_cast<difference_type_>(this->size())};
+            }
 
-            cursor begin_cursor()
+            cursor_t begin_cursor()
             {
                 return {fun_, tuple_transform(rngs_, begin)};
             }
-            meta::if_<are_bounded_t, cursor, sentinel> end_cursor()
+            end_cursor_t end_cursor()
             {
-                return {fun_, tuple_transform(rngs_, end)};
+                return this->end_cursor_(rngs_, are_indexed_t{});
             }
             CONCEPT_REQUIRES(meta::and_c<(bool) Iterable<Rngs const>()...>::value)
-            cursor begin_cursor() const
+            cursor_t begin_cursor() const
             {
                 return {fun_, tuple_transform(rngs_, begin)};
             }
             CONCEPT_REQUIRES(meta::and_c<(bool) Iterable<Rngs const>()...>::value)
-            meta::if_<are_bounded_t, cursor, sentinel> end_cursor() const
+            end_cursor_t end_cursor() const
             {
-                return {fun_, tuple_transform(rngs_, end)};
+                return this->end_cursor_(rngs_, are_indexed_t{});
             }
         public:
             iter_zip_with_view() = default;
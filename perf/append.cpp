@@ -0,0 +1,74 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Appends the output of view::transform and view::join to a vector, with
+// action::push_back and by calling the vector's own insert on the range's
+// common iterators.
+//
+// Usage: append [count]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+template<typename Rng>
+void report(char const *name, Rng rng)
+{
+    using namespace ranges;
+    using C = range_common_iterator_t<Rng>;
+    std::size_t n = 0;
+    long const insert = ::benchmark([&]
+    {
+        std::vector<long> v;
+        v.insert(v.end(), C{begin(rng)}, C{end(rng)});
+        n = v.size();
+    });
+    long const push = ::benchmark([&]
+    {
+        std::vector<long> v;
+        push_back(v, rng);
+        n = v.size();
+    });
+    std::cout << name << " : vector::insert " << insert << "ms, push_back " << push
+              << "ms (" << n << " elements)\n";
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 10000000 : std::atoi(argv[1]);
+
+    std::vector<std::vector<long>> vv(static_cast<std::size_t>(n / 100));
+    for(auto &v : vv)
+        v = view::ints(0, 99) | view::transform([](int i){return (long)i; });
+
+    ::report("ints | transform", view::ints(0, n - 1) | view::transform([](int i){return 3L * i; }));
+    ::report("ints | take     ", view::ints(0L) | view::take(n));
+    ::report("join(vectors)   ", vv | view::join);
+}
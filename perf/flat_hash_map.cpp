@@ -0,0 +1,79 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Counts the occurrences of pseudo-random keys, then looks each key up
+// again, with std::unordered_map and with flat_hash_map.
+//
+// Usage: flat_hash_map [count] [distinct keys]
+
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <unordered_map>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+template<typename Map>
+void report(char const *name, std::vector<long> const &keys)
+{
+    long found = 0;
+    std::size_t n = 0;
+    long const count = ::benchmark([&]
+    {
+        Map m;
+        for(long k : keys)
+            ++m[k];
+        n = m.size();
+    });
+    Map m;
+    for(long k : keys)
+        ++m[k];
+    long const lookup = ::benchmark([&]
+    {
+        found = 0;
+        for(long k : keys)
+            found += m.find(k)->second;
+    });
+    std::cout << name << " : count " << count << "ms, lookup " << lookup << "ms ("
+              << n << " keys, " << found << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+    int const n = argc < 2 ? 10000000 : std::atoi(argv[1]);
+    long const distinct = argc < 3 ? 1000000 : std::atol(argv[2]);
+
+    std::mt19937_64 gen;
+    std::uniform_int_distribution<long> dist(0, distinct - 1);
+    std::vector<long> keys(static_cast<std::size_t>(n));
+    for(auto &k : keys)
+        k = dist(gen) * 7919;
+
+    ::report<std::unordered_map<long, long>>("unordered_map", keys);
+    ::report<ranges::flat_hash_map<long, long>>("flat_hash_map", keys);
+}
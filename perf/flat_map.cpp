@@ -0,0 +1,88 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Builds many small ordered maps from unsorted batches, then iterates and
+// searches them, with std::map and with flat_map.
+//
+// Usage: flat_map [maps] [elements per map]
+
+#include <map>
+#include <random>
+#include <vector>
+#include <utility>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+template<typename Map>
+void report(char const *name, std::vector<std::vector<std::pair<int, long>>> const &batches)
+{
+    std::vector<Map> maps(batches.size());
+    long const build = ::benchmark([&]
+    {
+        for(std::size_t i = 0; i < batches.size(); ++i)
+        {
+            maps[i].clear();
+            maps[i].insert(batches[i].begin(), batches[i].end());
+        }
+    });
+    long sum = 0;
+    long const iterate = ::benchmark([&]
+    {
+        sum = 0;
+        for(auto const &m : maps)
+            for(auto const &kv : m)
+                sum += kv.second;
+    });
+    long found = 0;
+    long const lookup = ::benchmark([&]
+    {
+        found = 0;
+        for(std::size_t i = 0; i < batches.size(); ++i)
+            for(auto const &kv : batches[i])
+                found += maps[i].find(kv.first)->second;
+    });
+    std::cout << name << " : build " << build << "ms, iterate " << iterate << "ms, lookup "
+              << lookup << "ms (" << sum << ", " << found << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+    int const nmaps = argc < 2 ? 10000 : std::atoi(argv[1]);
+    int const n = argc < 3 ? 200 : std::atoi(argv[2]);
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist(0, 4 * n);
+    std::vector<std::vector<std::pair<int, long>>> batches(static_cast<std::size_t>(nmaps));
+    for(auto &batch : batches)
+        for(int i = 0; i < n; ++i)
+            batch.emplace_back(dist(gen), i);
+
+    ::report<std::map<int, long>>("std::map", batches);
+    ::report<ranges::flat_map<int, long>>("flat_map", batches);
+}
@@ -0,0 +1,106 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums pipelines of view::join, view::concat, view::transform and
+// view::remove_if with a loop over their iterators, and with accumulate,
+// which has the views push their elements through for_each_while.
+//
+// Usage: for_each_while [elements [a]]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+// view::join is single-pass, so each run gets a new view from make.
+template<typename Make>
+void compare(char const *name, Make make)
+{
+    long long sum = 0;
+    long const pull = ::benchmark([&]
+    {
+        auto rng = make();
+        sum = 0;
+        auto const e = ranges::end(rng);
+        for(auto it = ranges::begin(rng); it != e; ++it)
+            sum += *it;
+    });
+    long long const pull_sum = sum;
+    long const push = ::benchmark([&]
+    {
+        auto rng = make();
+        sum = ranges::accumulate(rng, 0ll);
+    });
+    std::cout << name << ": pull " << pull << "ms, push " << push << "ms ("
+        << pull_sum << ", " << sum << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 40000000 : std::atoi(argv[1]);
+    // Read at run time, so that the functions are stateful and cannot be
+    // folded into the loops.
+    int const a = argc < 3 ? 3 : std::atoi(argv[2]);
+    int const m = a + 1;
+
+    std::vector<int> v(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = i % 1000;
+
+    // Inner ranges of a few dozen elements each.
+    std::vector<std::vector<int>> vv;
+    for(int i = 0; i < n;)
+    {
+        int const len = 16 + i % 48;
+        vv.emplace_back(v.begin() + i, v.begin() + std::min(n, i + len));
+        i += len;
+    }
+
+    auto f = [a](int i) { return i * a; };
+    auto p = [m](int i) { return (i & m) == 0; };
+
+    compare("transform | remove_if       ", [&]
+    {
+        return v | view::transform(f) | view::remove_if(p);
+    });
+    compare("join                        ", [&]
+    {
+        return vv | view::join;
+    });
+    compare("join | transform | remove_if", [&]
+    {
+        return vv | view::join | view::transform(f) | view::remove_if(p);
+    });
+    int const third = n / 3;
+    compare("concat                      ", [&]
+    {
+        return view::concat(view::take(v, third), view::drop(v, third) | view::transform(f),
+            view::drop(v, 2 * third) | view::take(third));
+    });
+}
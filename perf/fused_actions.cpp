@@ -0,0 +1,81 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares composed actions, which fuse adjacent steps where they can,
+// against applying the same actions one at a time.
+//
+// Usage: fused_actions [count]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(std::vector<long> const &input, Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        std::vector<long> v = input;
+        timer t;
+        fun(v);
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+template<typename Fused, typename Unfused>
+void report(char const *name, std::vector<long> const &input, Fused fused, Unfused unfused)
+{
+    long const f = ::benchmark(input, fused);
+    long const u = ::benchmark(input, unfused);
+    std::cout << name << " : unfused " << u << "ms, fused " << f << "ms\n";
+}
+
+struct is_odd
+{
+    bool operator()(long i) const
+    {
+        return i % 2 == 1;
+    }
+};
+
+struct scale
+{
+    long operator()(long i) const
+    {
+        return 3 * i + 1;
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 50000000 : std::atoi(argv[1]);
+    std::vector<long> const input = view::ints(0, n - 1) | view::transform(scale{});
+
+    ::report("remove_if | transform", input,
+        [](std::vector<long> &v){ v |= action::remove_if(is_odd{}) | action::transform(scale{}); },
+        [](std::vector<long> &v){ v |= action::remove_if(is_odd{}); v |= action::transform(scale{}); });
+
+    ::report("transform | remove_if", input,
+        [](std::vector<long> &v){ v |= action::transform(scale{}) | action::remove_if(is_odd{}); },
+        [](std::vector<long> &v){ v |= action::transform(scale{}); v |= action::remove_if(is_odd{}); });
+
+    ::report("drop | take          ", input,
+        [=](std::vector<long> &v){ v |= action::drop(n / 4) | action::take(n / 2); },
+        [=](std::vector<long> &v){ v |= action::drop(n / 4); v |= action::take(n / 2); });
+}
@@ -0,0 +1,97 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums rng | transform(f) | transform(g) | remove_if(p) | transform(h) with a
+// hand-written loop, with the views as view::transform and view::remove_if
+// build them, which fuse stacked adaptors, and with the same views nested one
+// inside the other.
+//
+// Usage: fusion [elements [a]]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 40000000 : std::atoi(argv[1]);
+    // Read at run time, so that the functions are stateful and cannot be
+    // folded into the loops.
+    int const a = argc < 3 ? 3 : std::atoi(argv[2]);
+    int const b = a + 4;
+    int const m = a + 1;
+
+    std::vector<int> v(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = i % 1000;
+
+    auto f = [a](int i) { return i * a; };
+    auto g = [b](int i) { return i + b; };
+    auto p = [m](int i) { return (i & m) == 0; };
+    auto h = [a](int i) { return static_cast<long long>(i >> a); };
+
+    long long sum = 0;
+    long const raw = ::benchmark([&]
+    {
+        sum = 0;
+        for(int i : v)
+        {
+            int const x = g(f(i));
+            if(!p(x))
+                sum += h(x);
+        }
+    });
+    std::cout << "raw loop : " << raw << "ms (" << sum << ")\n";
+
+    auto fused = v | view::transform(f) | view::transform(g) | view::remove_if(p)
+                   | view::transform(h);
+    long const fused_ms = ::benchmark([&]
+    {
+        sum = 0;
+        for(long long x : fused)
+            sum += x;
+    });
+    std::cout << "fused    : " << fused_ms << "ms (" << sum << ")\n";
+
+    using t1 = transform_view<range<std::vector<int>::iterator>, decltype(f)>;
+    using t2 = transform_view<t1, decltype(g)>;
+    using r3 = remove_if_view<t2, decltype(p)>;
+    using t4 = transform_view<r3, decltype(h)>;
+    t4 nested{r3{t2{t1{{v.begin(), v.end()}, f}, g}, p}, h};
+    long const nested_ms = ::benchmark([&]
+    {
+        sum = 0;
+        for(long long x : nested)
+            sum += x;
+    });
+    std::cout << "nested   : " << nested_ms << "ms (" << sum << ")\n";
+    std::cout << "iterator size, fused " << sizeof(begin(fused)) << " bytes, nested "
+        << sizeof(begin(nested)) << " bytes\n";
+}
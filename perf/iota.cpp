@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums the integers 0, 1, ..., n - 1 with a raw loop and with accumulate over
+// view::ints, which adds them up in closed form; counts the multiples of 7
+// among them with a raw loop and with count_if over view::ints; and finds
+// where the squares pass n with lower_bound over view::ints(0) transformed,
+// which gallops over the unbounded range.
+//
+// Usage: iota [n]
+
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    long long const n = argc < 2 ? 200000000LL : std::atoll(argv[1]);
+
+    long long sum = 0;
+    long const raw_sum = ::benchmark([&]
+    {
+        sum = 0;
+        for(long long i = 0; i < n; ++i)
+            sum += i;
+    });
+    std::cout << "sum, raw loop           : " << raw_sum << "ms (" << sum << ")\n";
+
+    long const iota_sum = ::benchmark([&]
+    {
+        sum = accumulate(view::ints(0LL, n - 1), 0LL);
+    });
+    std::cout << "sum, accumulate ints    : " << iota_sum << "ms (" << sum << ")\n";
+
+    long long count = 0;
+    long const raw_count = ::benchmark([&]
+    {
+        count = 0;
+        for(long long i = 0; i < n; ++i)
+            count += i % 7 == 0;
+    });
+    std::cout << "count, raw loop         : " << raw_count << "ms (" << count << ")\n";
+
+    long const iota_count = ::benchmark([&]
+    {
+        count = count_if(view::ints(0LL, n - 1), [](long long i) { return i % 7 == 0; });
+    });
+    std::cout << "count, count_if ints    : " << iota_count << "ms (" << count << ")\n";
+
+    long long root = 0;
+    long const raw_root = ::benchmark([&]
+    {
+        for(int r = 0; r < 100000; ++r)
+        {
+            root = 0;
+            while(root * root < n + r)
+                ++root;
+        }
+    });
+    std::cout << "root, raw loop          : " << raw_root << "ms (" << root << ")\n";
+
+    auto squares = view::ints(0LL) | view::transform([](long long i) { return i * i; });
+    long const iota_root = ::benchmark([&]
+    {
+        for(int r = 0; r < 100000; ++r)
+            root = distance(begin(squares), lower_bound(squares, n + r));
+    });
+    std::cout << "root, lower_bound ints  : " << iota_root << "ms (" << root << ")\n";
+}
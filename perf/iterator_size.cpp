@@ -0,0 +1,75 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Reports the size of the iterator and sentinel of a few pipelines of views
+// over a std::vector<int>, in multiples of the size of its iterator. Wide
+// iterators are copied on every step of the adaptors above them and spill
+// registers in hot loops.
+//
+// Usage: iterator_size
+
+#include <vector>
+#include <iomanip>
+#include <iostream>
+#include <functional>
+#include <range/v3/all.hpp>
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return i % 2 != 0;
+    }
+};
+
+struct twice
+{
+    int operator()(int i) const
+    {
+        return 2 * i;
+    }
+};
+
+template<typename Rng>
+void report(char const *name, Rng &&rng)
+{
+    constexpr std::size_t word = sizeof(std::vector<int>::iterator);
+    std::cout << std::left << std::setw(44) << name
+              << std::right << std::setw(4) << sizeof(ranges::begin(rng)) / word
+              << std::setw(4) << (sizeof(ranges::end(rng)) + word - 1) / word << '\n';
+}
+
+int main()
+{
+    using namespace ranges;
+    std::vector<int> v;
+    int k = 3;
+    auto stateful = [k](int i) { return i % k != 0; };
+
+    std::cout << std::left << std::setw(44) << "pipeline over v" << "  it sent\n";
+    report("transform(twice)", v | view::transform(twice{}));
+    report("remove_if(is_odd)", v | view::remove_if(is_odd{}));
+    report("remove_if(stateful lambda)", v | view::remove_if(stateful));
+    report("reverse", v | view::reverse);
+    report("stride(2)", v | view::stride(2));
+    report("take_while(is_odd)", v | view::take_while(is_odd{}));
+    report("partial_sum(plus)", v | view::partial_sum(std::plus<int>{}));
+    report("iota | remove_if(is_odd)", view::iota(0) | view::remove_if(is_odd{}));
+    report("transform | remove_if | reverse",
+        v | view::transform(twice{}) | view::remove_if(is_odd{}) | view::reverse);
+    report("transform | reverse | transform | take_while",
+        v | view::transform(twice{}) | view::reverse | view::transform(twice{}) |
+        view::take_while(is_odd{}));
+    report("(remove_if | transform) x 2 | remove_if",
+        v | view::remove_if(is_odd{}) | view::transform(twice{}) |
+        view::remove_if(is_odd{}) | view::transform(twice{}) | view::remove_if(is_odd{}));
+}
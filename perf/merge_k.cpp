@@ -0,0 +1,167 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Merges many sorted runs into one: with a tree of pairwise merges, with a
+// binary heap of run heads, and with merge_k; first runs of ints, then runs
+// of 64-byte records.
+//
+// Usage: merge_k [runs] [elements per run]
+
+#include <array>
+#include <queue>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <utility>
+#include <iostream>
+#include <functional>
+#include <range/v3/all.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+struct record
+{
+    int key;
+    std::array<char, 60> payload;
+    friend bool operator<(record const &x, record const &y)
+    {
+        return x.key < y.key;
+    }
+    friend bool operator>(record const &x, record const &y)
+    {
+        return y < x;
+    }
+    friend bool operator<=(record const &x, record const &y)
+    {
+        return !(y < x);
+    }
+    friend bool operator>=(record const &x, record const &y)
+    {
+        return !(x < y);
+    }
+    friend bool operator==(record const &x, record const &y)
+    {
+        return x.key == y.key;
+    }
+    friend bool operator!=(record const &x, record const &y)
+    {
+        return !(x == y);
+    }
+};
+
+long key_of(int i)
+{
+    return i;
+}
+
+long key_of(record const &r)
+{
+    return r.key;
+}
+
+template<typename T>
+void pairwise(std::vector<std::vector<T>> runs, std::vector<T> &out)
+{
+    while(runs.size() > 1)
+    {
+        std::vector<std::vector<T>> next;
+        for(std::size_t i = 0; i + 1 < runs.size(); i += 2)
+        {
+            std::vector<T> merged(runs[i].size() + runs[i + 1].size());
+            ranges::merge(runs[i], runs[i + 1], merged.begin());
+            next.push_back(std::move(merged));
+        }
+        if(runs.size() % 2)
+            next.push_back(std::move(runs.back()));
+        runs = std::move(next);
+    }
+    out = std::move(runs.front());
+}
+
+template<typename T>
+void heap(std::vector<std::vector<T>> const &runs, std::vector<T> &out)
+{
+    using head = std::pair<T, std::size_t>;
+    auto greater = [](head const &x, head const &y)
+    {
+        return y.first < x.first || (!(x.first < y.first) && y.second < x.second);
+    };
+    std::priority_queue<head, std::vector<head>, decltype(greater)> heads(greater);
+    std::vector<std::size_t> pos(runs.size(), 0);
+    for(std::size_t i = 0; i < runs.size(); ++i)
+        if(!runs[i].empty())
+            heads.push({runs[i][0], i});
+    out.clear();
+    while(!heads.empty())
+    {
+        std::size_t const i = heads.top().second;
+        out.push_back(heads.top().first);
+        heads.pop();
+        if(++pos[i] != runs[i].size())
+            heads.push({runs[i][pos[i]], i});
+    }
+}
+
+template<typename T, typename Make>
+void report(char const *name, int k, int n, Make make)
+{
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist;
+    std::vector<std::vector<T>> runs(static_cast<std::size_t>(k));
+    for(auto &run : runs)
+    {
+        for(int i = 0; i < n; ++i)
+            run.push_back(make(dist(gen)));
+        ranges::sort(run);
+    }
+
+    std::vector<T> out;
+    out.reserve(static_cast<std::size_t>(k) * static_cast<std::size_t>(n));
+    std::cout << name << '\n';
+    std::cout << "  pairwise merges : " << ::benchmark([&] { pairwise(runs, out); }) << "ms\n";
+    std::cout << "  binary heap     : " << ::benchmark([&] { heap(runs, out); }) << "ms\n";
+    std::cout << "  merge_k         : " << ::benchmark([&]
+    {
+        out.clear();
+        ranges::merge_k(runs, ranges::back_inserter(out));
+    }) << "ms (" << ranges::is_sorted(out) << ")\n";
+    long sum = 0;
+    std::cout << "  view::merge_k   : " << ::benchmark([&]
+    {
+        sum = 0;
+        RANGES_FOR(T const &t, ranges::view::merge_k(runs))
+            sum += key_of(t);
+    }) << "ms (" << sum << ")\n";
+}
+
+int main(int argc, char *argv[])
+{
+    int const k = argc < 2 ? 256 : std::atoi(argv[1]);
+    int const n = argc < 3 ? 20000 : std::atoi(argv[2]);
+    ::report<int>("int", k, n, [](int i) { return i; });
+    ::report<record>("record", k, n / 4, [](int i) { return record{i, {}}; });
+}
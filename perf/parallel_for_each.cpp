@@ -0,0 +1,102 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Compares the serial and parallel versions of for_each and transform on
+// random-access view pipelines.
+//
+// Usage: parallel_for_each [count]
+//
+// Built as C++14 for the generic lambdas.
+
+#include <cmath>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+// Enough arithmetic per element that the work is not purely memory-bound.
+inline double work(double d)
+{
+    return std::sqrt(d) * std::sin(d) + std::cos(d);
+}
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+template<typename Fun>
+void report(char const *name, Fun fun)
+{
+    long const seq = ::benchmark([&]{ fun(ranges::execution::seq); });
+    long const par = ::benchmark([&]{ fun(ranges::execution::par); });
+    std::cout << name << " : seq " << seq << "ms, par " << par << "ms, speedup "
+              << (par ? (double)seq / (double)par : 0.0) << "x\n";
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 10000000 : std::atoi(argv[1]);
+    std::cout << "elements: " << n << ", worker threads: "
+              << execution::default_thread_pool().size() << "\n";
+
+    std::vector<double> a = view::ints(0, n - 1) | view::transform([](int i){return (double)i; });
+    std::vector<double> b(a.begin(), a.end());
+    std::vector<double> out(a.size());
+
+    report("for_each  (ints)            ", [&](auto policy)
+    {
+        auto rng = view::ints(0, n - 1);
+        for_each(policy, rng, [&](int i){out[(std::size_t)i] = work(i); });
+    });
+
+    report("for_each  (ints | transform)", [&](auto policy)
+    {
+        auto rng = view::ints(0, n - 1) | view::transform([&](int i){return &out[(std::size_t)i]; });
+        for_each(policy, rng, [](double *d){*d = work(*d); });
+    });
+
+    report("for_each  (zip(a, b))       ", [&](auto policy)
+    {
+        auto rng = view::zip(a, b);
+        for_each(policy, rng, [](auto p){std::get<0>(p) = work(std::get<1>(p)); });
+    });
+
+    report("transform (vector)          ", [&](auto policy)
+    {
+        transform(policy, a, out.begin(), [](double d){return work(d); });
+    });
+
+    report("transform (a, b)            ", [&](auto policy)
+    {
+        transform(policy, a, b, out.begin(), [](double x, double y){return work(x) + y; });
+    });
+
+    report("transform (zip(a, b))       ", [&](auto policy)
+    {
+        auto rng = view::zip(a, b);
+        transform(policy, rng, out.begin(),
+            [](auto p){return work(std::get<0>(p) * std::get<1>(p)); });
+    });
+}
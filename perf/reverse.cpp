@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums and copies a vector back to front with a raw index loop,
+// std::reverse_iterator and view::reverse.
+//
+// Usage: reverse [elements]
+
+#include <vector>
+#include <cstdlib>
+#include <iterator>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 20000000 : std::atoi(argv[1]);
+
+    std::vector<int> v(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = i % 1000;
+    std::vector<int> out(v.size());
+    auto rv = v | view::reverse;
+
+    long long sum = 0;
+    long const raw_sum = ::benchmark([&]
+    {
+        sum = 0;
+        for(std::size_t i = v.size(); i != 0; --i)
+            sum += v[i - 1];
+    });
+    std::cout << "raw loop           : sum  " << raw_sum << "ms (" << sum << ")\n";
+    long const std_sum = ::benchmark([&]
+    {
+        sum = std::accumulate(v.rbegin(), v.rend(), 0ll);
+    });
+    std::cout << "reverse_iterator   : sum  " << std_sum << "ms (" << sum << ")\n";
+    long const view_sum = ::benchmark([&]
+    {
+        sum = accumulate(rv, 0ll);
+    });
+    std::cout << "view::reverse      : sum  " << view_sum << "ms (" << sum << ")\n";
+
+    long const raw_copy = ::benchmark([&]
+    {
+        auto o = out.begin();
+        for(std::size_t i = v.size(); i != 0; --i)
+            *o++ = v[i - 1];
+    });
+    std::cout << "raw loop           : copy " << raw_copy << "ms (" << out.front() << ")\n";
+    long const std_copy = ::benchmark([&]
+    {
+        std::copy(v.rbegin(), v.rend(), out.begin());
+    });
+    std::cout << "reverse_iterator   : copy " << std_copy << "ms (" << out.front() << ")\n";
+    long const view_copy = ::benchmark([&]
+    {
+        copy(rv, out.begin());
+    });
+    std::cout << "view::reverse      : copy " << view_copy << "ms (" << out.front() << ")\n";
+}
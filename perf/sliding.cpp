@@ -0,0 +1,78 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Moving sums and moving maxima over a vector, recomputing each window from
+// view::sliding and maintaining them with view::sliding_fold and
+// view::sliding_max.
+//
+// Usage: sliding [elements [window]]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 4000000 : std::atoi(argv[1]);
+    int const w = argc < 3 ? 64 : std::atoi(argv[2]);
+
+    std::vector<long long> v(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = (i * 7919) % 1000;
+
+    long long total = 0;
+    long const sums = ::benchmark([&]
+    {
+        total = 0;
+        for(auto &&win : v | view::sliding(w))
+            total += accumulate(win, 0ll);
+    });
+    std::cout << "view::sliding + accumulate   : " << sums << "ms (" << total << ")\n";
+    long const folds = ::benchmark([&]
+    {
+        auto rng = v | view::sliding_fold(w, std::plus<long long>{}, std::minus<long long>{});
+        total = accumulate(rng, 0ll);
+    });
+    std::cout << "view::sliding_fold           : " << folds << "ms (" << total << ")\n";
+    long const maxs = ::benchmark([&]
+    {
+        total = 0;
+        for(auto &&win : v | view::sliding(w))
+            total += *max_element(win);
+    });
+    std::cout << "view::sliding + max_element  : " << maxs << "ms (" << total << ")\n";
+    long const extrema = ::benchmark([&]
+    {
+        auto rng = v | view::sliding_max(w);
+        total = accumulate(rng, 0ll);
+    });
+    std::cout << "view::sliding_max            : " << extrema << "ms (" << total << ")\n";
+}
@@ -0,0 +1,100 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums one field of a table of particles kept as a vector of structs and as
+// a soa_vector, then sorts both tables by another field.
+//
+// Usage: soa_vector [particles]
+
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+struct particle
+{
+    double x, y, z;
+    double vx, vy, vz;
+    float mass;
+    int id;
+};
+
+struct by_id
+{
+    template<typename T>
+    auto operator()(T const &t) const -> decltype(std::get<7>(t))
+    {
+        return std::get<7>(t);
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 4000000 : std::atoi(argv[1]);
+
+    std::mt19937 gen;
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::uniform_int_distribution<int> ids;
+    std::vector<particle> aos;
+    soa_vector<double, double, double, double, double, double, float, int> soa;
+    aos.reserve(static_cast<std::size_t>(n));
+    soa.reserve(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+    {
+        particle p{dist(gen), dist(gen), dist(gen), dist(gen), dist(gen), dist(gen),
+            static_cast<float>(dist(gen) + 2.0), ids(gen)};
+        aos.push_back(p);
+        soa.emplace_back(p.x, p.y, p.z, p.vx, p.vy, p.vz, p.mass, p.id);
+    }
+
+    double sum = 0;
+    long const aos_scan = ::benchmark([&]
+    {
+        sum = 0;
+        for(auto const &p : aos)
+            sum += p.x;
+    });
+    std::cout << "vector<particle> : sum of x " << aos_scan << "ms (" << sum << ")\n";
+    long const soa_scan = ::benchmark([&]
+    {
+        sum = 0;
+        for(double x : soa.column<0>())
+            sum += x;
+    });
+    std::cout << "soa_vector       : sum of x " << soa_scan << "ms (" << sum << ")\n";
+
+    timer t;
+    sort(aos, std::less<int>{}, &particle::id);
+    std::cout << "vector<particle> : sort by id " << t.elapsed().count() << "ms\n";
+    t.reset();
+    sort(soa, std::less<int>{}, by_id{});
+    std::cout << "soa_vector       : sort by id " << t.elapsed().count() << "ms ("
+              << (std::get<7>(soa.front()) == aos.front().id) << ")\n";
+}
@@ -0,0 +1,69 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sorts an array of keys together with three parallel arrays of doubles and
+// one of strings, by sorting a view::zip of all five and with sort_by_key.
+//
+// Usage: sort_by_key [elements]
+
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+struct first
+{
+    template<typename T>
+    auto operator()(T const &t) const -> decltype(std::get<0>(t))
+    {
+        return std::get<0>(t);
+    }
+};
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 2000000 : std::atoi(argv[1]);
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<int> dist;
+    std::vector<int> keys0(static_cast<std::size_t>(n));
+    for(auto &k : keys0)
+        k = dist(gen);
+    std::vector<double> a0(keys0.begin(), keys0.end()), b0 = a0, c0 = a0;
+    std::vector<std::string> d0;
+    for(int k : keys0)
+        d0.push_back(std::to_string(k));
+
+    {
+        auto keys = keys0;
+        auto a = a0, b = b0, c = c0;
+        auto d = d0;
+        timer t;
+        auto rng = view::zip(keys, a, b, c, d);
+        sort(rng, ordered_less{}, first{});
+        std::cout << "sort of view::zip : " << t.elapsed().count() << "ms ("
+                  << (a.front() == keys.front()) << ")\n";
+    }
+    {
+        auto keys = keys0;
+        auto a = a0, b = b0, c = c0;
+        auto d = d0;
+        timer t;
+        sort_by_key(keys, a, b, c, d);
+        std::cout << "sort_by_key       : " << t.elapsed().count() << "ms ("
+                  << (a.front() == keys.front()) << ")\n";
+    }
+}
@@ -0,0 +1,88 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Splits a newline-delimited buffer into lines, comparing view::split's
+// byte search for a single character delimiter against testing one
+// position at a time with an equivalent delimiter function.
+//
+// Usage: split_lines [megabytes]
+
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 3;
+
+// The same delimiter as '\n', but opaque to view::split, so every position
+// is tested with a call.
+struct is_newline
+{
+    template<typename I, typename S>
+    std::pair<bool, ranges::iterator_difference_t<I>> operator()(I cur, S) const
+    {
+        return {*cur == '\n', *cur == '\n' ? 1 : 0};
+    }
+};
+
+// Only steps from line to line, so that the time is spent finding delimiters
+// rather than walking the characters of each line.
+template<typename Fun>
+void report(char const *name, Fun fun)
+{
+    long ms = 0;
+    std::ptrdiff_t lines = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        lines = ranges::distance(fun());
+        ms += t.elapsed().count();
+    }
+    std::cout << name << " : " << (ms / cloops) << "ms (" << lines << " lines)\n";
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const mb = argc < 2 ? 1024u : static_cast<std::size_t>(std::atol(argv[1]));
+
+    // Lines of varying length, from empty to a couple hundred characters.
+    std::string buf;
+    buf.reserve(mb << 20);
+    std::size_t len = 0;
+    while(buf.size() + 256 < (mb << 20))
+    {
+        buf.append(len, 'x');
+        buf.push_back('\n');
+        len = (len * 7 + 13) % 211;
+    }
+    std::cout << "buffer: " << (buf.size() >> 20) << "MB\n";
+
+    report("split(buf, '\\n')               ", [&]
+    {
+        return view::split(buf, '\n');
+    });
+    report("split(buf, is_newline{})       ", [&]
+    {
+        return view::split(buf, is_newline{});
+    });
+    report("split(c_str(buf), '\\n')        ", [&]
+    {
+        return view::c_str(buf.c_str()) | view::split('\n');
+    });
+    report("split(c_str(buf), is_newline{})", [&]
+    {
+        return view::c_str(buf.c_str()) | view::split(is_newline{});
+    });
+}
@@ -0,0 +1,78 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Sums every stride-th element of a vector, forwards and backwards, with raw
+// index loops and with view::stride.
+//
+// Usage: stride [elements [stride]]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    int const n = argc < 2 ? 40000000 : std::atoi(argv[1]);
+    int const s = argc < 3 ? 4 : std::atoi(argv[2]);
+
+    std::vector<int> v(static_cast<std::size_t>(n));
+    for(int i = 0; i < n; ++i)
+        v[static_cast<std::size_t>(i)] = i % 1000;
+    auto sv = view::stride(v, s);
+    auto rsv = sv | view::reverse;
+
+    long long sum = 0;
+    long const raw_fwd = ::benchmark([&]
+    {
+        sum = 0;
+        for(std::size_t i = 0; i < v.size(); i += static_cast<std::size_t>(s))
+            sum += v[i];
+    });
+    std::cout << "raw loop      : forward  " << raw_fwd << "ms (" << sum << ")\n";
+    long const view_fwd = ::benchmark([&]
+    {
+        sum = accumulate(sv, 0ll);
+    });
+    std::cout << "view::stride  : forward  " << view_fwd << "ms (" << sum << ")\n";
+    long const raw_bwd = ::benchmark([&]
+    {
+        sum = 0;
+        std::size_t const last = (v.size() - 1) / static_cast<std::size_t>(s) *
+            static_cast<std::size_t>(s);
+        for(std::size_t i = last + static_cast<std::size_t>(s); i != 0;)
+            sum += v[i -= static_cast<std::size_t>(s)];
+    });
+    std::cout << "raw loop      : backward " << raw_bwd << "ms (" << sum << ")\n";
+    long const view_bwd = ::benchmark([&]
+    {
+        sum = accumulate(rsv, 0ll);
+    });
+    std::cout << "view::stride  : backward " << view_bwd << "ms (" << sum << ")\n";
+}
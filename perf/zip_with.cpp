@@ -0,0 +1,112 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+//
+
+// Adds two vectors of ints into a third, and takes their dot product, with
+// raw indexed loops and with view::zip_with and view::zip. The vectors are
+// small enough to stay in cache, so that the loops are not bound by memory,
+// and each is run many times.
+//
+// Usage: zip_with [elements [repeats]]
+
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <functional>
+#include <range/v3/all.hpp>
+#include "./timer.hpp"
+
+constexpr int cloops = 5;
+
+template<typename Fun>
+long benchmark(Fun fun)
+{
+    long ms = 0;
+    for(int j = 0; j < cloops; ++j)
+    {
+        timer t;
+        fun();
+        ms += t.elapsed().count();
+    }
+    return ms / cloops;
+}
+
+int main(int argc, char *argv[])
+{
+    using namespace ranges;
+    std::size_t const n = argc < 2 ? 4096u : std::strtoul(argv[1], nullptr, 10);
+    int const repeats = argc < 3 ? 50000 : std::atoi(argv[2]);
+
+    std::vector<int> a(n), b(n), c(n);
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = static_cast<int>(i % 1000);
+        b[i] = static_cast<int>(i % 777);
+    }
+
+    long const raw_add = ::benchmark([&]
+    {
+        for(int r = 0; r < repeats; ++r)
+        {
+            for(std::size_t i = 0; i < n; ++i)
+                c[i] = a[i] + b[i];
+            a[0] = c[n / 2];
+        }
+    });
+    std::cout << "add, raw loop         : " << raw_add << "ms (" << c[n / 2] << ")\n";
+
+    auto sums = view::zip_with(std::plus<int>{}, a, b);
+    long const zip_add = ::benchmark([&]
+    {
+        for(int r = 0; r < repeats; ++r)
+        {
+            copy(sums, c.begin());
+            a[0] = c[n / 2];
+        }
+    });
+    std::cout << "add, zip_with | copy  : " << zip_add << "ms (" << c[n / 2] << ")\n";
+
+    int dot = 0;
+    long const raw_dot = ::benchmark([&]
+    {
+        for(int r = 0; r < repeats; ++r)
+        {
+            dot = 0;
+            for(std::size_t i = 0; i < n; ++i)
+                dot += a[i] * b[i];
+            a[0] = dot & 1;
+        }
+    });
+    std::cout << "dot, raw loop         : " << raw_dot << "ms (" << dot << ")\n";
+
+    long const zip_dot = ::benchmark([&]
+    {
+        for(int r = 0; r < repeats; ++r)
+        {
+            dot = 0;
+            for(auto p : view::zip(a, b))
+                dot += p.first * p.second;
+            a[0] = dot & 1;
+        }
+    });
+    std::cout << "dot, zip              : " << zip_dot << "ms (" << dot << ")\n";
+
+    auto products = view::zip_with(std::multiplies<int>{}, a, b);
+    long const zip_with_dot = ::benchmark([&]
+    {
+        for(int r = 0; r < repeats; ++r)
+        {
+            dot = accumulate(products, 0);
+            a[0] = dot & 1;
+        }
+    });
+    std::cout << "dot, zip_with | accum : " << zip_with_dot << "ms (" << dot << ")\n";
+}
@@ -8,11 +8,14 @@
 //  http://www.boost.org/LICENSE_1_0.txt)
 
 #include <set>
+#include <memory>
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/for_each.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/action/insert.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -52,5 +55,62 @@ int main()
     insert(ranges::ref(s), 14);
     ::check_equal(s, {0,2,4,6,8,10,12,14});
 
+    // Appending a sized range to a vector grows it at most once, and the
+    // returned iterator points at the first inserted element.
+    {
+        std::vector<int> vi{1,2};
+        auto it = insert(vi, vi.end(), view::ints(3) | view::take(50));
+        CHECK(vi.size() == 52u);
+        CHECK(vi.capacity() >= 52u);
+        CHECK(it == vi.begin() + 2);
+        CHECK(*it == 3);
+        CHECK(vi.back() == 52);
+        it = insert(vi, vi.begin() + 1,
+            view::ints(0) | view::take(3) | view::transform([](int i){return -i;}));
+        CHECK(it == vi.begin() + 1);
+        ::check_equal(vi | view::take(5), {1,0,-1,-2,2});
+    }
+
+    // Repeated appends keep the vector's geometric growth.
+    {
+        std::vector<int> vi;
+        int reallocations = 0;
+        for(int i = 0; i < 1000; ++i)
+        {
+            auto const capacity = vi.capacity();
+            insert(vi, vi.end(), view::ints(0, 3));
+            reallocations += vi.capacity() != capacity;
+        }
+        CHECK(vi.size() == 4000u);
+        CHECK(reallocations < 20);
+        ::check_equal(vi | view::take(6), {0,1,2,3,0,1});
+    }
+
+    // std::string can reserve, too.
+    {
+        std::string str{"ab"};
+        insert(str, str.end(), view::ints('c') | view::take(3));
+        CHECK(str == "abcde");
+    }
+
+    // The elements of an rvalue container are moved.
+    {
+        std::vector<std::unique_ptr<int>> dst, src;
+        src.emplace_back(new int{1});
+        src.emplace_back(new int{2});
+        dst.emplace_back(new int{0});
+        insert(dst, dst.end(), std::move(src));
+        CHECK(dst.size() == 3u);
+        CHECK(*dst[2] == 2);
+        CHECK(src[0] == nullptr);
+
+        src.emplace_back(new int{3});
+        insert(dst, dst.begin(), std::move(src));
+        CHECK(dst.size() == 6u);
+        CHECK(dst[0] == nullptr);
+        CHECK(*dst[2] == 3);
+        CHECK(*dst[3] == 0);
+    }
+
     return ::test_result();
 }
@@ -7,12 +7,16 @@
 //  file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <string>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/c_str.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/action/split.hpp>
+#include <range/v3/view/split.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
@@ -54,5 +58,73 @@ int main()
     ::check_equal(rgv3[0], {1,2,3,4,5,6,7,8,9});
     ::check_equal(rgv3[1], {11,12,13,14,15,16,17,18,19,20});
 
+    // action::split copies the pieces out, whatever the range.
+    {
+        std::string csv{"a b"};
+        auto parts = action::split(csv, ' ');
+        CONCEPT_ASSERT(Same<decltype(parts), std::vector<std::string>>());
+        csv[0] = 'x';
+        CHECK(parts[0] == "a");
+    }
+
+    // action::split_offsets splits a random-access range into a table of
+    // offsets into the source.
+    {
+        std::string csv{"a,bc,,def"};
+        auto table = action::split_offsets(csv, ',');
+        CONCEPT_ASSERT(RandomAccessIterable<decltype(table)>());
+        CONCEPT_ASSERT(!Range<decltype(table)>());
+        CHECK(table.size() == 4u);
+        CHECK(&*begin(table[0]) == &csv[0]);
+        ::check_equal(table[1], {'b', 'c'});
+        CHECK(empty(table[2]));
+        ::check_equal(*(end(table) - 1), {'d', 'e', 'f'});
+        CHECK((end(table) - begin(table)) == 4);
+
+        // The pieces are subranges of the original buffer, not copies.
+        *begin(table[1]) = 'B';
+        CHECK(csv == "a,Bc,,def");
+
+        // Matching view::split exactly, including trailing and leading delimiters
+        std::string s2{",x,,y,"};
+        auto t2 = action::split_offsets(s2, ',');
+        std::vector<std::string> v2 = t2;
+        std::vector<std::string> v2b =
+            view::split(s2, ',') | view::transform(to_<std::string>()) | to_vector;
+        CHECK(v2 == v2b);
+        CHECK(t2.size() == v2b.size());
+    }
+
+    // An rvalue container is moved into the table, which then owns it.
+    {
+        std::string csv{"a long enough string,to defeat the small string optimization"};
+        char const *data = csv.data();
+        auto table = std::move(csv) | action::split_offsets(',');
+        CHECK(table.size() == 2u);
+        CHECK(&*begin(table[0]) == data);
+        CHECK(table.base().data() == data);
+
+        // It is not a view, so views of it refer to it rather than copy it.
+        CONCEPT_ASSERT(!Range<decltype(table)>());
+        CONCEPT_ASSERT(RandomAccessIterable<decltype(table)>());
+        auto all = view::all(table);
+        CHECK(&*begin(*begin(all)) == data);
+        auto first = table | view::take(1);
+        CHECK(&*begin(*begin(first)) == data);
+
+        // Offsets survive moving the table.
+        auto table2 = std::move(table);
+        CHECK(table2.size() == 2u);
+        CHECK(to_<std::string>(table2[1]) == "to defeat the small string optimization");
+
+        // ...and the elements can be moved out of the owned container.
+        std::vector<std::string> strs{"one", "two", "", "three"};
+        std::vector<std::vector<std::string>> pieces =
+            std::move(strs) | action::split(std::string{});
+        CHECK(pieces.size() == 2u);
+        ::check_equal(pieces[0], {"one", "two"});
+        ::check_equal(pieces[1], {"three"});
+    }
+
     return ::test_result();
 }
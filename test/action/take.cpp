@@ -7,10 +7,12 @@
 //  file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <list>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/algorithm/move.hpp>
+#include <range/v3/action/drop.hpp>
 #include <range/v3/action/take.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -39,5 +41,18 @@ int main()
     v |= action::take(0);
     CHECK(v.size() == 0u);
 
+    // drop followed by take erases the tail first, then the front.
+    v = view::ints(1,20);
+    v |= action::drop(3) | action::take(4);
+    ::check_equal(v, {4,5,6,7});
+    v |= action::drop(2) | action::take(100);
+    ::check_equal(v, {6,7});
+    v |= action::drop(5) | action::take(1);
+    CHECK(v.size() == 0u);
+
+    std::list<int> l = view::ints(1,10);
+    l |= action::drop(8) | action::take(5);
+    ::check_equal(l, {9,10});
+
     return ::test_result();
 }
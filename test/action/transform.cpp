@@ -11,13 +11,25 @@
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/zip.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/move.hpp>
 #include <range/v3/algorithm/equal.hpp>
 #include <range/v3/action/transform.hpp>
+#include <range/v3/action/remove_if.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 
+template<typename T>
+struct is_fused_action
+  : std::false_type
+{};
+
+template<typename A, typename B>
+struct is_fused_action<ranges::action::action<ranges::action::fused_action<A, B>>>
+  : std::true_type
+{};
+
 int main()
 {
     using namespace ranges;
@@ -31,5 +43,43 @@ int main()
     action::transform(v, [](int i){return i*i;});
     ::check_equal(v, {0,1,4,9,16,25,36,49,64,81});
 
+    // remove_if and transform next to each other share one pass.
+    {
+        auto odd = [](int i){return i % 2 == 1;};
+        auto neg = [](int i){return -i;};
+        auto rm_tr = action::remove_if(odd) | action::transform(neg);
+        auto tr_rm = action::transform(neg) | action::remove_if([](int i){return i < -20;});
+        auto tr_tr = action::transform(neg) | action::transform(neg);
+        CHECK(!is_fused_action<decltype(rm_tr)>::value);
+        CHECK(!is_fused_action<decltype(tr_rm)>::value);
+        CHECK(is_fused_action<decltype(tr_tr)>::value);
+
+        std::vector<int> w = v;
+        w |= rm_tr;
+        ::check_equal(w, {0,-4,-16,-36,-64});
+        w = v;
+        w |= tr_rm;
+        ::check_equal(w, {0,-1,-4,-9,-16});
+        w = v | copy | tr_tr;
+        ::check_equal(w, v);
+
+        // The same results as the unfused steps, with projections
+        std::vector<std::pair<int, int>> p = view::zip(view::ints(0,9), view::ints(10,19));
+        std::vector<std::pair<int, int>> q = p;
+        p |= action::remove_if(odd, &std::pair<int, int>::first) |
+            action::transform([](int i){return std::make_pair(i, i);}, &std::pair<int, int>::second);
+        q |= action::remove_if(odd, &std::pair<int, int>::first);
+        q |= action::transform([](int i){return std::make_pair(i, i);}, &std::pair<int, int>::second);
+        CHECK(p == q);
+        CHECK(p.size() == 5u);
+        CHECK(p[1].first == 12);
+
+        // Called directly on an lvalue
+        w = v;
+        auto & w2 = rm_tr(w);
+        CHECK(&w2 == &w);
+        ::check_equal(w, {0,-4,-16,-36,-64});
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,109 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy_if.hpp>
+#include <range/v3/execution/algorithm/copy_if.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+struct S
+{
+    int i;
+};
+
+int main()
+{
+    using namespace ranges;
+    auto is_odd = [](int i){ return i % 2 == 1; };
+
+    {
+        int ia[] = {1, 2, 3, 4, 5, 6, 7};
+        int ib[7] = {0};
+        std::pair<input_iterator<const int*>, int*> r =
+            copy_if(input_iterator<const int*>(ia), input_iterator<const int*>(ia + 7), ib,
+                is_odd);
+        CHECK(base(r.first) == ia + 7);
+        CHECK(r.second == ib + 4);
+        ::check_equal(make_range(ib, r.second), {1, 3, 5, 7});
+
+        std::pair<int*, int*> r2 = copy_if(ia, ib, [](int i){ return i > 4; });
+        CHECK(r2.first == ia + 7);
+        ::check_equal(make_range(ib, r2.second), {5, 6, 7});
+    }
+
+    // Check projection
+    {
+        S sa[] = {S{1}, S{2}, S{3}, S{4}};
+        S sb[4] = {};
+        std::pair<S*, S*> r = copy_if(sa, sb, is_odd, &S::i);
+        CHECK(r.second == sb + 2);
+        CHECK(sb[0].i == 1);
+        CHECK(sb[1].i == 3);
+    }
+
+    // Execution policies
+    {
+        std::vector<int> v(100003);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = (int)((i * 7919L) % 1000);
+        std::vector<int> expected;
+        for(int i : v)
+            if(i < 300)
+                expected.push_back(i);
+        auto small = [](int i){ return i < 300; };
+
+        std::vector<int> out(v.size(), -1);
+        auto r = copy_if(execution::par, v, out.begin(), small);
+        CHECK(r.first == v.end());
+        CHECK((r.second - out.begin()) == (std::ptrdiff_t)expected.size());
+        CHECK(std::vector<int>(out.begin(), r.second) == expected);
+        CHECK(*r.second == -1);
+
+        std::vector<int> out2(v.size(), -1);
+        auto r2 = copy_if(execution::seq, v.begin(), v.end(), out2.begin(), small);
+        CHECK(std::vector<int>(out2.begin(), r2.second) == expected);
+
+        // Nothing and everything selected
+        CHECK(copy_if(execution::par, v, out.begin(), [](int){ return false; }).second ==
+            out.begin());
+        CHECK(copy_if(execution::par, v, out.begin(), [](int){ return true; }).second ==
+            out.end());
+        CHECK(out == v);
+
+        // Non-arithmetic elements, a projection, and a view as input
+        std::vector<std::string> strs(50000);
+        for(int i = 0; (std::size_t)i < strs.size(); ++i)
+            strs[i] = std::to_string(i);
+        std::vector<std::string> sout(strs.size());
+        auto r3 = copy_if(execution::par, strs, sout.begin(), is_odd,
+            [](std::string const &s){ return s.back() - '0'; });
+        CHECK((r3.second - sout.begin()) == 25000);
+        CHECK(sout[0] == "1");
+        CHECK(sout[24999] == "49999");
+
+        std::vector<int> iout(100000);
+        auto rng = view::ints(0, 99999) | view::transform([](int i){ return i * 3; });
+        auto r4 = copy_if(execution::par, rng, iout.begin(), is_odd);
+        CHECK((r4.second - iout.begin()) == 50000);
+        CHECK(iout[0] == 3);
+        CHECK(iout[49999] == 299997);
+    }
+
+    return ::test_result();
+}
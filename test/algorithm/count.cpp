@@ -11,6 +11,7 @@
 
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count.hpp>
+#include <range/v3/view/iota.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -57,5 +58,18 @@ int main()
     CHECK(count(make_range(input_iterator<const S*>(sa),
                       sentinel<const S*>(sa)), 2, &S::i) == 0);
 
+    // The integers of an iota are counted in closed form.
+    CHECK(count(view::ints(0, 9), 3) == 1);
+    CHECK(count(view::ints(0, 9), 0) == 1);
+    CHECK(count(view::ints(0, 9), 9) == 1);
+    CHECK(count(view::ints(0, 9), 10) == 0);
+    CHECK(count(view::ints(0, 9), -1) == 0);
+    CHECK(count(view::iota(-5, 5), -5) == 1);
+    CHECK(count(view::ints(-2147483647 - 1, 2147483647), 2147483647) == 1);
+    CHECK(count(view::ints(-2147483647 - 1, 0), 2147483647) == 0);
+    CHECK(count(view::ints(10u, 20u), 5u) == 0);
+    CHECK(count(view::ints(10u, 20u), 15u) == 1);
+    CHECK(count(view::ints(0, 9), 3, [](int i) { return i / 2; }) == 2);
+
     return ::test_result();
 }
@@ -11,6 +11,9 @@
 
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/execution/algorithm/count_if.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -74,5 +77,16 @@ int main()
     CHECK(count_if(make_range(input_iterator<T*>(ta),
                          sentinel<T*>(ta + size(ta))), &T::b) == 4);
 
+    // Execution policies
+    {
+        auto even = [](int i){ return i % 2 == 0; };
+        CHECK(count_if(execution::seq, ia, equals(2)) == 3);
+        CHECK(count_if(execution::par, ia, equals(2)) == 3);
+        CHECK(count_if(execution::par, sa, sa + csa, equals(2), &S::i) == 3);
+        CHECK(count_if(execution::par, view::ints(0, 99999), even) == 50000);
+        CHECK(count_if(execution::par, view::ints(0, 99999) | view::transform(
+            [](int i){ return i / 3; }), even) == 50001);
+    }
+
     return ::test_result();
 }
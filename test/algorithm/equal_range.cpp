@@ -20,6 +20,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <vector>
+#include <utility>
 #include <iterator>
 #include <range/v3/core.hpp>
 #include <range/v3/view/join.hpp>
@@ -77,5 +78,38 @@ int main()
     test<bidirectional_iterator<const int*>, sentinel<const int*> >();
     test<random_access_iterator<const int*>, sentinel<const int*> >();
 
+    // The projection also applies in the searches on either side of the first
+    // match.
+    {
+        using P = std::pair<int, int>;
+        P ps[] = {{0,0}, {1,1}, {1,2}, {1,3}, {1,4}, {2,5}, {3,6}};
+        auto r = ranges::equal_range(ps, 1, ranges::ordered_less(), &P::first);
+        CHECK(r.begin() == ps + 1);
+        CHECK(r.end() == ps + 5);
+        r = ranges::equal_range(ps, ps + 7, 3, ranges::ordered_less(), &P::first);
+        CHECK(r.begin() == ps + 6);
+        CHECK(r.end() == ps + 7);
+        r = ranges::equal_range(ps, 4, ranges::ordered_less(), &P::first);
+        CHECK(r.begin() == ps + 7);
+        CHECK(r.end() == ps + 7);
+    }
+
+    // Searching an infinite range.
+    {
+        using namespace ranges;
+        auto naturals = view::ints(0);
+        auto halves = [](int i) { return i / 2; };
+        auto r = equal_range(naturals, 5, ordered_less(), halves);
+        CHECK(*r.begin() == 10);
+        CHECK(*r.end() == 12);
+        auto squares = view::ints(0LL) | view::transform([](long long i) { return i * i; });
+        auto r2 = equal_range(squares, 1000000007LL);
+        CHECK(r2.begin() == r2.end());
+        CHECK(distance(begin(squares), r2.begin()) == 31623);
+        auto r3 = equal_range(squares, 49LL);
+        CHECK(distance(r3) == 1);
+        CHECK(*r3.begin() == 49LL);
+    }
+
     return ::test_result();
 }
@@ -9,9 +9,14 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <atomic>
 #include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/execution/algorithm/for_each.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
 #include "../simple_test.hpp"
 
 struct S
@@ -42,5 +47,34 @@ int main()
     CHECK(ranges::for_each(v2, &S::p) == v2.end());
     CHECK(sum == 24);
 
+    // Execution policies
+    {
+        std::atomic<long> total{0};
+        auto afun = [&](int i){total += i; };
+        CHECK(ranges::for_each(ranges::execution::seq, v1, afun) == v1.end());
+        CHECK(total == 12);
+
+        total = 0;
+        std::vector<int> big(100000);
+        CHECK(ranges::for_each(ranges::execution::par, big,
+            [](int &i){i = 1; }) == big.end());
+        CHECK(ranges::for_each(ranges::execution::par, big.begin(), big.end(), afun) == big.end());
+        CHECK(total == 100000);
+
+        total = 0;
+        auto rng = ranges::view::ints(0, 99999) | ranges::view::transform([](int i){return 2 * i; });
+        ranges::for_each(ranges::execution::par, rng, afun);
+        CHECK(total == 99999L * 100000L);
+
+        total = 0;
+        std::vector<int> idx(100000);
+        for(int j = 0; j < 100000; ++j)
+            idx[j] = j;
+        auto zipped = ranges::view::zip(big, idx);
+        ranges::for_each(ranges::execution::par, zipped,
+            [&](std::pair<int, int> p){total += p.first * p.second; });
+        CHECK(total == 99999L * 100000L / 2);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,164 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/any_of.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/count_if.hpp>
+#include <range/v3/algorithm/find_if.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include <range/v3/algorithm/for_each_while.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/view/concat.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/join.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return (i % 2) == 1;
+    }
+};
+
+// Collects the elements it is called with, and stops after the first one
+// equal to last.
+struct collect
+{
+    std::vector<int> *seen;
+    int last;
+    bool operator()(int i) const
+    {
+        seen->push_back(i);
+        return i != last;
+    }
+};
+
+template<typename Rng>
+void check_push(Rng &rng, std::vector<int> const &all)
+{
+    CONCEPT_ASSERT(ranges::detail::has_for_each_while<Rng>());
+    std::vector<int> seen;
+    auto it = ranges::for_each_while(rng, collect{&seen, -1});
+    ::check_equal(seen, all);
+    CHECK(it == ranges::end(rng));
+
+    // Stopping early leaves an iterator to the element it stopped at, from
+    // which the range can be iterated on.
+    for(std::size_t n = 0; n != all.size(); ++n)
+    {
+        seen.clear();
+        auto pos = ranges::for_each_while(rng, collect{&seen, all[n]});
+        ::check_equal(seen, std::vector<int>(all.begin(), all.begin() + (long)n + 1));
+        CHECK(*pos == all[n]);
+        std::vector<int> rest;
+        for(; pos != ranges::end(rng); ++pos)
+            rest.push_back(*pos);
+        ::check_equal(rest, std::vector<int>(all.begin() + (long)n, all.end()));
+    }
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Ranges without the member are iterated.
+    {
+        int rgi[] = {1, 2, 3, 4};
+        CONCEPT_ASSERT(!detail::has_for_each_while<int[4]>());
+        std::vector<int> seen;
+        auto it = for_each_while(rgi, collect{&seen, 3});
+        CHECK(it == rgi + 2);
+        ::check_equal(seen, {1, 2, 3});
+        auto ints = view::iota(0) | view::take(5);
+        CONCEPT_ASSERT(!detail::has_for_each_while<decltype(ints)>());
+        CHECK(accumulate(ints, 0) == 10);
+    }
+
+    std::vector<int> v{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    std::vector<std::vector<int>> vv{{}, {1, 2}, {}, {3}, {4, 5, 6}, {}};
+
+    auto twice = v | view::transform([](int i) { return i * 2; });
+    check_push(twice, {2, 4, 6, 8, 10, 12, 14, 16, 18, 20});
+
+    auto odds = v | view::remove_if([](int i) { return i % 2 == 0; });
+    check_push(odds, {1, 3, 5, 7, 9});
+
+    auto pipe = v | view::transform([](int i) { return i * 3; })
+                  | view::remove_if(is_odd());
+    check_push(pipe, {6, 12, 18, 24, 30});
+
+    auto joined = vv | view::join;
+    check_push(joined, {1, 2, 3, 4, 5, 6});
+
+    auto joined_pipe = vv | view::join | view::transform([](int i) { return i + 1; })
+                          | view::remove_if(is_odd());
+    check_push(joined_pipe, {2, 4, 6});
+
+    std::vector<int> empty, w{7, 8, 9};
+    auto cat = view::concat(empty, vv[1], empty, w, vv[4]);
+    check_push(cat, {1, 2, 7, 8, 9, 4, 5, 6});
+
+    auto const ccat = view::concat(vv[1], vv[4]);
+    check_push(ccat, {1, 2, 4, 5, 6});
+
+    // Elements are passed by reference, as the view's reference type.
+    {
+        for_each(joined, [](int &i) { i *= 10; });
+        ::check_equal(vv[4], {40, 50, 60});
+        for_each(joined, [](int &i) { i /= 10; });
+        std::vector<int *> addrs;
+        for_each_while(cat, [&](int &i) { addrs.push_back(&i); return true; });
+        CHECK(addrs.front() == &vv[1][0]);
+        CHECK(addrs.back() == &vv[4][2]);
+    }
+
+    // Predicates and functions with state, called once per element, in order.
+    {
+        bool flag = true;
+        auto every_other = v | view::remove_if([flag](int) mutable { return flag = !flag; });
+        check_push(every_other, {1, 3, 5, 7, 9});
+        int calls = 0;
+        auto counted = v | view::transform([&calls](int i) { ++calls; return i; });
+        CHECK(count_if(counted, is_odd()) == 5);
+        CHECK(calls == 10);
+    }
+
+    // The algorithms give the results they give by iterating.
+    {
+        CHECK(accumulate(pipe, 0) == 90);
+        CHECK(accumulate(joined_pipe, 1, [](int a, int b) { return a * b; }) == 48);
+        CHECK(count_if(cat, is_odd()) == 4);
+        CHECK(count_if(joined, is_odd(), [](int i) { return i + 1; }) == 3);
+        CHECK(any_of(joined, [](int i) { return i == 5; }));
+        CHECK(!any_of(pipe, is_odd()));
+        auto it = find_if(cat, [](int i) { return i > 7; });
+        CHECK(it != end(cat));
+        CHECK(*it == 8);
+        CHECK(*next(it) == 9);
+        CHECK(find_if(joined_pipe, [](int i) { return i > 6; }) == end(joined_pipe));
+        std::vector<int> out;
+        auto res = copy(joined_pipe, ranges::back_inserter(out));
+        CHECK(res.first == end(joined_pipe));
+        ::check_equal(out, {2, 4, 6});
+        int sum = 0;
+        CHECK(for_each(twice, [&](int i) { sum += i; }) == end(twice));
+        CHECK(sum == 110);
+    }
+
+    return test_result();
+}
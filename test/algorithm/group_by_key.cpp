@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/group_by_key.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/utility/functional.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct sale
+{
+    std::string region;
+    int amount;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<sale> sales{{"north", 10}, {"south", 5}, {"north", 7}, {"east", 1},
+        {"south", 2}, {"north", 3}};
+
+    {
+        // Keys come out in the order they were first seen.
+        auto by_region = group_by_key(sales, &sale::region,
+            [](sale s, sale const &t) { s.amount += t.amount; return s; });
+        CHECK(by_region.size() == 3u);
+        CHECK(by_region[0].first == "north");
+        CHECK(by_region[0].second.amount == 20);
+        CHECK(by_region[1].first == "south");
+        CHECK(by_region[1].second.amount == 7);
+        CHECK(by_region[2].first == "east");
+        CHECK(by_region[2].second.amount == 1);
+    }
+
+    {
+        auto totals = group_by_key(sales, &sale::region, 0,
+            [](int n, sale const &s) { return n + s.amount; });
+        using expected_t = std::vector<std::pair<std::string, int>>;
+        CONCEPT_ASSERT(Same<decltype(totals), expected_t>());
+        CHECK((totals == expected_t{{"north", 20}, {"south", 7}, {"east", 1}}));
+
+        auto counts = group_by_key(sales, &sale::region, 0,
+            [](int n, sale const &) { return n + 1; }, std::hash<std::string>{});
+        CHECK((counts == expected_t{{"north", 3}, {"south", 2}, {"east", 1}}));
+    }
+
+    {
+        auto mod3 = [](int i) { return i % 3; };
+        auto sums = group_by_key(view::ints(1, 10), mod3, plus{});
+        using expected_t = std::vector<std::pair<int, int>>;
+        CHECK((sums == expected_t{{1, 22}, {2, 15}, {0, 18}}));
+
+        auto maxes = group_by_key(view::ints(1, 10), mod3,
+            [](int a, int b) { return a < b ? b : a; }, std::hash<int>{});
+        CHECK((maxes == expected_t{{1, 10}, {2, 8}, {0, 9}}));
+    }
+
+    {
+        std::vector<int> empty;
+        CHECK(group_by_key(empty, ident{}, plus{}).empty());
+    }
+
+    {
+        // Many keys force the index to grow several times.
+        auto groups = group_by_key(view::ints(0, 9999), [](int i) { return i / 2; }, plus{});
+        CHECK(groups.size() == 5000u);
+        CHECK(groups[0].first == 0);
+        CHECK(groups[0].second == 1);
+        CHECK(groups[4999].first == 4999);
+        CHECK(groups[4999].second == (9998 + 9999));
+    }
+
+    return ::test_result();
+}
@@ -16,6 +16,8 @@
 #include <utility>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include "../simple_test.hpp"
 
 int main()
@@ -45,5 +47,33 @@ int main()
     CHECK(ranges::lower_bound(a, 1, less(), &std::pair<int, int>::first) == &a[2]);
     CHECK(ranges::lower_bound(c, 1, less(), &std::pair<int, int>::first) == &c[2]);
 
+    // Searching a monotone function of an iota, bounded and not.
+    {
+        using namespace ranges;
+        int calls = 0;
+        auto square = [&calls](long long i) { ++calls; return i * i; };
+        auto squares = view::ints(0LL, 1000000LL) | view::transform(square);
+        auto it = lower_bound(squares, 1000000007LL);
+        CHECK(*it == 31623LL * 31623LL);
+        CHECK(calls < 50);
+
+        calls = 0;
+        auto all_squares = view::ints(0LL) | view::transform(square);
+        CHECK(*lower_bound(all_squares, 0LL) == 0LL);
+        CHECK(*lower_bound(all_squares, 1LL) == 1LL);
+        CHECK(*lower_bound(all_squares, 2LL) == 4LL);
+        for(long long i = 0; i != 100; ++i)
+            CHECK(distance(begin(all_squares), lower_bound(all_squares, i * i)) == i);
+        calls = 0;
+        auto it2 = lower_bound(all_squares, 1000000007LL);
+        CHECK(distance(begin(all_squares), it2) == 31623);
+        CHECK(calls < 70);
+        auto from_seven = view::ints(7LL) | view::transform(square);
+        CHECK(*lower_bound(from_seven, 10LL, less()) == 49LL);
+        CHECK(*lower_bound(from_seven, 50LL, less()) == 64LL);
+        auto naturals = view::ints(0);
+        CHECK(*lower_bound(naturals, 5, less(), [](int i) { return i / 2; }) == 10);
+    }
+
     return test_result();
 }
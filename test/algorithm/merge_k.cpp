@@ -0,0 +1,87 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <random>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/merge_k.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<std::vector<int>> runs{{1, 4, 7}, {2, 5, 8, 10, 11}, {}, {0, 3, 6, 9}};
+        std::vector<int> out;
+        merge_k(runs, ranges::back_inserter(out));
+        ::check_equal(out, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+
+        int buf[12];
+        int *end = merge_k(runs, buf);
+        CHECK((end - buf) == 12);
+        ::check_equal(buf, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    }
+
+    {
+        // No ranges, one range, and only empty ranges.
+        std::vector<std::vector<int>> none, one{{1, 2, 3}}, empties(3);
+        std::vector<int> out;
+        merge_k(none, ranges::back_inserter(out));
+        merge_k(empties, ranges::back_inserter(out));
+        CHECK(out.empty());
+        merge_k(one, ranges::back_inserter(out));
+        ::check_equal(out, {1, 2, 3});
+    }
+
+    {
+        // Stable: equivalent elements come in the order of their ranges. The
+        // ranges need only be input ranges, and can be sorted in another order.
+        using P = std::pair<int, char>;
+        std::vector<std::list<P>> runs{
+            {{3, 'a'}, {2, 'a'}, {1, 'a'}},
+            {{3, 'b'}, {1, 'b'}},
+            {{2, 'c'}, {1, 'c'}, {0, 'c'}}};
+        std::vector<P> out;
+        merge_k(runs, ranges::back_inserter(out), std::greater<int>{}, &P::first);
+        ::check_equal(out, {P{3, 'a'}, P{3, 'b'}, P{2, 'a'}, P{2, 'c'}, P{1, 'a'}, P{1, 'b'},
+            P{1, 'c'}, P{0, 'c'}});
+    }
+
+    {
+        // Many runs of uneven length, checked against sorting.
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> value(0, 999), length(0, 40);
+        std::vector<std::vector<int>> runs(37);
+        std::vector<int> expected;
+        for(auto &run : runs)
+        {
+            run.resize(static_cast<std::size_t>(length(gen)));
+            for(auto &i : run)
+                i = value(gen);
+            sort(run);
+            expected.insert(expected.end(), run.begin(), run.end());
+        }
+        sort(expected);
+        std::vector<int> out;
+        merge_k(runs, ranges::back_inserter(out));
+        CHECK(out == expected);
+    }
+
+    return ::test_result();
+}
@@ -23,9 +23,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
+#include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition.hpp>
+#include <range/v3/execution/algorithm/partition.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -204,5 +207,46 @@ int main()
     for (S* i = r; i < ia+sa; ++i)
         CHECK(!is_odd()(i->i));
 
+    // Execution policies
+    {
+        std::vector<int> v(200003);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = (int)((i * 7919L) % 1000);
+        std::vector<int> sorted = v;
+        std::sort(sorted.begin(), sorted.end());
+        auto check = [&](std::vector<int> const &w, std::vector<int>::const_iterator r,
+            std::ptrdiff_t expected)
+        {
+            bool ok = (r - w.begin()) == expected;
+            for(auto i = w.begin(); i != w.end(); ++i)
+                ok = ok && (is_odd()(*i) == (i < r));
+            std::vector<int> u = w;
+            std::sort(u.begin(), u.end());
+            return ok && u == sorted;
+        };
+        std::vector<int> w = v;
+        auto r = ranges::partition(ranges::execution::par, w, is_odd());
+        CHECK(check(w, r, 100001));
+
+        w = v;
+        r = ranges::partition(ranges::execution::par, w.begin(), w.end(), is_odd());
+        CHECK(check(w, r, 100001));
+
+        w = v;
+        r = ranges::partition(ranges::execution::seq, w, is_odd());
+        CHECK(check(w, r, 100001));
+
+        std::vector<S> sv(100000);
+        for(int i = 0; (std::size_t)i < sv.size(); ++i)
+            sv[i].i = i;
+        auto sr = ranges::partition(ranges::execution::par, sv, [](int i){ return i >= 500; },
+            &S::i);
+        CHECK((sr - sv.begin()) == 99500);
+        bool ok = true;
+        for(auto i = sv.begin(); i != sv.end(); ++i)
+            ok = ok && ((i->i >= 500) == (i < sr));
+        CHECK(ok);
+    }
+
     return ::test_result();
 }
@@ -23,8 +23,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <tuple>
+#include <vector>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/partition_copy.hpp>
+#include <range/v3/execution/algorithm/partition_copy.hpp>
 #include <range/v3/view/counted.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -119,5 +121,32 @@ int main()
 
     test_proj();
 
+    // Execution policies
+    {
+        std::vector<int> v(100001);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = i;
+        std::vector<int> odd(v.size(), -1), even(v.size(), -1);
+        auto r = ranges::partition_copy(ranges::execution::par, v, odd.begin(), even.begin(),
+            is_odd());
+        CHECK(std::get<0>(r) == v.end());
+        CHECK((std::get<1>(r) - odd.begin()) == 50000);
+        CHECK((std::get<2>(r) - even.begin()) == 50001);
+        bool ok = true;
+        for(int i = 0; i < 50000; ++i)
+            ok = ok && odd[i] == 2 * i + 1 && even[i] == 2 * i;
+        CHECK(ok);
+        CHECK(even[50000] == 100000);
+        CHECK(odd[50000] == -1);
+
+        S sa[] = {S{1}, S{2}, S{3}, S{4}, S{5}, S{6}, S{7}, S{8}};
+        S r1[8] = {S{0}}, r2[8] = {S{0}};
+        auto rs = ranges::partition_copy(ranges::execution::par, sa, r1, r2, is_odd(), &S::i);
+        CHECK(std::get<1>(rs) == r1 + 4);
+        CHECK(std::get<2>(rs) == r2 + 4);
+        CHECK(r1[3].i == 7);
+        CHECK(r2[0].i == 2);
+    }
+
     return ::test_result();
 }
@@ -23,10 +23,13 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/remove_copy_if.hpp>
+#include <range/v3/execution/algorithm/remove_copy_if.hpp>
+#include <range/v3/algorithm/find.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -152,5 +155,28 @@ int main()
         CHECK(ib[5].i == 4);
     }
 
+    // Execution policies
+    {
+        std::vector<int> v(100000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = i % 7;
+        std::vector<int> out(v.size());
+        auto is_two = [](int i){ return i == 2; };
+        auto r = ranges::remove_copy_if(ranges::execution::par, v, out.begin(), is_two);
+        CHECK(r.first == v.end());
+        CHECK((r.second - out.begin()) == 100000 - 14286);
+        CHECK(ranges::find(out.begin(), r.second, 2) == r.second);
+        CHECK(out[0] == 0);
+        CHECK(out[2] == 3);
+        CHECK(out[6] == 0);
+
+        S sa[] = {S{0}, S{1}, S{2}, S{3}, S{4}, S{2}, S{3}, S{4}, S{2}};
+        S sb[9];
+        std::pair<S*, S*> rs = ranges::remove_copy_if(ranges::execution::par, sa, sb,
+            [](int i){return i == 2;}, &S::i);
+        CHECK(rs.second == sb + 6);
+        CHECK(sb[2].i == 3);
+    }
+
     return ::test_result();
 }
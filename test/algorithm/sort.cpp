@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/sort.hpp>
+#include <range/v3/execution/algorithm/sort.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/view/for_each.hpp>
 #include <range/v3/view/iota.hpp>
@@ -227,6 +228,43 @@ struct Int
     }
 };
 
+struct counting_less
+{
+    long *count;
+    bool operator()(int a, int b) const
+    {
+        ++*count;
+        return a < b;
+    }
+};
+
+// Sorting takes a small multiple of n log n comparisons, on random input and on
+// inputs that trip up poor choices of pivot. A partition that goes wrong takes
+// many more before the depth limit hands the range to heapsort.
+void test_comparisons()
+{
+    constexpr int N = 1 << 14;
+    constexpr long max_comparisons = 3L * N * 14;
+    std::vector<std::vector<int>> inputs(5, std::vector<int>(N));
+    unsigned r = 1;
+    for(int i = 0; i < N; ++i)
+    {
+        r = r * 1103515245u + 12345u;
+        inputs[0][i] = (int)((r >> 8) % N);
+        inputs[1][i] = i;
+        inputs[2][i] = N - i;
+        inputs[3][i] = i < N / 2 ? i : N - i;
+        inputs[4][i] = i % 16;
+    }
+    for(auto &v : inputs)
+    {
+        long count = 0;
+        ranges::sort(v, counting_less{&count});
+        CHECK(std::is_sorted(v.begin(), v.end()));
+        CHECK(count < max_comparisons);
+    }
+}
+
 int main()
 {
     // test null range
@@ -253,6 +291,8 @@ int main()
     test_larger_sorts(1000);
     test_larger_sorts(1009);
 
+    test_comparisons();
+
     // Check move-only types
     {
         std::vector<std::unique_ptr<int> > v(1000);
@@ -303,5 +343,38 @@ int main()
         sort(rng);
     }
 
+    // Execution policies
+    {
+        std::vector<int> v(200000);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = (int)((i * 7919L) % 1000);
+        std::vector<int> w = v;
+        std::sort(w.begin(), w.end());
+        std::vector<int> u = v;
+        CHECK(ranges::sort(ranges::execution::par, v) == v.end());
+        CHECK(v == w);
+        CHECK(ranges::sort(ranges::execution::seq, u.begin(), u.end()) == u.end());
+        CHECK(u == w);
+
+        // Already sorted and reverse-sorted input, with a comparison and projection
+        std::vector<S> vs(100000, S{});
+        for(int i = 0; (std::size_t)i < vs.size(); ++i)
+            vs[i].i = vs.size() - i - 1;
+        ranges::sort(ranges::execution::par, vs, std::less<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < vs.size(); ++i)
+            CHECK(vs[i].i == i);
+        ranges::sort(ranges::execution::par_unseq, vs, std::greater<int>{}, &S::i);
+        for(int i = 0; (std::size_t)i < vs.size(); ++i)
+            CHECK((std::size_t)vs[i].i == vs.size() - i - 1);
+
+        // Move-only types
+        std::vector<std::unique_ptr<int> > vp(100000);
+        for(int i = 0; (std::size_t)i < vp.size(); ++i)
+            vp[i].reset(new int(vp.size() - i - 1));
+        ranges::sort(ranges::execution::par, vp, indirect_less());
+        for(int i = 0; (std::size_t)i < vp.size(); ++i)
+            CHECK(*vp[i] == i);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,126 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sort_by_key.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/container/soa_vector.hpp>
+#include <range/v3/view/reverse.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct person
+{
+    std::string name;
+    int age;
+};
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<int> keys{3, 1, 2, 1, 0};
+        std::vector<std::string> names{"d", "b", "c", "b2", "a"};
+        std::vector<double> weights{3.0, 1.0, 2.0, 1.5, 0.0};
+        auto perm = sort_by_key(keys, names, weights);
+        // Equal keys keep their order.
+        ::check_equal(perm, {4u, 1u, 3u, 2u, 0u});
+        ::check_equal(keys, {0, 1, 1, 2, 3});
+        ::check_equal(names, {"a", "b", "b2", "c", "d"});
+        ::check_equal(weights, {0.0, 1.0, 1.5, 2.0, 3.0});
+
+        // The permutation reorders further parallel ranges the same way.
+        std::vector<char> tags{'D', 'B', 'C', 'E', 'A'};
+        auto end = apply_permutation(tags, perm);
+        CHECK(end == tags.end());
+        ::check_equal(tags, {'A', 'B', 'E', 'C', 'D'});
+    }
+
+    {
+        // sort_permutation leaves the range as it is.
+        std::vector<person> people{{"carol", 35}, {"alice", 30}, {"bob", 30}, {"dave", 20}};
+        auto perm = sort_permutation(people, std::greater<int>{}, &person::age);
+        ::check_equal(perm, {0u, 1u, 2u, 3u});
+        perm = sort_permutation(people, ordered_less{}, &person::age);
+        ::check_equal(perm, {3u, 1u, 2u, 0u});
+        CHECK(people[0].name == "carol");
+        apply_permutation(people, perm);
+        CHECK(people[0].name == "dave");
+        CHECK(people[1].name == "alice");
+        CHECK(people[2].name == "bob");
+        CHECK(people[3].name == "carol");
+
+        // Any input range can be the source of the keys.
+        std::vector<int> ages{10, 20, 30, 40};
+        ::check_equal(sort_permutation(ages | view::reverse), {3u, 2u, 1u, 0u});
+    }
+
+    {
+        // Move-only values, and the columns of a soa_vector.
+        std::vector<int> keys{2, 0, 1};
+        std::vector<std::unique_ptr<int>> ptrs;
+        for(int k : keys)
+            ptrs.emplace_back(new int(k));
+        soa_vector<int, std::string> soa{{20, "two"}, {0, "zero"}, {10, "one"}};
+        sort_by_key(keys, ptrs, soa.column<0>(), soa.column<1>());
+        ::check_equal(keys, {0, 1, 2});
+        CHECK(*ptrs[0] == 0);
+        CHECK(*ptrs[1] == 1);
+        CHECK(*ptrs[2] == 2);
+        ::check_equal(soa.column<0>(), {0, 10, 20});
+        ::check_equal(soa.column<1>(), {"zero", "one", "two"});
+    }
+
+    {
+        // Signed keys, and keys wider than a byte.
+        std::vector<long long> keys{-1, 5, -7, 0, (1LL << 40), -(1LL << 40)};
+        std::vector<int> index{0, 1, 2, 3, 4, 5};
+        sort_by_key(keys, index);
+        ::check_equal(keys, {-(1LL << 40), -7LL, -1LL, 0LL, 5LL, (1LL << 40)});
+        ::check_equal(index, {5, 2, 0, 3, 1, 4});
+        std::vector<char> chars{'c', 'a', 'b'};
+        ::check_equal(sort_permutation(chars), {1u, 2u, 0u});
+    }
+
+    {
+        std::vector<int> keys;
+        CHECK(sort_by_key(keys).empty());
+        CHECK(sort_permutation(keys).empty());
+    }
+
+    {
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 99);
+        std::vector<int> keys(1000), index(1000);
+        for(int i = 0; i != 1000; ++i)
+        {
+            keys[static_cast<std::size_t>(i)] = dist(gen);
+            index[static_cast<std::size_t>(i)] = i;
+        }
+        auto const original = keys;
+        sort_by_key(keys, index);
+        CHECK(is_sorted(keys));
+        for(std::size_t i = 0; i != 1000; ++i)
+        {
+            CHECK(original[static_cast<std::size_t>(index[i])] == keys[i]);
+            if(i != 0 && keys[i - 1] == keys[i])
+                CHECK(index[i - 1] < index[i]);
+        }
+    }
+
+    return ::test_result();
+}
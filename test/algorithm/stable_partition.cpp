@@ -23,9 +23,11 @@
 //===----------------------------------------------------------------------===//
 
 #include <memory>
+#include <vector>
 #include <utility>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/stable_partition.hpp>
+#include <range/v3/execution/algorithm/stable_partition.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
 #include "../test_iterators.hpp"
@@ -414,5 +416,56 @@ int main()
         CHECK(ap[9].p == P{4, 2});
     }
 
+    // Execution policies
+    {
+        // Values are (key, original position); stability means positions stay
+        // increasing within each part.
+        std::vector<P> v(200001);
+        for(int i = 0; (std::size_t)i < v.size(); ++i)
+            v[i] = P{(int)((i * 7919L) % 1000), i};
+        auto check = [](std::vector<P> const &w, std::vector<P>::const_iterator r,
+            bool expect_odd)
+        {
+            bool ok = true;
+            for(auto i = w.begin(); i != w.end(); ++i)
+            {
+                ok = ok && (odd_first()(*i) == ((i < r) == expect_odd));
+                if(i != w.begin() && i != r)
+                    ok = ok && (i - 1)->second < i->second;
+            }
+            return ok;
+        };
+        std::vector<P> w = v;
+        auto r = ranges::stable_partition(ranges::execution::par, w, odd_first());
+        CHECK((r - w.begin()) == 100000);
+        CHECK(check(w, r, true));
+
+        w = v;
+        r = ranges::stable_partition(ranges::execution::par, w.begin(), w.end(),
+            [](int i){ return i < 10; }, &P::first);
+        CHECK((r - w.begin()) == 2001);
+        bool ok = true;
+        for(auto i = w.begin(); i != w.end(); ++i)
+        {
+            ok = ok && ((i->first < 10) == (i < r));
+            if(i != w.begin() && i != r)
+                ok = ok && (i - 1)->second < i->second;
+        }
+        CHECK(ok);
+
+        w = v;
+        r = ranges::stable_partition(ranges::execution::seq, w, odd_first());
+        CHECK(check(w, r, true));
+
+        // All and none satisfying
+        w = v;
+        CHECK(ranges::stable_partition(ranges::execution::par, w, [](P){ return true; }) ==
+            w.end());
+        CHECK(w == v);
+        CHECK(ranges::stable_partition(ranges::execution::par, w, [](P){ return false; }) ==
+            w.begin());
+        CHECK(w == v);
+    }
+
     return ::test_result();
 }
@@ -18,9 +18,14 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <vector>
 #include <functional>
 #include <range/v3/core.hpp>
 #include <range/v3/algorithm/transform.hpp>
+#include <range/v3/execution/algorithm/transform.hpp>
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/view/unbounded.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
@@ -369,5 +374,40 @@ int main()
     static_assert(std::is_same<std::tuple<S const*, S const *, int*>,
         decltype(ranges::transform(s, s, p, binary, &S::i, &S::i))>::value, "");
 
+    // Execution policies
+    {
+        std::vector<int> a = ranges::view::ints(0, 99999);
+        std::vector<int> b = ranges::view::ints(0, 99999) | ranges::view::transform(unary);
+        std::vector<int> out(100000);
+
+        auto r1 = ranges::transform(ranges::execution::par, a, out.begin(), unary);
+        CHECK(r1.first == a.end());
+        CHECK(r1.second == out.end());
+        CHECK(ranges::equal(out, b));
+
+        auto rng = ranges::view::ints(0, 99999) | ranges::view::transform(unary);
+        std::vector<int> out2(100000);
+        ranges::transform(ranges::execution::par, rng, out2.begin(), unary);
+        CHECK(ranges::equal(out2, ranges::view::ints(2, 100001)));
+
+        std::vector<int> out3(100000);
+        auto r3 = ranges::transform(ranges::execution::par, a, b, out3.begin(), binary);
+        CHECK(std::get<0>(r3) == a.end());
+        CHECK(std::get<1>(r3) == b.end());
+        CHECK(std::get<2>(r3) == out3.end());
+        CHECK(ranges::equal(out3, ranges::view::ints(0, 99999) |
+            ranges::view::transform([](int i){return 2 * i + 1; })));
+
+        // Mismatched lengths stop at the shorter input.
+        std::vector<int> out4(4, 0);
+        auto r4 = ranges::transform(ranges::execution::par, s, i, out4.begin(), binary, &S::i);
+        CHECK(std::get<2>(r4) == out4.end());
+        CHECK(ranges::equal(out4, {2, 4, 6, 8}));
+
+        std::vector<int> out5(4, 0);
+        ranges::transform(ranges::execution::seq, s, out5.begin(), unary, &S::i);
+        CHECK(ranges::equal(out5, {2, 3, 4, 5}));
+    }
+
     return ::test_result();
 }
@@ -15,6 +15,8 @@
 
 #include <utility>
 #include <range/v3/core.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include <range/v3/algorithm/upper_bound.hpp>
 #include "../simple_test.hpp"
 
@@ -45,5 +47,17 @@ int main()
     CHECK(ranges::upper_bound(a, 1, less(), &std::pair<int, int>::first) == &a[4]);
     CHECK(ranges::upper_bound(c, 1, less(), &std::pair<int, int>::first) == &c[4]);
 
+    // Searching an infinite range.
+    {
+        using namespace ranges;
+        auto squares = view::ints(0LL) | view::transform([](long long i) { return i * i; });
+        CHECK(*upper_bound(squares, 0LL) == 1LL);
+        CHECK(*upper_bound(squares, 4LL) == 9LL);
+        CHECK(*upper_bound(squares, 5LL) == 9LL);
+        CHECK(distance(begin(squares), upper_bound(squares, 1000000007LL)) == 31623);
+        auto naturals = view::ints(0);
+        CHECK(*upper_bound(naturals, 5, less(), [](int i) { return i / 2; }) == 12);
+    }
+
     return test_result();
 }
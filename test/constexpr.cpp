@@ -0,0 +1,143 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+// Built as C++14. Every check here is a static_assert, so that this compiles
+// only if the algorithms and views it uses can be evaluated at compile time.
+
+#include <cstdint>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/fill.hpp>
+#include <range/v3/algorithm/find.hpp>
+#include <range/v3/algorithm/is_sorted.hpp>
+#include <range/v3/algorithm/lower_bound.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/transform.hpp>
+#include <range/v3/algorithm/upper_bound.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/numeric/iota.hpp>
+#include <range/v3/view/iota.hpp>
+#include "./simple_test.hpp"
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304
+
+template<typename T, std::size_t N>
+struct table
+{
+    T data[N];
+};
+
+// The CRC-32 of one byte.
+struct crc32_byte
+{
+    constexpr std::uint32_t operator()(std::uint32_t c) const
+    {
+        for(int k = 0; k < 8; ++k)
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        return c;
+    }
+};
+
+// Lambdas cannot be called at compile time before C++17.
+struct negate
+{
+    constexpr int operator()(int i) const
+    {
+        return -i;
+    }
+};
+
+struct square
+{
+    constexpr int operator()(int i) const
+    {
+        return i * i;
+    }
+};
+
+constexpr table<std::uint32_t, 256> make_crc32_table()
+{
+    table<std::uint32_t, 256> t{};
+    auto bytes = ranges::view::ints(0u, 255u);
+    ranges::transform(bytes, t.data, crc32_byte{});
+    return t;
+}
+
+constexpr auto crc32_table = make_crc32_table();
+static_assert(crc32_table.data[0] == 0u, "");
+static_assert(crc32_table.data[1] == 0x77073096u, "");
+static_assert(crc32_table.data[255] == 0x2D02EF8Du, "");
+
+constexpr table<int, 10> make_sorted()
+{
+    table<int, 10> t{{5, 3, 9, 1, 7, 0, 8, 2, 6, 4}};
+    ranges::sort(t.data);
+    return t;
+}
+
+constexpr auto sorted = make_sorted();
+static_assert(sorted.data[0] == 0 && sorted.data[5] == 5 && sorted.data[9] == 9, "");
+
+constexpr bool sort_large()
+{
+    // Enough elements to go through the partitioning, not just insertion sort.
+    int a[100] = {};
+    for(int i = 0; i < 100; ++i)
+        a[i] = (i * 37) % 100;
+    ranges::sort(a, ranges::ordered_less{}, negate{});
+    return ranges::is_sorted(a, ranges::ordered_less{}, negate{}) &&
+        a[0] == 99 && a[99] == 0;
+}
+static_assert(sort_large(), "");
+
+constexpr int sum_of_squares(int n)
+{
+    return ranges::accumulate(ranges::view::ints(1, n), 0, ranges::plus{}, square{});
+}
+static_assert(sum_of_squares(10) == 385, "");
+static_assert(ranges::accumulate(ranges::view::ints(1, 100), 0) == 5050, "");
+
+constexpr table<int, 8> make_filled()
+{
+    table<int, 8> t{};
+    ranges::fill(t.data, 7);
+    ranges::iota(t.data + 4, t.data + 8, 1);
+    int u[2] = {-1, -2};
+    ranges::copy(u, t.data + 1);
+    return t;
+}
+
+constexpr auto filled = make_filled();
+static_assert(filled.data[0] == 7 && filled.data[1] == -1 && filled.data[2] == -2, "");
+static_assert(filled.data[3] == 7 && filled.data[4] == 1 && filled.data[7] == 4, "");
+
+constexpr std::ptrdiff_t position(int v)
+{
+    return ranges::lower_bound(sorted.data, v) - sorted.data;
+}
+static_assert(position(0) == 0 && position(4) == 4 && position(10) == 10, "");
+static_assert(ranges::upper_bound(sorted.data, 4) - sorted.data == 5, "");
+static_assert(ranges::find(sorted.data, 6) == sorted.data + 6, "");
+
+constexpr int first_square_from(int v)
+{
+    auto roots = ranges::view::iota(0, 1000);
+    return *ranges::lower_bound(roots, v, ranges::ordered_less{}, square{});
+}
+static_assert(first_square_from(500) == 23, "");
+static_assert(first_square_from(529) == 23, "");
+
+#endif
+
+int main()
+{
+    return ::test_result();
+}
@@ -0,0 +1,126 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/container/flat_hash_map.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    ::models<concepts::Container>(flat_hash_map<int, int>{});
+    ::models<concepts::ForwardIterable>(flat_hash_map<int, int>{});
+    CONCEPT_ASSERT(Same<range_value_t<flat_hash_map<int, int>>, std::pair<int const, int>>());
+
+    {
+        flat_hash_map<std::string, int> m;
+        ++m["a"];
+        ++m["b"];
+        ++m["a"];
+        CHECK(m.size() == 2u);
+        CHECK(m["a"] == 2);
+        CHECK(m.at("b") == 1);
+        bool threw = false;
+        try
+        {
+            m.at("c");
+        }
+        catch(std::out_of_range const &)
+        {
+            threw = true;
+        }
+        CHECK(threw);
+        CHECK(m.find("c") == m.end());
+        CHECK(m.find("a")->second == 2);
+        m.find("a")->second = 5;
+        CHECK(m["a"] == 5);
+
+        auto p = m.try_emplace("a", 7);
+        CHECK(!p.second);
+        CHECK(p.first->second == 5);
+        p = m.insert_or_assign("a", 7);
+        CHECK(!p.second);
+        CHECK(m["a"] == 7);
+        p = m.insert_or_assign("c", 3);
+        CHECK(p.second);
+        CHECK(m.size() == 3u);
+        CHECK(m.insert({"c", 4}).second == false);
+        CHECK(m.emplace("d", 4).second);
+        CHECK(m.erase("a") == 1u);
+        CHECK(m.size() == 3u);
+
+        flat_hash_map<std::string, int> const &cm = m;
+        CHECK(cm.at("d") == 4);
+        int sum = 0;
+        for(auto const &kv : cm)
+            sum += kv.second;
+        CHECK(sum == 8);
+    }
+
+    {
+        // Move-only values survive rehashing.
+        flat_hash_map<int, std::unique_ptr<int>> m;
+        for(int i = 0; i < 1000; ++i)
+            m.try_emplace(i, new int(i));
+        bool all = true;
+        for(int i = 0; i < 1000; ++i)
+            all = all && (*m[i] == i);
+        CHECK(all);
+    }
+
+    {
+        // Strings as keys and values survive rehashing and erasure.
+        flat_hash_map<std::string, std::string> m;
+        for(int i = 0; i < 500; ++i)
+            m[std::to_string(i)] = std::string(20, static_cast<char>('a' + i % 26));
+        for(int i = 0; i < 500; i += 3)
+            m.erase(std::to_string(i));
+        CHECK(m.size() == 333u);
+        CHECK(m["1"] == std::string(20, 'b'));
+        CHECK(!m.contains("3"));
+        auto copy = m;
+        CHECK(copy == m);
+    }
+
+    {
+        // Built from views, like any other associative container.
+        auto m = view::zip(view::ints(0, 4), view::ints(0, 4) |
+            view::transform([](int i) { return i * i; })) | to_<flat_hash_map>();
+        CONCEPT_ASSERT(Same<decltype(m), flat_hash_map<int, int>>());
+        CHECK(m.size() == 5u);
+        CHECK(m[3] == 9);
+
+        std::map<int, int> sorted{{1, 1}, {2, 2}};
+        auto n = sorted | to_<flat_hash_map>();
+        CONCEPT_ASSERT(Same<decltype(n), flat_hash_map<int, int>>());
+        auto back = n | to_<std::map>();
+        CONCEPT_ASSERT(Same<decltype(back), std::map<int, int>>());
+        CHECK(back == sorted);
+
+        insert(n, std::make_pair(3, 3));
+        insert(n, sorted);
+        CHECK(n.size() == 3u);
+    }
+
+    return ::test_result();
+}
@@ -0,0 +1,149 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/container/flat_hash_set.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/action/erase.hpp>
+#include <range/v3/action/sort.hpp>
+#include <range/v3/algorithm/count.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+// Sends every key to the same place, so that every lookup must probe.
+struct collide
+{
+    std::size_t operator()(int) const
+    {
+        return 0;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    ::models<concepts::Container>(flat_hash_set<int>{});
+    ::models<concepts::ForwardIterable>(flat_hash_set<int>{});
+    ::models_not<concepts::Range>(flat_hash_set<int>{});
+    CONCEPT_ASSERT(Same<iterator_reference_t<flat_hash_set<int>::iterator>, int const &>());
+    // Nor can keys be changed through a non-const set.
+    CONCEPT_ASSERT(Same<range_reference_t<flat_hash_set<int>>, int const &>());
+
+    {
+        flat_hash_set<int> s;
+        CHECK(s.empty());
+        CHECK(s.begin() == s.end());
+        CHECK(!s.contains(1));
+        CHECK(s.erase(1) == 0u);
+        CHECK(s.insert(1).second);
+        CHECK(!s.insert(1).second);
+        CHECK(*s.insert(2).first == 2);
+        CHECK(s.size() == 2u);
+        CHECK(s.count(1) == 1u);
+        CHECK(s.count(3) == 0u);
+        CHECK(s.erase(1) == 1u);
+        CHECK(s.size() == 1u);
+        CHECK(!s.contains(1));
+        CHECK(s.contains(2));
+    }
+
+    {
+        // Grow through many capacities, then erase every other element.
+        flat_hash_set<int> s;
+        for(int i = 0; i < 10000; ++i)
+            CHECK(s.insert(i * 1024).second);
+        CHECK(s.size() == 10000u);
+        CHECK(s.load_factor() <= s.max_load_factor());
+        CHECK(distance(s) == 10000);
+        for(int i = 0; i < 10000; i += 2)
+            CHECK(s.erase(i * 1024) == 1u);
+        CHECK(s.size() == 5000u);
+        bool all = true;
+        for(int i = 0; i < 10000; ++i)
+            all = all && (s.contains(i * 1024) == (i % 2 == 1));
+        CHECK(all);
+        std::vector<int> v = s | to_vector;
+        v |= action::sort;
+        CHECK(v.front() == 1024);
+        CHECK(v.back() == 9999 * 1024);
+        CHECK(v.size() == 5000u);
+    }
+
+    {
+        // Erasing and reinserting in a loop reuses deleted slots without growing
+        // without bound.
+        flat_hash_set<int> s;
+        s.reserve(100);
+        auto const cap = s.bucket_count();
+        for(int i = 0; i < 100000; ++i)
+        {
+            s.insert(i);
+            if(i >= 50)
+                s.erase(i - 50);
+        }
+        CHECK(s.size() == 50u);
+        CHECK(s.bucket_count() == cap);
+    }
+
+    {
+        flat_hash_set<int, collide> s;
+        for(int i = 0; i < 100; ++i)
+            s.insert(i);
+        CHECK(s.size() == 100u);
+        CHECK(s.contains(99));
+        CHECK(!s.contains(100));
+    }
+
+    {
+        flat_hash_set<std::string> s{"a", "b", "c", "a"};
+        CHECK(s.size() == 3u);
+        auto t = s;
+        CHECK(t == s);
+        t.erase("b");
+        CHECK(t != s);
+        auto u = std::move(t);
+        CHECK(t.empty());
+        CHECK(u.size() == 2u);
+        t = u;
+        CHECK(t == u);
+        t.clear();
+        CHECK(t.empty());
+        CHECK(t.begin() == t.end());
+        swap(t, u);
+        CHECK(t.size() == 2u);
+        CHECK(u.empty());
+    }
+
+    {
+        // Built directly from views, and fed by ranges::insert.
+        auto s = view::ints(0, 99) | view::transform([](int i) { return i % 10; })
+            | to_<flat_hash_set>();
+        CONCEPT_ASSERT(Same<decltype(s), flat_hash_set<int>>());
+        CHECK(s.size() == 10u);
+        auto evens = view::ints(0, 9) | view::remove_if([](int i) { return i % 2 != 0; });
+        flat_hash_set<int> t;
+        insert(t, evens);
+        CHECK(t.size() == 5u);
+        insert(t, 7);
+        CHECK(t.contains(7));
+        erase(t, t.find(7));
+        CHECK(!t.contains(7));
+        CHECK(count(t, 4) == 1);
+    }
+
+    return ::test_result();
+}
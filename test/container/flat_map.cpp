@@ -0,0 +1,108 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/container/flat_map.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/map.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    ::models<concepts::Container>(flat_map<int, int>{});
+    ::models<concepts::RandomAccessIterable>(flat_map<int, int>{});
+    CONCEPT_ASSERT(Same<range_value_t<flat_map<int, int>>, std::pair<int, int>>());
+
+    {
+        flat_map<std::string, int> m;
+        ++m["b"];
+        ++m["a"];
+        ++m["b"];
+        ::check_equal(m | view::keys, {"a", "b"});
+        ::check_equal(m | view::values, {1, 2});
+        CHECK(m.at("b") == 2);
+        bool threw = false;
+        try
+        {
+            m.at("c");
+        }
+        catch(std::out_of_range const &)
+        {
+            threw = true;
+        }
+        CHECK(threw);
+        auto p = m.try_emplace("a", 7);
+        CHECK(!p.second);
+        CHECK(p.first->second == 1);
+        p = m.insert_or_assign("a", 7);
+        CHECK(m["a"] == 7);
+        CHECK(m.insert({"c", 3}).second);
+        CHECK(!m.insert({"c", 4}).second);
+        CHECK(m.emplace("d", 4).second);
+        CHECK(m.erase("b") == 1u);
+        ::check_equal(m | view::keys, {"a", "c", "d"});
+
+        flat_map<std::string, int> const &cm = m;
+        CHECK(cm.at("c") == 3);
+        CHECK(cm.find("z") == cm.end());
+    }
+
+    {
+        // Batches keep the first value seen for each key.
+        flat_map<int, std::string> m{{2, "two"}, {4, "four"}};
+        std::vector<std::pair<int, std::string>> batch{{3, "three"}, {2, "deux"}, {1, "one"},
+            {3, "trois"}};
+        insert(m, batch);
+        ::check_equal(m | view::keys, {1, 2, 3, 4});
+        ::check_equal(m | view::values, {"one", "two", "three", "four"});
+    }
+
+    {
+        // Move-only values.
+        flat_map<int, std::unique_ptr<int>> m;
+        for(int i = 9; i >= 0; --i)
+            m.try_emplace(i, new int(i));
+        bool all = true;
+        for(int i = 0; i < 10; ++i)
+            all = all && (*m[i] == i);
+        CHECK(all);
+        CHECK(m.begin()->first == 0);
+    }
+
+    {
+        // Built from views, and convertible back to std::map.
+        auto m = view::zip(view::ints(0, 4) | view::transform([](int i) { return 4 - i; }),
+            view::ints(0, 4)) | to_<flat_map>();
+        CONCEPT_ASSERT(Same<decltype(m), flat_map<int, int>>());
+        ::check_equal(m | view::keys, {0, 1, 2, 3, 4});
+        ::check_equal(m | view::values, {4, 3, 2, 1, 0});
+        auto sorted = m | to_<std::map>();
+        CHECK(sorted.size() == 5u);
+        CHECK(sorted[0] == 4);
+        auto range = m.equal_range(3);
+        CHECK((range.second - range.first) == 1);
+        CHECK(range.first->second == 1);
+    }
+
+    return ::test_result();
+}
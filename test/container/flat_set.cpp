@@ -0,0 +1,118 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/container/flat_set.hpp>
+#include <range/v3/action/insert.hpp>
+#include <range/v3/algorithm/set_algorithm.hpp>
+#include <range/v3/utility/iterator.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    ::models<concepts::Container>(flat_set<int>{});
+    ::models<concepts::RandomAccessIterable>(flat_set<int>{});
+    ::models<concepts::SizedIterable>(flat_set<int>{});
+    CONCEPT_ASSERT(Same<iterator_reference_t<flat_set<int>::iterator>, int const &>());
+
+    {
+        flat_set<int> s{5, 1, 4, 1, 5, 9, 2, 6};
+        ::check_equal(s, {1, 2, 4, 5, 6, 9});
+        CHECK(s.insert(3).second);
+        CHECK(!s.insert(3).second);
+        CHECK(*s.insert(0).first == 0);
+        ::check_equal(s, {0, 1, 2, 3, 4, 5, 6, 9});
+        CHECK(s.contains(9));
+        CHECK(!s.contains(7));
+        CHECK(s.count(5) == 1u);
+        CHECK(*s.lower_bound(7) == 9);
+        CHECK(*s.upper_bound(5) == 6);
+        CHECK(s.find(8) == s.end());
+        CHECK(s.erase(4) == 1u);
+        CHECK(s.erase(4) == 0u);
+        s.erase(s.begin());
+        ::check_equal(s, {1, 2, 3, 5, 6, 9});
+        ::check_equal(s | view::reverse, {9, 6, 5, 3, 2, 1});
+        CHECK(s.begin()[2] == 3);
+    }
+
+    {
+        // Batches are sorted and merged; elements already there win.
+        flat_set<int> s{10, 20, 30};
+        std::vector<int> batch{25, 5, 20, 35, 5, 15};
+        s.insert(batch.begin(), batch.end());
+        ::check_equal(s, {5, 10, 15, 20, 25, 30, 35});
+        // A batch that sorts after every element is only appended.
+        insert(s, view::ints(40, 44));
+        ::check_equal(s, {5, 10, 15, 20, 25, 30, 35, 40, 41, 42, 43, 44});
+        std::list<int> lst{3, 2, 1};
+        s.insert(lst.begin(), lst.end());
+        CHECK(s.size() == 15u);
+        CHECK(s.sequence().front() == 1);
+        s.insert({});
+        CHECK(s.size() == 15u);
+    }
+
+    {
+        // Hinted insertion of sorted input.
+        flat_set<int> s;
+        for(int i = 0; i < 10; ++i)
+            CHECK(*s.insert(s.end(), i) == i);
+        ::check_equal(s, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+        CHECK(*s.insert(s.begin(), 4) == 4);
+        CHECK(s.size() == 10u);
+    }
+
+    {
+        flat_set<std::string, std::greater<std::string>> s{"b", "c", "a"};
+        ::check_equal(s, {"c", "b", "a"});
+        flat_set<std::string, std::greater<std::string>> t{sorted_unique,
+            std::vector<std::string>{"z", "y"}};
+        CHECK(t.size() == 2u);
+        CHECK(s < t);
+        CHECK(s != t);
+        auto v = std::move(t).extract();
+        CHECK(v.size() == 2u);
+        CHECK(t.empty());
+    }
+
+    {
+        // Composes with the set algorithms and with views.
+        flat_set<int> a{1, 3, 5, 7, 9};
+        flat_set<int> b{3, 4, 5, 6};
+        std::vector<int> out;
+        set_intersection(a, b, back_inserter(out));
+        ::check_equal(out, {3, 5});
+        out.clear();
+        set_union(a, b, back_inserter(out));
+        ::check_equal(out, {1, 3, 4, 5, 6, 7, 9});
+        CHECK(includes(a, flat_set<int>{3, 9}));
+
+        auto c = view::ints(0, 99) | view::transform([](int i) { return (i * 37) % 10; })
+            | to_<flat_set>();
+        CONCEPT_ASSERT(Same<decltype(c), flat_set<int>>());
+        ::check_equal(c | view::take(3), {0, 1, 2});
+        CHECK(c.size() == 10u);
+    }
+
+    return ::test_result();
+}
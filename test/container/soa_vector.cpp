@@ -0,0 +1,176 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <tuple>
+#include <memory>
+#include <string>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/container/soa_vector.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/algorithm/stable_sort.hpp>
+#include <range/v3/algorithm/partition.hpp>
+#include <range/v3/algorithm/nth_element.hpp>
+#include <range/v3/algorithm/unique.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+// A projection onto one field of a record, whether it is a reference into
+// the columns or a value held in an algorithm's buffer.
+template<std::size_t I>
+struct field
+{
+    template<typename T>
+    auto operator()(T const &t) const -> decltype(std::get<I>(t))
+    {
+        return std::get<I>(t);
+    }
+};
+
+struct throws_on_copy
+{
+    throws_on_copy() = default;
+    throws_on_copy(throws_on_copy &&) noexcept = default;
+    throws_on_copy(throws_on_copy const &)
+    {
+        throw std::runtime_error("throws_on_copy");
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    using V3 = soa_vector<int, std::string, double>;
+    ::models<concepts::RandomAccessIterable>(V3{});
+    ::models<concepts::SizedIterable>(V3{});
+    CONCEPT_ASSERT(Same<range_value_t<V3>, std::tuple<int, std::string, double>>());
+    CONCEPT_ASSERT(Same<range_reference_t<V3>,
+        common_tuple<int &, std::string &, double &>>());
+    CONCEPT_ASSERT(Same<range_value_t<soa_vector<int, char>>, std::pair<int, char>>());
+
+    {
+        V3 v;
+        CHECK(v.empty());
+        v.emplace_back(3, "c", 3.5);
+        v.emplace_back(1, "a", 1.5);
+        v.push_back(std::make_tuple(2, std::string("b"), 2.5));
+        CHECK(v.size() == 3u);
+        CHECK(std::get<1>(v[1]) == "a");
+        CHECK(std::get<0>(v.front()) == 3);
+        CHECK(std::get<2>(v.back()) == 2.5);
+        ::check_equal(v.column<0>(), {3, 1, 2});
+        ::check_equal(v.column<2>(), {3.5, 1.5, 2.5});
+
+        // Writing through a reference writes to the columns.
+        std::get<0>(v[2]) = 4;
+        ::check_equal(v.column<0>(), {3, 1, 4});
+        for(auto &d : v.column<2>())
+            d *= 2;
+        CHECK(accumulate(v.column<2>(), 0.0) == 15.0);
+
+        V3 const &cv = v;
+        CHECK(std::get<1>(cv.at(0)) == "c");
+        CHECK((cv.end() - cv.begin()) == 3);
+        bool thrown = false;
+        try { cv.at(3); } catch(std::out_of_range const &) { thrown = true; }
+        CHECK(thrown);
+    }
+
+    // The mutating algorithms permute whole records.
+    {
+        V3 v{std::make_tuple(3, std::string("c"), 3.0), std::make_tuple(1, std::string("a"), 1.0),
+             std::make_tuple(4, std::string("d"), 4.0), std::make_tuple(1, std::string("a"), 1.0),
+             std::make_tuple(2, std::string("b"), 2.0)};
+        sort(v);
+        ::check_equal(v.column<0>(), {1, 1, 2, 3, 4});
+        ::check_equal(v.column<1>(), {"a", "a", "b", "c", "d"});
+        ::check_equal(v.column<2>(), {1.0, 1.0, 2.0, 3.0, 4.0});
+
+        auto it = unique(v);
+        CHECK((it - v.begin()) == 4);
+        v.erase(it, v.end());
+        ::check_equal(v.column<0>(), {1, 2, 3, 4});
+        ::check_equal(v.column<1>(), {"a", "b", "c", "d"});
+
+        sort(v, std::greater<std::string>{}, field<1>{});
+        ::check_equal(v.column<0>(), {4, 3, 2, 1});
+        ::check_equal(v.column<2>(), {4.0, 3.0, 2.0, 1.0});
+
+        auto mid = partition(v, [](int i) { return i % 2 == 0; }, field<0>{});
+        CHECK((mid - v.begin()) == 2);
+        for(auto &&r : v)
+            CHECK((std::get<1>(r)[0] - 'a' + 1) == std::get<0>(r));
+        for(auto &&r : v)
+            CHECK(double(std::get<0>(r)) == std::get<2>(r));
+
+        nth_element(v, v.begin() + 1, std::less<int>{}, field<0>{});
+        CHECK(std::get<0>(v[1]) == 2);
+        CHECK(std::get<1>(v[1]) == "b");
+        CHECK(std::get<2>(v[1]) == 2.0);
+    }
+
+    // stable_sort keeps records with equal keys in order.
+    {
+        soa_vector<int, int> v;
+        int const keys[] = {2, 1, 2, 0, 1, 2, 0};
+        for(int i = 0; i != 7; ++i)
+            v.emplace_back(keys[i], i);
+        stable_sort(v, std::less<int>{}, field<0>{});
+        ::check_equal(v.column<0>(), {0, 0, 1, 1, 2, 2, 2});
+        ::check_equal(v.column<1>(), {3, 6, 1, 4, 0, 2, 5});
+    }
+
+    // Move-only fields are moved, not copied, when records are permuted.
+    {
+        soa_vector<int, std::unique_ptr<int>> v;
+        for(int i : {3, 1, 2})
+            v.emplace_back(i, std::unique_ptr<int>(new int(i)));
+        sort(v, std::less<int>{}, field<0>{});
+        ::check_equal(v.column<0>(), {1, 2, 3});
+        for(auto &&r : v)
+            CHECK(*std::get<1>(r) == std::get<0>(r));
+    }
+
+    // A failed append leaves every column as it was.
+    {
+        soa_vector<int, throws_on_copy> v;
+        v.emplace_back(1, throws_on_copy{});
+        throws_on_copy t;
+        bool thrown = false;
+        try { v.emplace_back(2, t); } catch(std::runtime_error const &) { thrown = true; }
+        CHECK(thrown);
+        CHECK(v.size() == 1u);
+        CHECK(v.column<1>().size() == 1u);
+    }
+
+    {
+        soa_vector<int, double> v(3);
+        CHECK(v.size() == 3u);
+        v.resize(5);
+        ::check_equal(v.column<1>(), {0.0, 0.0, 0.0, 0.0, 0.0});
+        v.pop_back();
+        v.erase(v.begin());
+        CHECK(v.size() == 3u);
+        soa_vector<int, double> w;
+        swap(v, w);
+        CHECK(v.empty());
+        CHECK(w.size() == 3u);
+        CHECK(w != v);
+        w.clear();
+        CHECK(w == v);
+    }
+
+    return ::test_result();
+}
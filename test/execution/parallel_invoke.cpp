@@ -0,0 +1,86 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <atomic>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/execution/parallel_invoke.hpp>
+#include "../simple_test.hpp"
+
+long fib(int n)
+{
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+}
+
+long fib(ranges::execution::parallel_policy const &policy, int n)
+{
+    if(n < 16)
+        return fib(n);
+    long a = 0, b = 0;
+    ranges::execution::parallel_invoke(policy,
+        [&]{ a = fib(policy, n - 1); },
+        [&]{ b = fib(policy, n - 2); });
+    return a + b;
+}
+
+int main()
+{
+    using namespace ranges;
+
+    // Sequenced calls happen in order on the calling thread.
+    {
+        int order[3] = {0, 0, 0};
+        int next = 0;
+        execution::parallel_invoke(execution::seq,
+            [&]{ order[0] = ++next; },
+            [&]{ order[1] = ++next; },
+            [&]{ order[2] = ++next; });
+        CHECK(order[0] == 1);
+        CHECK(order[1] == 2);
+        CHECK(order[2] == 3);
+    }
+
+    // All functions run, and nested fork-join works.
+    {
+        std::atomic<int> count{0};
+        execution::parallel_invoke(execution::par,
+            [&]{ ++count; });
+        execution::parallel_invoke(execution::par,
+            [&]{ ++count; },
+            [&]{ ++count; },
+            [&]{ ++count; });
+        CHECK(count == 4);
+        CHECK(fib(execution::par, 25) == 75025);
+
+        execution::thread_pool pool{1};
+        CHECK(fib(execution::par.on(pool), 25) == 75025);
+    }
+
+    // Exceptions propagate once all functions have finished.
+    {
+        std::atomic<int> count{0};
+        bool caught = false;
+        try
+        {
+            execution::parallel_invoke(execution::par,
+                [&]{ ++count; throw std::runtime_error("oops"); },
+                [&]{ ++count; });
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+        CHECK(count == 2);
+    }
+
+    return ::test_result();
+}
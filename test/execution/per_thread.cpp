@@ -0,0 +1,61 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/execution.hpp>
+#include "../simple_test.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        execution::thread_pool pool{3};
+        execution::per_thread<long> sums{pool, 0};
+        int slots = 0;
+        sums.for_each([&](long &s){ ++slots; CHECK(s == 0); });
+        CHECK(slots == 4);
+
+        // The creating thread has a slot of its own.
+        sums.local() = 5;
+        long total = 0;
+        sums.for_each([&](long s){ total += s; });
+        CHECK(total == 5);
+        sums.local() = 0;
+
+        execution::parallel_for(execution::par.on(pool), 1000000L, [&](long lo, long hi)
+        {
+            long &s = sums.local();
+            for(; lo != hi; ++lo)
+                s += lo;
+        });
+        total = 0;
+        sums.for_each([&](long s){ total += s; });
+        CHECK(total == 999999L * 1000000L / 2);
+    }
+
+    // Per-thread scratch buffers
+    {
+        execution::per_thread<std::vector<int>> buffers{execution::default_thread_pool()};
+        execution::parallel_for(execution::par, 100000, [&](int lo, int hi)
+        {
+            std::vector<int> &buf = buffers.local();
+            for(; lo != hi; ++lo)
+                buf.push_back(lo);
+        });
+        std::size_t n = 0;
+        buffers.for_each([&](std::vector<int> const &buf){ n += buf.size(); });
+        CHECK(n == 100000u);
+    }
+
+    return ::test_result();
+}
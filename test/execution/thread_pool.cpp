@@ -0,0 +1,123 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <atomic>
+#include <vector>
+#include <stdexcept>
+#include <range/v3/core.hpp>
+#include <range/v3/execution.hpp>
+#include <range/v3/algorithm/for_each.hpp>
+#include "../simple_test.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    // A pool asked for no threads gets one.
+    {
+        execution::thread_pool pool{0};
+        CHECK(pool.size() == 1u);
+        CHECK(pool.worker_index() == 1u);
+        CHECK(!pool.run_one());
+    }
+
+    // Tasks run on the pool's workers.
+    {
+        execution::thread_pool pool{3};
+        CHECK(pool.size() == 3u);
+        std::atomic<int> count{0};
+        std::atomic<int> outside{0};
+        execution::task_group grp{pool};
+        for(int i = 0; i < 1000; ++i)
+            grp.run([&]
+            {
+                ++count;
+                if(pool.worker_index() == pool.size())
+                    ++outside;
+            });
+        grp.wait();
+        CHECK(count == 1000);
+        CHECK(outside == 0);
+    }
+
+    // Nested fork-join on a single worker must not deadlock.
+    {
+        execution::thread_pool pool{1};
+        std::atomic<int> count{0};
+        execution::task_group outer{pool};
+        for(int i = 0; i < 10; ++i)
+            outer.run([&]
+            {
+                execution::task_group inner{pool};
+                for(int j = 0; j < 10; ++j)
+                    inner.run([&]{ ++count; });
+                inner.wait();
+            });
+        outer.wait();
+        CHECK(count == 100);
+    }
+
+    // The first exception is rethrown by wait, after all tasks have finished.
+    {
+        execution::thread_pool pool{2};
+        std::atomic<int> count{0};
+        execution::task_group grp{pool};
+        for(int i = 0; i < 100; ++i)
+            grp.run([&, i]
+            {
+                ++count;
+                if(i % 10 == 0)
+                    throw std::runtime_error("oops");
+            });
+        bool caught = false;
+        try
+        {
+            grp.wait();
+        }
+        catch(std::runtime_error const &)
+        {
+            caught = true;
+        }
+        CHECK(caught);
+        CHECK(count == 100);
+    }
+
+    // par.on(pool) runs an algorithm on the given pool.
+    {
+        execution::thread_pool pool{2};
+        std::vector<int> v(100000, 1);
+        std::atomic<long> total{0};
+        auto policy = execution::par.on(pool);
+        CHECK(&policy.pool() == &pool);
+        CHECK(&execution::par.pool() == &execution::default_thread_pool());
+        for_each(policy, v, [&](int i){ total += i; });
+        CHECK(total == 100000);
+
+        total = 0;
+        for_each(execution::par_unseq.on(pool), v, [&](int i){ total += i; });
+        CHECK(total == 100000);
+    }
+
+    // Policy traits
+    {
+        CHECK(ExecutionPolicy<execution::sequenced_policy>());
+        CHECK(ExecutionPolicy<execution::parallel_policy const &>());
+        CHECK(ExecutionPolicy<execution::parallel_unsequenced_policy>());
+        CHECK(!ExecutionPolicy<int>());
+        CHECK(ParallelExecutionPolicy<execution::parallel_unsequenced_policy>());
+        CHECK(!ParallelExecutionPolicy<execution::sequenced_policy>());
+        CHECK(SplittableIterable<std::vector<int> &>());
+        CHECK(!SplittableIterable<std::list<int> &>());
+    }
+
+    return ::test_result();
+}
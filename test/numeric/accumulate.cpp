@@ -20,7 +20,12 @@
 //===----------------------------------------------------------------------===//
 
 #include <range/v3/core.hpp>
+#include <string>
+#include <vector>
 #include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/execution/numeric/accumulate.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
 #include "../simple_test.hpp"
 #include "../test_iterators.hpp"
 
@@ -75,5 +80,57 @@ int main()
     CHECK(ranges::accumulate({1, 2, 3, 4, 5, 6}, S{10}, &S::add).i == 31);
     CHECK(ranges::accumulate({S{1}, S{2}, S{3}, S{4}, S{5}, S{6}}, 10, ranges::plus{}, &S::i) == 31);
 
+    // Integer iotas are summed in closed form.
+    {
+        using namespace ranges;
+        auto loop = [](long long from, long long n, long long init)
+        {
+            for(long long i = 0; i < n; ++i)
+                init += from + i;
+            return init;
+        };
+        CHECK(accumulate(view::ints(1, 100), 0) == 5050);
+        CHECK(accumulate(view::iota(1, 100), 10) == 5060);
+        CHECK(accumulate(view::ints(5, 5), 0) == 5);
+        CHECK(accumulate(view::ints(-7, 12), 3LL) == loop(-7, 20, 3));
+        CHECK(accumulate(view::ints(-12, -1), 0) == loop(-12, 12, 0));
+        CHECK(accumulate(view::ints(0, 1) | view::take(0), 1) == 1);
+        CHECK(accumulate(view::ints(1, 99999), 0LL) == 99999LL * 100000LL / 2);
+        CHECK(accumulate(view::ints(2000000000, 2000000100), 0LL) == loop(2000000000, 101, 0));
+        CHECK(accumulate(view::ints(-2147483647 - 1, 2147483647), 0LL) == -2147483648LL);
+        // Unsigned sums wrap as they do one by one.
+        unsigned u = 0;
+        for(unsigned i = 4000000000u; i != 4000100000u; ++i)
+            u += i;
+        CHECK(accumulate(view::ints(4000000000u, 4000099999u), 0u) == u);
+        CHECK(accumulate(view::ints((short) 1, (short) 300), 0) == 45150);
+        // Other operations and projections add up elements one by one.
+        CHECK(accumulate(view::ints(1, 5), 1, [](int a, int b) { return a * b; }) == 120);
+        CHECK(accumulate(view::ints(1, 4), 0, plus{}, [](int i) { return i * i; }) == 30);
+        CHECK(accumulate(view::ints(1, 4), 0.5) == 10.5);
+    }
+
+    // Execution policies
+    {
+        using namespace ranges;
+        int ia[] = {1, 2, 3, 4, 5, 6};
+        CHECK(accumulate(execution::seq, ia, 10) == 31);
+        CHECK(accumulate(execution::par, ia, 10) == 31);
+        CHECK(accumulate(execution::par, ia, ia, 10) == 10);
+        CHECK(accumulate(execution::par, view::ints(1, 100000), 0L) == 100000L * 100001L / 2);
+        CHECK(accumulate(execution::par, view::ints(1, 100000), 0L, plus{},
+            [](int i){ return i % 3; }) == 100000L);
+
+        // The pieces must be combined in order for a non-commutative operation.
+        std::vector<std::string> v;
+        std::string expected;
+        for(int i = 0; i < 20000; ++i)
+        {
+            v.push_back(std::string(1, (char)('a' + i % 26)));
+            expected += v.back();
+        }
+        CHECK(accumulate(execution::par, v, std::string{}) == expected);
+    }
+
     return ::test_result();
 }
@@ -0,0 +1,110 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/view/cache_begin.hpp>
+#include <range/v3/view/any_range.hpp>
+#include <range/v3/view/drop.hpp>
+#include <range/v3/view/remove_if.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+template<typename Rng>
+int front_by_value(Rng rng)
+{
+    return *ranges::begin(rng);
+}
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    int calls = 0;
+    auto small = [&calls](int i) { ++calls; return i < 5; };
+    // The iterators of a transform_view over a lambda point back into the
+    // view, so copies of a remove_if_view over it cannot keep its cache.
+    auto pipeline = v | view::transform([](int i) { return i; }) | view::remove_if(small);
+
+    {
+        auto rng = pipeline;
+        CHECK(*begin(rng) == 5);
+        CHECK(calls == 6);
+        CHECK(*begin(rng) == 5);
+        CHECK(calls == 6);
+        auto copy = rng;
+        CHECK(*begin(copy) == 5);
+        CHECK(calls == 12);
+    }
+
+    {
+        calls = 0;
+        auto rng = pipeline | view::cache_begin;
+        models<concepts::BidirectionalRange>(rng);
+        models<concepts::BoundedRange>(rng);
+        models_not<concepts::SizedRange>(rng);
+        ::check_equal(rng, {5, 6, 7, 8, 9});
+        int const first = calls;
+        CHECK(first == 10);
+        auto copy = rng;
+        CHECK(*begin(copy) == 5);
+        auto in_lambda = [rng] { return *begin(rng); };
+        CHECK(in_lambda() == 5);
+        CHECK(in_lambda() == 5);
+        CHECK(front_by_value(rng) == 5);
+        any_input_range<int> any = rng;
+        CHECK(*begin(any) == 5);
+        CHECK(calls == first);
+        // Only the search for the first element is shared; the rest of the
+        // range is still filtered as it is traversed.
+        ::check_equal(copy | view::reverse, {9, 8, 7, 6, 5});
+        ::check_equal(copy, {5, 6, 7, 8, 9});
+        CHECK(calls > first);
+    }
+
+    {
+        // drop_view keeps its own cache across copies of a view over
+        // cache_begin, since the iterators of that are shared by its copies.
+        calls = 0;
+        auto rng = pipeline | view::cache_begin | view::drop(2);
+        CHECK(*begin(rng) == 7);
+        int const first = calls;
+        CHECK(first == 8);
+        auto copy = rng;
+        CHECK(*begin(copy) == 7);
+        CHECK(front_by_value(copy) == 7);
+        CHECK(calls == first);
+
+        calls = 0;
+        auto uncached = pipeline | view::drop(2);
+        CHECK(*begin(uncached) == 7);
+        CHECK(calls == 8);
+        auto uncached_copy = uncached;
+        CHECK(*begin(uncached_copy) == 7);
+        CHECK(calls == 16);
+    }
+
+    {
+        auto rng = v | view::cache_begin;
+        models<concepts::RandomAccessRange>(rng);
+        models<concepts::SizedRange>(rng);
+        CHECK(size(rng) == 10u);
+        CHECK(&*begin(rng) == &v[0]);
+        auto const crng = rng;
+        CHECK(&*begin(crng) == &v[0]);
+        ::check_equal(rng | view::drop(8), {8, 9});
+    }
+
+    return test_result();
+}
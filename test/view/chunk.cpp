@@ -0,0 +1,114 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <vector>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/chunk.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    {
+        auto rng = v | view::chunk(3);
+        models<concepts::RandomAccessRange>(rng);
+        models<concepts::SizedRange>(rng);
+        models<concepts::SizedRange>(*begin(rng));
+        CHECK(size(rng) == 4u);
+        CHECK(distance(rng) == 4);
+        check_equal(*begin(rng), {0, 1, 2});
+        check_equal(*next(begin(rng)), {3, 4, 5});
+        check_equal(*next(begin(rng), 2), {6, 7, 8});
+        check_equal(*next(begin(rng), 3), {9, 10});
+        CHECK(size(*next(begin(rng), 3)) == 2u);
+        CHECK(next(begin(rng), 4) == end(rng));
+
+        auto it = next(begin(rng), 4);
+        --it;
+        check_equal(*it, {9, 10});
+        it -= 2;
+        check_equal(*it, {3, 4, 5});
+        CHECK((end(rng) - it) == 3);
+        CHECK((it - begin(rng)) == 1);
+
+        auto rev = rng | view::reverse;
+        check_equal(*begin(rev), {9, 10});
+        check_equal(*next(begin(rev), 3), {0, 1, 2});
+    }
+
+    {
+        auto rng = v | view::chunk(11);
+        CHECK(size(rng) == 1u);
+        check_equal(*begin(rng), {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+        auto rng2 = v | view::chunk(20);
+        CHECK(size(rng2) == 1u);
+        CHECK(size(*begin(rng2)) == 11u);
+
+        std::vector<int> e;
+        auto rng3 = e | view::chunk(4);
+        CHECK(size(rng3) == 0u);
+        CHECK(begin(rng3) == end(rng3));
+    }
+
+    {
+        std::list<int> l(v.begin(), v.end());
+        auto rng = l | view::chunk(4);
+        models<concepts::ForwardRange>(rng);
+        models_not<concepts::BidirectionalRange>(rng);
+        models<concepts::SizedRange>(rng);
+        models<concepts::SizedRange>(*begin(rng));
+        CHECK(size(rng) == 3u);
+        check_equal(*begin(rng), {0, 1, 2, 3});
+        check_equal(*next(begin(rng)), {4, 5, 6, 7});
+        check_equal(*next(begin(rng), 2), {8, 9, 10});
+        CHECK(size(*next(begin(rng), 2)) == 3u);
+        CHECK(next(begin(rng), 3) == end(rng));
+    }
+
+    {
+        std::forward_list<int> fl(v.begin(), v.end());
+        auto rng = fl | view::chunk(5);
+        models<concepts::ForwardRange>(rng);
+        models_not<concepts::SizedRange>(rng);
+        CHECK(distance(rng) == 3);
+        check_equal(*next(begin(rng), 2), {10});
+    }
+
+    {
+        // Chunks of a random-access pipeline can be consumed with tight inner loops.
+        auto rng = view::iota(0, 99) | view::transform([](int i){return i * 2;}) | view::chunk(10);
+        models<concepts::RandomAccessRange>(rng);
+        CHECK(size(rng) == 10u);
+        int sum = 0;
+        for(auto chunk : rng)
+            sum += accumulate(chunk, 0);
+        CHECK(sum == 99 * 100);
+    }
+
+    {
+        auto rng = view::ints(0) | view::chunk(2);
+        static_assert(is_infinite<decltype(rng)>::value, "");
+        check_equal(*next(begin(rng), 5), {10, 11});
+    }
+
+    return ::test_result();
+}
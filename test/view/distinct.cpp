@@ -0,0 +1,91 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <string>
+#include <vector>
+#include <sstream>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/distinct.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+struct person
+{
+    std::string name;
+    int age;
+};
+
+// Hashes every key to the same slot, so that every lookup must probe.
+struct collide
+{
+    std::size_t operator()(int) const
+    {
+        return 42;
+    }
+};
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<int> v{3, 1, 3, 2, 1, 1, 4, 2, 3};
+        auto rng = v | view::distinct;
+        ::models_not<concepts::ForwardIterable>(rng);
+        ::models<concepts::InputIterable>(rng);
+        ::check_equal(rng, {3, 1, 2, 4});
+        // Iterating again starts from scratch.
+        ::check_equal(rng, {3, 1, 2, 4});
+        ::check_equal(view::distinct(v), {3, 1, 2, 4});
+    }
+
+    {
+        std::vector<int> v;
+        CHECK(begin(v | view::distinct) == end(v | view::distinct));
+    }
+
+    {
+        std::vector<person> people{{"ann", 30}, {"bob", 25}, {"cat", 30}, {"dan", 41},
+            {"eve", 25}};
+        ::check_equal(people | view::distinct(&person::age) |
+            view::transform(&person::name), {"ann", "bob", "dan"});
+        ::check_equal(view::distinct(people, &person::age) |
+            view::transform(&person::name), {"ann", "bob", "dan"});
+    }
+
+    {
+        // Keys that only differ above the low bits.
+        std::vector<int> v;
+        for(int i = 0; i < 1000; ++i)
+            v.push_back((i % 100) << 16);
+        CHECK(distance(v | view::distinct) == 100);
+        auto mod7 = [](int i) { return i % 7; };
+        CHECK(distance(view::ints(0, 999) | view::distinct(mod7)) == 7);
+        ::check_equal(view::ints(0, 20) | view::distinct(mod7, collide{}),
+            {0, 1, 2, 3, 4, 5, 6});
+    }
+
+    {
+        // Infinite and single-pass sources.
+        auto mod5 = [](int i) { return i % 5; };
+        // take increments past its last element, so leave a key to find there.
+        ::check_equal(view::ints(0) | view::distinct(mod5) | view::take(4), {0, 1, 2, 3});
+        std::stringstream sin{"b a b c a d"};
+        ::check_equal(istream<std::string>(sin) | view::distinct,
+            {"b", "a", "c", "d"});
+    }
+
+    return ::test_result();
+}
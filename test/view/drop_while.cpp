@@ -45,5 +45,14 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_only)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_only) const>());
 
+    // Copies of a view over a container keep the begin it has found.
+    std::list<int> l{1, 2, 3, 4, 5};
+    int calls = 0;
+    auto counted = l | view::drop_while([&calls](int i) { ++calls; return i < 3; });
+    CHECK(*begin(counted) == 3);
+    auto copy = counted;
+    CHECK(*begin(copy) == 3);
+    CHECK(calls == 3);
+
     return test_result();
 }
@@ -0,0 +1,75 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <functional>
+#include <range/v3/core.hpp>
+#include <range/v3/istream_range.hpp>
+#include <range/v3/view/merge_k.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    {
+        std::vector<std::vector<int>> runs{{1, 4, 7}, {2, 5, 8, 10}, {}, {0, 3, 6, 9}};
+        auto rng = view::merge_k(runs);
+        ::models<concepts::InputRange>(rng);
+        ::models_not<concepts::ForwardRange>(rng);
+        CONCEPT_ASSERT(Same<range_reference_t<decltype(rng)>, int &>());
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+        // Iterating again starts over.
+        ::check_equal(rng, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+
+        // References refer to the elements of the inner ranges.
+        for(auto it = begin(rng); it != end(rng); ++it)
+            *it *= 10;
+        ::check_equal(runs[3], {0, 30, 60, 90});
+
+        ::check_equal(runs | view::merge_k | view::take(3), {0, 10, 20});
+    }
+
+    {
+        // Ordered and projected, and stable.
+        using P = std::pair<int, char>;
+        std::vector<std::list<P>> runs{
+            {{3, 'a'}, {1, 'a'}},
+            {{3, 'b'}, {2, 'b'}},
+            {{1, 'c'}}};
+        auto rng = runs | view::merge_k(std::greater<int>{}, &P::first)
+            | view::transform([](P const &p) { return p.second; });
+        ::check_equal(rng, {'a', 'b', 'b', 'a', 'c'});
+    }
+
+    {
+        // Only as much of the inputs is read as is asked for.
+        std::istringstream s0{"1 3 5 7 9"}, s1{"2 4 6 8"};
+        std::vector<istream_range<int>> runs{istream<int>(s0), istream<int>(s1)};
+        ::check_equal(view::merge_k(runs) | view::take(4), {1, 2, 3, 4});
+        int next = 0;
+        s0 >> next;
+        CHECK(next == 7);
+    }
+
+    {
+        std::vector<std::vector<int>> none;
+        CHECK(begin(view::merge_k(none)) == end(view::merge_k(none)));
+    }
+
+    return ::test_result();
+}
@@ -49,6 +49,15 @@ int main()
     CHECK(*it2 == 1);
     ++it2;
     CHECK(*it2 == 3);
+    // The end needs no sum, but iterators compare equal all the same.
+    CHECK(next(begin(rng), 10) == end(rng));
+    // With a semiregular function, the iterators hold nothing of the view
+    // itself, so they outlive it.
+    {
+        auto first = begin(view::partial_sum(rgi, std::plus<int>()));
+        CHECK(*++first == 3);
+        CHECK(*++first == 6);
+    }
 
     // Test partial_sum with a mutable lambda
     int cnt = 0;
@@ -9,6 +9,7 @@
 //
 // Project home: https://github.com/ericniebler/range-v3
 
+#include <vector>
 #include <iterator>
 #include <functional>
 #include <range/v3/core.hpp>
@@ -70,6 +71,8 @@ int main()
     ::check_equal(rng3, {1,3,5,7,9});
     CHECK(&*begin(rng3) == &rgi[0]);
     CHECK(&*prev(next(begin(rng3))) == &rgi[0]);
+    // The sentinel holds nothing but the base's.
+    static_assert(sizeof(end(rng3)) == sizeof(end(view::counted(bidirectional_iterator<int*>{rgi}, 10))), "");
 
     // Test remove_if with a mutable lambda
     bool flag = true;
@@ -78,5 +81,37 @@ int main()
     CONCEPT_ASSERT(Range<decltype(mutable_rng)>());
     CONCEPT_ASSERT(!Range<decltype(mutable_rng) const>());
 
+    // Copies of a view over an array keep the begin it has found.
+    int calls = 0;
+    auto counted_rng = rgi | view::remove_if([&calls](int i) { ++calls; return i < 4; });
+    CHECK(*begin(counted_rng) == 4);
+    CHECK(calls == 4);
+    auto copy = counted_rng;
+    CHECK(*begin(copy) == 4);
+    auto moved = std::move(copy);
+    CHECK(*begin(moved) == 4);
+    copy = moved;
+    CHECK(*begin(copy) == 4);
+    CHECK(calls == 4);
+
+    // Stacked remove_ifs are fused into one remove_if_view of the base, which
+    // asks the second predicate only of the elements the first one keeps.
+    {
+        std::vector<int> asked;
+        auto fused = rgi | view::remove_if(is_even())
+                         | view::remove_if([&asked](int i) { asked.push_back(i); return i % 3 == 0; });
+        CONCEPT_ASSERT(Same<decltype(fused.base()), range<int *> &>());
+        models<concepts::BidirectionalRange>(fused);
+        ::check_equal(fused, {1,5,7});
+        ::check_equal(asked, {1,3,5,7,9});
+        ::check_equal(fused | view::reverse, {7,5,1});
+        CHECK(&*begin(fused) == &rgi[0]);
+
+        auto filtered = rgi | view::remove_if(is_even()) | view::remove_if(not_(is_odd()))
+                            | view::remove_if([](int i) { return i < 5; });
+        CONCEPT_ASSERT(Same<decltype(filtered.base()), range<int *> &>());
+        ::check_equal(filtered, {5,7,9});
+    }
+
     return test_result();
 }
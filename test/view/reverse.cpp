@@ -0,0 +1,95 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <memory>
+#include <vector>
+#include <range/v3/core.hpp>
+#include <range/v3/algorithm/sort.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/zip.hpp>
+#include <range/v3/view/move.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+#include "../test_iterators.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    int rgi[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto rng0 = rgi | view::reverse;
+    has_type<int &>(*begin(rng0));
+    models<concepts::RandomAccessRange>(rng0);
+    models<concepts::BoundedRange>(rng0);
+    models<concepts::SizedRange>(rng0);
+    CONCEPT_ASSERT(Range<decltype(rng0) const>());
+    CHECK(rng0.size() == 10u);
+    ::check_equal(rng0, {9, 8, 7, 6, 5, 4, 3, 2, 1, 0});
+    CHECK(&*begin(rng0) == &rgi[9]);
+    CHECK(&*prev(end(rng0)) == &rgi[0]);
+    CHECK((end(rng0) - begin(rng0)) == 10);
+    CHECK((begin(rng0) - end(rng0)) == -10);
+    CHECK(begin(rng0)[3] == 6);
+    CHECK(*(end(rng0) - 3) == 2);
+    CHECK(*(begin(rng0) + 10 - 10) == 9);
+    ::check_equal(rng0 | view::reverse, rgi);
+
+    // Sorting through the reversed view sorts the base in descending order.
+    std::vector<int> vi{3, 1, 4, 1, 5, 9, 2, 6};
+    auto rvi = vi | view::reverse;
+    sort(rvi);
+    ::check_equal(vi, {9, 6, 5, 4, 3, 2, 1, 1});
+
+    // A base that is not bounded.
+    auto rng1 = make_range(bidirectional_iterator<int*>(rgi),
+        sentinel<int*>(rgi + 4)) | view::reverse;
+    models<concepts::BidirectionalRange>(rng1);
+    models<concepts::BoundedRange>(rng1);
+    models_not<concepts::RandomAccessRange>(rng1);
+    ::check_equal(rng1, {3, 2, 1, 0});
+    // Its end is found once and cached, so only a mutable view can be iterated.
+    CONCEPT_ASSERT(!Range<decltype(rng1) const>());
+    CHECK(begin(rng1) == begin(rng1));
+    auto rng1b = rng1;
+    ::check_equal(rng1b, {3, 2, 1, 0});
+    rng1b = rng1;
+    ::check_equal(rng1b, {3, 2, 1, 0});
+
+    std::list<int> li{0, 1, 2, 3};
+    auto rng2 = li | view::reverse;
+    models<concepts::BidirectionalRange>(rng2);
+    models<concepts::SizedRange>(rng2);
+    ::check_equal(rng2, {3, 2, 1, 0});
+    CHECK(rng2.size() == 4u);
+
+    // iter_move moves the element before the base position.
+    std::vector<std::unique_ptr<int>> vp;
+    for(int i = 0; i != 3; ++i)
+        vp.emplace_back(new int(i));
+    auto rng3 = vp | view::reverse;
+    CONCEPT_ASSERT(Same<range_rvalue_reference_t<decltype(rng3)>, std::unique_ptr<int> &&>());
+    std::unique_ptr<int> p = iter_move(begin(rng3));
+    CHECK(*p == 2);
+    CHECK(vp[2] == nullptr);
+    CHECK(vp[1] != nullptr);
+
+    // Proxy references pass through unchanged.
+    std::vector<int> vj{10, 11, 12};
+    auto rng4 = view::zip(vj, vj) | view::reverse;
+    has_type<common_pair<int &, int &>>(*begin(rng4));
+    CONCEPT_ASSERT(Same<range_value_t<decltype(rng4)>, std::pair<int, int>>());
+    has_type<common_pair<int &&, int &&>>(iter_move(begin(rng4)));
+    CHECK(&begin(rng4)->first == &vj[2]);
+
+    return test_result();
+}
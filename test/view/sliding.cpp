@@ -0,0 +1,106 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <list>
+#include <vector>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{0, 1, 2, 3, 4, 5};
+
+    {
+        auto rng = v | view::sliding(3);
+        models<concepts::RandomAccessRange>(rng);
+        models<concepts::BoundedRange>(rng);
+        models<concepts::SizedRange>(rng);
+        models<concepts::SizedRange>(*begin(rng));
+        CHECK(size(rng) == 4u);
+        CHECK(distance(rng) == 4);
+        check_equal(*begin(rng), {0, 1, 2});
+        check_equal(*next(begin(rng)), {1, 2, 3});
+        check_equal(*next(begin(rng), 3), {3, 4, 5});
+        CHECK(next(begin(rng), 4) == end(rng));
+        CHECK(&*begin(*next(begin(rng), 2)) == &v[2]);
+
+        auto it = end(rng);
+        --it;
+        check_equal(*it, {3, 4, 5});
+        it -= 2;
+        check_equal(*it, {1, 2, 3});
+        CHECK((end(rng) - it) == 3);
+        CHECK((it - begin(rng)) == 1);
+
+        auto rev = rng | view::reverse;
+        check_equal(*begin(rev), {3, 4, 5});
+        check_equal(*next(begin(rev), 3), {0, 1, 2});
+    }
+
+    {
+        CHECK(size(v | view::sliding(1)) == 6u);
+        check_equal(*begin(v | view::sliding(1)), {0});
+        CHECK(size(v | view::sliding(6)) == 1u);
+        check_equal(*begin(v | view::sliding(6)), {0, 1, 2, 3, 4, 5});
+        // Too few elements for a single window.
+        CHECK(size(v | view::sliding(7)) == 0u);
+        CHECK(begin(v | view::sliding(7)) == end(v | view::sliding(7)));
+        std::vector<int> e;
+        CHECK(size(e | view::sliding(2)) == 0u);
+    }
+
+    {
+        std::list<int> l(v.begin(), v.end());
+        auto rng = l | view::sliding(4);
+        models<concepts::BidirectionalRange>(rng);
+        models_not<concepts::RandomAccessRange>(rng);
+        models<concepts::SizedRange>(*begin(rng));
+        CHECK(size(rng) == 3u);
+        auto it = begin(rng);
+        check_equal(*it, {0, 1, 2, 3});
+        check_equal(*++it, {1, 2, 3, 4});
+        check_equal(*++it, {2, 3, 4, 5});
+        CHECK(++it == end(rng));
+        check_equal(*--it, {2, 3, 4, 5});
+        CHECK(size(*it) == 4u);
+    }
+
+    {
+        std::forward_list<int> fl(v.begin(), v.end());
+        auto rng = fl | view::sliding(5);
+        models<concepts::ForwardRange>(rng);
+        models_not<concepts::BidirectionalRange>(rng);
+        CHECK(distance(rng) == 2);
+        check_equal(*begin(rng), {0, 1, 2, 3, 4});
+        check_equal(*next(begin(rng)), {1, 2, 3, 4, 5});
+        CHECK(distance(fl | view::sliding(7)) == 0);
+    }
+
+    {
+        // An infinite base.
+        auto rng = view::iota(0) | view::sliding(2);
+        models<concepts::BidirectionalRange>(rng);
+        auto it = begin(rng);
+        check_equal(*it, {0, 1});
+        check_equal(*next(it, 10), {10, 11});
+        CHECK(distance(rng | view::take(5)) == 5);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,110 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <random>
+#include <vector>
+#include <utility>
+#include <functional>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sliding_extremum.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/algorithm/min_element.hpp>
+#include <range/v3/algorithm/max_element.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+    {
+        auto mins = v | view::sliding_min(3);
+        models<concepts::InputRange>(mins);
+        models_not<concepts::ForwardRange>(mins);
+        has_type<int &>(*begin(mins));
+        ::check_equal(mins, {1, 1, 1, 1, 2, 2, 2, 3, 3});
+        // Iterating again starts over.
+        ::check_equal(mins, {1, 1, 1, 1, 2, 2, 2, 3, 3});
+        ::check_equal(v | view::sliding_max(3), {4, 4, 5, 9, 9, 9, 6, 6, 5});
+    }
+
+    {
+        // Of equivalent elements, the first one of the window is the extremum.
+        std::vector<std::pair<int, int>> ps{{2, 0}, {1, 1}, {1, 2}, {2, 3}, {1, 4}, {2, 5}};
+        auto mins = ps | view::sliding_min(3, ordered_less{}, &std::pair<int, int>::first);
+        std::vector<int> at;
+        for(auto it = begin(mins); it != end(mins); ++it)
+            at.push_back((*it).second);
+        ::check_equal(at, {1, 1, 2, 4});
+        auto maxs = ps | view::sliding_max(3, ordered_less{}, &std::pair<int, int>::first);
+        at.clear();
+        for(auto it = begin(maxs); it != end(maxs); ++it)
+            at.push_back((*it).second);
+        ::check_equal(at, {0, 3, 3, 3});
+    }
+
+    {
+        ::check_equal(v | view::sliding_min(1), v);
+        ::check_equal(v | view::sliding_max(11), {9});
+        auto none = v | view::sliding_min(12);
+        CHECK(begin(none) == end(none));
+        std::forward_list<int> fl{5, 4, 3, 2, 1};
+        ::check_equal(fl | view::sliding_max(2), {5, 4, 3, 2});
+        ::check_equal(fl | view::sliding_min(2, std::greater<int>{}), {5, 4, 3, 2});
+        ::check_equal(view::iota(0) | view::sliding_min(5) | view::take(3), {0, 1, 2});
+    }
+
+    {
+        // Against the windows' min_element and max_element, with windows wide
+        // enough to make the ring buffer grow.
+        std::mt19937 gen;
+        std::uniform_int_distribution<int> dist(0, 50);
+        std::vector<int> r(2000);
+        for(auto &i : r)
+            i = dist(gen);
+        for(int n : {2, 7, 20, 64})
+        {
+            std::vector<int> mins, maxs, want_mins, want_maxs;
+            auto mi = r | view::sliding_min(n);
+            for(auto it = begin(mi); it != end(mi); ++it)
+                mins.push_back(*it);
+            auto ma = r | view::sliding_max(n);
+            for(auto it = begin(ma); it != end(ma); ++it)
+                maxs.push_back(*it);
+            for(auto &&w : r | view::sliding(n))
+            {
+                want_mins.push_back(*min_element(w));
+                want_maxs.push_back(*max_element(w));
+            }
+            ::check_equal(mins, want_mins);
+            ::check_equal(maxs, want_maxs);
+        }
+        // The window is extremal over an increasing run, which keeps every
+        // element of the window a candidate.
+        std::vector<int> up(100);
+        for(int i = 0; i != 100; ++i)
+            up[static_cast<std::size_t>(i)] = i;
+        std::vector<int> mins;
+        auto mi = up | view::sliding_min(30);
+        for(auto it = begin(mi); it != end(mi); ++it)
+            mins.push_back(*it);
+        CHECK(mins.size() == 71u);
+        CHECK(mins.front() == 0);
+        CHECK(mins.back() == 70);
+    }
+
+    return test_result();
+}
@@ -0,0 +1,96 @@
+// Range v3 library
+//
+//  Copyright Eric Niebler 2014
+//
+//  Use, modification and distribution is subject to the
+//  Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/ericniebler/range-v3
+
+#include <vector>
+#include <functional>
+#include <forward_list>
+#include <range/v3/core.hpp>
+#include <range/v3/view/sliding_fold.hpp>
+#include <range/v3/view/sliding.hpp>
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/take.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include "../simple_test.hpp"
+#include "../test_utils.hpp"
+
+int main()
+{
+    using namespace ranges;
+
+    std::vector<int> v{3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5};
+
+    {
+        auto rng = v | view::sliding_fold(3, std::plus<int>{}, std::minus<int>{});
+        models<concepts::ForwardRange>(rng);
+        models<concepts::SizedRange>(rng);
+        CHECK(size(rng) == 9u);
+        ::check_equal(rng, {8, 6, 10, 15, 16, 17, 13, 14, 13});
+        // The same as folding each window whole.
+        auto whole = v | view::sliding(3) | view::transform([](range<std::vector<int>::iterator> w)
+        {
+            return accumulate(w, 0);
+        });
+        ::check_equal(rng, whole);
+        // Copies of an iterator go on independently.
+        auto it = next(begin(rng), 2);
+        auto it2 = it;
+        CHECK(*++it == 15);
+        CHECK(*it2 == 10);
+    }
+
+    {
+        auto rng = v | view::sliding_fold(1, std::plus<int>{}, std::minus<int>{});
+        ::check_equal(rng, v);
+        auto all = v | view::sliding_fold(11, std::plus<int>{}, std::minus<int>{});
+        ::check_equal(all, {44});
+        auto none = v | view::sliding_fold(12, std::plus<int>{}, std::minus<int>{});
+        CHECK(size(none) == 0u);
+        CHECK(begin(none) == end(none));
+    }
+
+    {
+        // Products over a forward-only range, piped.
+        std::forward_list<int> fl{1, 2, 3, 4, 5, 6};
+        auto rng = fl | view::sliding_fold(2, std::multiplies<int>{}, std::divides<int>{});
+        models<concepts::ForwardRange>(rng);
+        ::check_equal(rng, {2, 6, 12, 20, 30});
+    }
+
+    {
+        // Moving sums of an infinite range.
+        auto rng = view::iota(1) | view::sliding_fold(4, std::plus<int>{}, std::minus<int>{});
+        ::check_equal(rng | view::take(4), {10, 14, 18, 22});
+    }
+
+    {
+        // Stateful operations are called through the view.
+        int calls = 0;
+        auto counting = [&calls](int a, int b) { ++calls; return a + b; };
+        auto rng = v | view::sliding_fold(3, counting, std::minus<int>{});
+        ::check_equal(rng, {8, 6, 10, 15, 16, 17, 13, 14, 13});
+        // Two to fold the first window, and one for each step after it.
+        CHECK(calls == 2 + 8);
+    }
+
+    {
+        // The element taken out of a fold is the oldest of the window. With an
+        // op that is not commutative, it is taken out as if it had been folded
+        // in last, which gives 124 rather than 234 for the second window.
+        std::vector<int> digits{1, 2, 3, 4};
+        auto rng = digits | view::sliding_fold(3,
+            [](int x, int y) { return 10 * x + y; },
+            [](int z, int y) { return (z - y) / 10; });
+        ::check_equal(rng, {123, 124});
+    }
+
+    return test_result();
+}
@@ -11,7 +11,9 @@
 
 #include <string>
 #include <range/v3/core.hpp>
+#include <range/v3/view/c_str.hpp>
 #include <range/v3/view/counted.hpp>
+#include <range/v3/view/delimit.hpp>
 #include <range/v3/view/split.hpp>
 #include <range/v3/view/empty.hpp>
 #include "../simple_test.hpp"
@@ -127,5 +129,49 @@ int main()
         }
     }
 
+    // Single-character delimiters over contiguous characters are found with a
+    // byte search. The pieces must match those found one position at a time.
+    {
+        std::string str(",,a,bc,,def,");
+        forward_iterator<std::string::iterator> i {str.begin()};
+        auto slow = view::counted(i, str.size()) | view::split(',');
+        auto fast = view::split(str, ',');
+        CHECK(distance(fast) == 6);
+        CHECK(distance(fast) == distance(slow));
+        auto it = begin(slow);
+        RANGES_FOR(auto &&piece, fast)
+        {
+            check_equal(piece, *it);
+            ++it;
+        }
+        check_equal(*(next(begin(fast),2)), c_str("a"));
+        check_equal(*(next(begin(fast),5)), c_str("def"));
+
+        std::vector<char> const vec(str.begin(), str.end());
+        CHECK(distance(view::split(vec, ',')) == 6);
+    }
+
+    // Null-terminated strings find the delimiter or the terminator in one scan.
+    {
+        char const *sz = "Now is  the time ";
+        auto rng = view::c_str(sz) | view::split(' ');
+        CHECK(distance(rng) == 5);
+        if(distance(rng) == 5)
+        {
+            check_equal(*(next(begin(rng),0)), c_str("Now"));
+            check_equal(*(next(begin(rng),1)), c_str("is"));
+            CHECK(empty(*(next(begin(rng),2))));
+            check_equal(*(next(begin(rng),3)), c_str("the"));
+            check_equal(*(next(begin(rng),4)), c_str("time"));
+        }
+        CHECK(distance(view::c_str("") | view::split(' ')) == 0);
+        CHECK(distance(view::c_str("abc") | view::split(' ')) == 1);
+
+        // Delimited by something other than the null terminator
+        auto rng2 = view::delimit(sz, 't') | view::split(' ');
+        CHECK(distance(rng2) == 3);
+        check_equal(*(next(begin(rng2),1)), c_str("is"));
+    }
+
     return test_result();
 }
@@ -12,9 +12,11 @@
 #include <list>
 #include <vector>
 #include <sstream>
+#include <type_traits>
 #include <range/v3/core.hpp>
 #include <range/v3/istream_range.hpp>
 #include <range/v3/view/stride.hpp>
+#include <range/v3/view/remove_if.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/utility/iterator.hpp>
@@ -32,6 +34,7 @@ int main()
     static_assert(
         sizeof((v|view::stride(3)).begin()) ==
         sizeof(void*)+sizeof(v.begin())+sizeof(std::ptrdiff_t),"");
+    static_assert(std::is_trivially_copyable<decltype((v|view::stride(3)).begin())>::value, "");
     ::check_equal(v | view::stride(3) | view::reverse,
                   {48, 45, 42, 39, 36, 33, 30, 27, 24, 21, 18, 15, 12, 9, 6, 3, 0});
 
@@ -50,6 +53,28 @@ int main()
     ::check_equal(li | view::stride(3) | view::reverse,
                   {48, 45, 42, 39, 36, 33, 30, 27, 24, 21, 18, 15, 12, 9, 6, 3, 0});
 
+    static_assert(std::is_trivially_copyable<decltype((li|view::stride(3)).begin())>::value, "");
+
+    // A bidirectional base that is bounded but not sized: the offset of the
+    // end is found by walking the base once.
+    auto odd = v | view::remove_if([](int i){ return i % 2 == 0; });
+    auto x3 = odd | view::stride(4);
+    CONCEPT_ASSERT(BidirectionalRange<decltype(x3)>());
+    CONCEPT_ASSERT(BoundedRange<decltype(x3)>());
+    CONCEPT_ASSERT(!SizedRange<decltype(x3)>());
+    ::check_equal(x3, {1, 9, 17, 25, 33, 41, 49});
+    ::check_equal(x3 | view::reverse, {49, 41, 33, 25, 17, 9, 1});
+    ::check_equal(odd | view::stride(5) | view::reverse, {41, 31, 21, 11, 1});
+
+    // Iterating forwards does not walk the base to find the offset of the end.
+    int calls = 0;
+    auto odd2 = v | view::remove_if([&calls](int i){ ++calls; return i % 2 == 0; })
+                  | view::stride(2);
+    for(int i : odd2)
+        CHECK((i % 4) == 1);
+    CHECK(calls == 50);
+    ::check_equal(odd2 | view::reverse, {49, 45, 41, 37, 33, 29, 25, 21, 17, 13, 9, 5, 1});
+
     for(int i : li | view::stride(3) | view::reverse)
         std::cout << i << ' ';
     std::cout << '\n';
@@ -64,5 +89,17 @@ int main()
     CHECK((it0 - it0) == 0);
     CHECK((it1 - it1) == 0);
 
+    // Distances and jumps from the end, whose base iterator is short of a
+    // whole stride.
+    auto it2 = x2.end();
+    CHECK((it2 - it0) == 17);
+    CHECK(*(it2 - 1) == 48);
+    CHECK(*(it2 - 17) == 0);
+    CHECK((it0 + 17) == it2);
+    auto x4 = v | view::stride(7);
+    CHECK(ranges::distance(x4) == 8);
+    CHECK(*(x4.end() - 1) == 49);
+    CHECK((x4.end() - x4.begin()) == 8);
+
     return ::test_result();
 }
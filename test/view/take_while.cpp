@@ -27,6 +27,13 @@ int main()
     CONCEPT_ASSERT(RandomAccessRange<take_while_view<std::vector<int> &, std::function<bool(int)>>>());
 
     std::vector<int> vi{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    struct is_not_50
+    {
+        bool operator()(int i) const { return i != 50; }
+    };
+    // An empty predicate is not stored in the sentinel.
+    static_assert(sizeof(end(vi | view::take_while(is_not_50{}))) == sizeof(vi.end()), "");
+
     auto rng1 = vi | view::take_while([](int i) { return i != 50; });
     ::check_equal(rng1, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
 
@@ -42,6 +42,8 @@ int main()
     models<concepts::SizedRange>(rng);
     models<concepts::RandomAccessRange>(rng);
     ::check_equal(rng, {true, false, true, false, true, false, true, false, true, false});
+    // An empty function object is not stored in the iterators.
+    static_assert(sizeof(begin(rng)) == sizeof(int *), "");
 
     std::pair<int, int> rgp[] = {{1,1}, {2,2}, {3,3}, {4,4}, {5,5}, {6,6}, {7,7}, {8,8}, {9,9}, {10,10}};
     auto && rng2 = rgp | view::transform(&std::pair<int,int>::first);
@@ -119,5 +121,43 @@ int main()
         CONCEPT_ASSERT(Same<range_rvalue_reference_t<R2>, std::string &&>());
     }
 
+    // Stacked transforms are fused into one transform_view of the base.
+    {
+        auto fused = rgp | view::transform(&std::pair<int,int>::first)
+                         | view::transform(std::negate<int>())
+                         | view::transform([](int i) { return i * 10; });
+        using F = decltype(fused);
+        CONCEPT_ASSERT(Same<decltype(fused.base()), range<std::pair<int, int> *> &>());
+        CONCEPT_ASSERT(Same<range_value_t<F>, int>());
+        models<concepts::RandomAccessRange>(fused);
+        models<concepts::SizedRange>(fused);
+        ::check_equal(fused, {-10,-20,-30,-40,-50,-60,-70,-80,-90,-100});
+        ::check_equal(fused | view::reverse, {-100,-90,-80,-70,-60,-50,-40,-30,-20,-10});
+        CHECK(begin(fused).base() == &rgp[0]);
+
+        // The reference type is that of the last function, and references
+        // pass through.
+        auto refs = rgp | view::transform(&std::pair<int,int>::second)
+                        | view::transform([](int &i) -> int & { return i; });
+        has_type<int &>(*begin(refs));
+        CONCEPT_ASSERT(Same<range_rvalue_reference_t<decltype(refs)>, int &&>());
+        CHECK(&*begin(refs) == &rgp[0].second);
+
+        // Each function is called once per element, in order, as when nested.
+        std::vector<int> calls;
+        auto logged = rgi | view::transform([&calls](int i) { calls.push_back(i); return i + 1; })
+                          | view::transform([&calls](int i) { calls.push_back(-i); return i; });
+        CHECK(*next(begin(logged), 2) == 4);
+        ::check_equal(calls, {3, -4});
+
+        // A transform of an lvalue transform_view leaves it as it was.
+        auto odd = rgi | view::transform(is_odd());
+        auto negated = odd | view::transform(std::logical_not<bool>());
+        ::check_equal(negated, {false, true, false, true, false, true, false, true, false, true});
+        ::check_equal(odd, {true, false, true, false, true, false, true, false, true, false});
+        // Empty function objects compose into an empty one.
+        static_assert(sizeof(begin(negated)) == sizeof(int *), "");
+    }
+
     return test_result();
 }
@@ -21,9 +21,11 @@
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/stride.hpp>
 #include <range/v3/view/bounded.hpp>
+#include <range/v3/view/reverse.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/algorithm/move.hpp>
+#include <range/v3/algorithm/sort.hpp>
 #include <range/v3/utility/iterator.hpp>
 #include "../simple_test.hpp"
 #include "../test_utils.hpp"
@@ -151,6 +153,35 @@ int main()
         ::check_equal(expected, {"ax","by","cz"});
     }
 
+    // Zips of sized random-access ranges of different lengths
+    {
+        std::vector<int> v0{1, 2, 3, 4, 5};
+        int const v1[] = {10, 20, 30};
+        auto rng = view::zip_with(std::plus<int>{}, v0, v1);
+        ::models<concepts::BoundedRange>(rng);
+        ::models<concepts::SizedRange>(rng);
+        ::models<concepts::RandomAccessIterator>(begin(rng));
+        CHECK(rng.size() == 3u);
+        CHECK((end(rng) - begin(rng)) == 3);
+        CHECK(*(begin(rng) + 2) == 33);
+        CHECK(*(end(rng) - 1) == 33);
+        CHECK(begin(rng)[1] == 22);
+        ::check_equal(rng, {11, 22, 33});
+        ::check_equal(rng | view::reverse, {33, 22, 11});
+
+        auto zipped = view::zip(v0, v1);
+        ::check_equal(zipped | view::keys, {1, 2, 3});
+        auto it = next(begin(zipped), 3);
+        CHECK(it == end(zipped));
+        CHECK(prev(it) != end(zipped));
+
+        std::vector<int> k{3, 1, 2}, v{30, 10, 20};
+        auto kv = view::zip(k, v);
+        sort(kv);
+        ::check_equal(k, {1, 2, 3});
+        ::check_equal(v, {10, 20, 30});
+    }
+
     // Move from a zip view
     {
         auto v0 = to_<std::vector<MoveOnlyString>>({"a","b","c"});